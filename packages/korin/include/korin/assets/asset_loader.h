@@ -0,0 +1,158 @@
+// asset_loader.h
+//
+// Describes the AssetLoader class which streams assets out of a PackFile, decoding
+// them on worker threads and evicting the unused ones when over its memory budget.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "korin/assets/pack_file.h"
+#include "korin/util/thread_pool.h"
+
+namespace korin
+{
+enum class AssetState : std::uint8_t
+{
+   Unloaded,
+   Loading,
+   Ready,
+   Failed
+};
+
+/// A loaded asset. Decoded assets are handed over in the layout of their plain type,
+/// so a RunLengthImage reads as an Image.
+struct AssetData
+{
+   const std::uint8_t* bytes;
+   std::size_t size;
+   PackBlobType type;
+};
+
+/// A view of an Image blob. The pixels are read in place, which assumes a little-endian machine.
+struct ImageView
+{
+   std::uint32_t width;
+   std::uint32_t height;
+   const std::uint32_t* pixels;
+};
+
+/// Assets are reference counted by entry index. Raw and Image blobs are ready as soon
+/// as they are acquired and cost nothing but the pages the OS maps in. Other blobs
+/// are decoded on the thread pool and become ready in the first update after they
+/// finish. Released assets stay loaded, least recently released first in line to be
+/// evicted, until the decoded memory goes over budget. Everything but the decoding
+/// happens on the thread that owns the loader.
+///    std::uint32_t level = loader.acquire("levels/forest/tiles");
+///    ...
+///    loader.update();
+///    AssetData tiles;
+///    if (loader.get(level, tiles)) { ... }
+///    loader.release(level);
+class AssetLoader
+{
+public:
+   // Turns a blob into its plain type. Runs on a worker thread.
+   using Decoder = std::function<bool(const std::uint8_t* bytes, std::size_t size, std::vector<std::uint8_t>& decoded)>;
+
+   // The pack and pool have to outlive the loader
+   AssetLoader(const PackFile& pack, ThreadPool& threadPool, std::size_t memoryBudget);
+
+   // Waits for the decodes still running
+   ~AssetLoader();
+
+   AssetLoader(const AssetLoader&) = delete;
+   AssetLoader& operator=(const AssetLoader&) = delete;
+
+   // Replaces how blobs of the type are decoded, RunLengthImage included
+   void setDecoder(PackBlobType type, Decoder decoder);
+
+   // Adds a reference and starts loading the asset if it isn't loaded.
+   // Returns PackFile::INVALID_PACK_ENTRY if the pack doesn't have it.
+   std::uint32_t acquire(const std::string& name);
+   void acquire(std::uint32_t entry);
+   void release(std::uint32_t entry);
+
+   // Publishes the finished decodes and evicts what's over budget. Call once a frame.
+   void update();
+
+   // Blocks until nothing is loading, for loading screens
+   void finishLoading();
+
+   // False until the asset is ready. The bytes are valid until it is evicted, which
+   // can't happen while it is referenced.
+   bool get(std::uint32_t entry, AssetData& data) const;
+
+   // Failed and 0 for entries the pack doesn't have
+   AssetState state(std::uint32_t entry) const;
+   std::uint32_t referenceCount(std::uint32_t entry) const;
+
+   // Bytes held by decoded assets
+   std::size_t memoryUsed() const { return m_MemoryUsed; }
+   std::size_t memoryBudget() const { return m_MemoryBudget; }
+   void setMemoryBudget(std::size_t memoryBudget) { m_MemoryBudget = memoryBudget; }
+
+   std::uint32_t evictionCount() const { return m_EvictionCount; }
+
+   // Reads the header of an Image
+   static bool readImage(const AssetData& data, ImageView& image);
+
+private:
+   struct Entry
+   {
+      AssetState state;
+      std::uint32_t referenceCount;
+      std::vector<std::uint8_t> decoded;
+
+      // Position in m_Unused while the asset is loaded and unreferenced
+      std::list<std::uint32_t>::iterator unusedIt;
+      bool unused;
+   };
+
+   struct Completed
+   {
+      std::uint32_t entry;
+      bool decoded;
+      std::vector<std::uint8_t> bytes;
+   };
+
+   // Warns about entries past the end of the pack
+   bool isValidEntry(std::uint32_t entry) const;
+
+   void startLoading(std::uint32_t entry);
+   void publish(Completed& completed);
+   void evict();
+
+   const Decoder* decoderFor(PackBlobType type) const;
+
+private:
+   const PackFile& m_Pack;
+   ThreadPool& m_ThreadPool;
+   std::size_t m_MemoryBudget;
+   std::size_t m_MemoryUsed;
+   std::uint32_t m_EvictionCount;
+
+   // Indexed by pack entry
+   std::vector<Entry> m_Entries;
+   std::vector<Decoder> m_Decoders;
+
+   // Loaded assets without references, least recently released first
+   std::list<std::uint32_t> m_Unused;
+
+   std::uint32_t m_Loading;
+
+   // Filled by the workers
+   std::mutex m_CompletedMutex;
+   std::condition_variable m_CompletedAvailable;
+   std::vector<Completed> m_Completed;
+};
+} // namespace korin
@@ -0,0 +1,117 @@
+// asset_registry.h
+//
+// Describes the AssetRegistry class which turns resource handles into compact asset
+// IDs and packs the images behind them into texture atlases.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "korin/render/render_backend.h"
+#include "korin/util/string_id.h"
+
+namespace korin
+{
+using AssetID = std::uint32_t;
+
+// An AssetID that never refers to a registered asset
+constexpr AssetID INVALID_ASSET_ID = UINT32_MAX;
+
+// Atlas pages use the texture IDs from here up, leaving the lower ones for textures set directly
+constexpr TextureID ATLAS_TEXTURE_ID_BASE = 1u << 16;
+
+/// Where an image ended up in the atlas
+struct SpriteAsset
+{
+   TextureID textureID;
+   float u0, v0, u1, v1;
+
+   // Size of the image in pixels
+   std::uint32_t width, height;
+};
+
+/// One atlas texture, ready to hand to a backend
+struct AtlasPage
+{
+   TextureID textureID;
+   std::uint32_t width;
+   std::uint32_t height;
+   std::vector<std::uint32_t> pixels;
+};
+
+/// Resource handles are interned when images are added and only looked up while
+/// loading. Components keep the AssetID and the rect they copied from the SpriteAsset,
+/// so nothing holds a string while the game runs. Every image shares the few atlas pages,
+/// so sprites of different images on the same layer still draw in one batch.
+/// Nothing here locks. Add images and build the atlas before worlds run on other threads.
+///    AssetID hero = AssetRegistry::instance().addImage("hero/idle", 16, 16, pixels);
+///    AssetRegistry::instance().buildAtlas();
+///    sprite->setAsset(hero);
+class AssetRegistry
+{
+public:
+   AssetRegistry(const AssetRegistry&) = delete;
+   void operator=(const AssetRegistry&) = delete;
+
+   static AssetRegistry& instance()
+   {
+      static AssetRegistry instance;
+      return instance;
+   }
+
+   // Copies the pixels, packed with rgba(), row by row from the top. Adding a handle
+   // again replaces its pixels and keeps its ID. Takes effect on the next buildAtlas.
+   AssetID addImage(const std::string& handle, std::uint32_t width, std::uint32_t height, const std::uint32_t* pixels);
+
+   // Packs every image added so far into square pages with a border of repeated edge
+   // pixels around each one. IDs stay the same but their rects may move.
+   bool buildAtlas(std::uint32_t pageSize = 1024, std::uint32_t padding = 1);
+
+   // INVALID_ASSET_ID if the handle was never added
+   AssetID find(StringID handle) const;
+
+   // Null if the ID is unknown or the atlas wasn't built since the image was added
+   const SpriteAsset* sprite(AssetID assetID) const;
+
+   // An empty StringID if the ID is unknown
+   StringID handle(AssetID assetID) const;
+
+   const std::vector<AtlasPage>& pages() const { return m_Pages; }
+
+   std::size_t size() const { return m_Images.size(); }
+
+   // Forgets every asset. IDs handed out before are no longer valid.
+   void clear();
+
+private:
+   AssetRegistry();
+
+   struct Image
+   {
+      StringID handle;
+      std::uint32_t width;
+      std::uint32_t height;
+      std::vector<std::uint32_t> pixels;
+
+      // Cleared when the pixels change, until the next buildAtlas
+      bool packed;
+   };
+
+   // Copies an image into a page and repeats its edges out into the padding
+   void blit(const Image& image, AtlasPage& page, std::uint32_t x, std::uint32_t y, std::uint32_t padding) const;
+
+private:
+   // Indexed by AssetID
+   std::vector<Image> m_Images;
+   std::vector<SpriteAsset> m_Sprites;
+
+   std::unordered_map<StringID, AssetID> m_IDsByHandle;
+   std::vector<AtlasPage> m_Pages;
+};
+} // namespace korin
@@ -0,0 +1,68 @@
+// atlas_packer.h
+//
+// Describes the AtlasPacker class which places rectangles on as few fixed size
+// atlas pages as it can.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace korin
+{
+struct AtlasRect
+{
+   std::uint32_t width;
+   std::uint32_t height;
+};
+
+// Where a rectangle went, inside its padding
+struct AtlasPlacement
+{
+   std::uint32_t page;
+   std::uint32_t x;
+   std::uint32_t y;
+};
+
+/// Shelf packer. The rectangles are placed tallest first, each on the first shelf of
+/// any page that still has room for it, and a new shelf or page is opened when none
+/// does. Every rectangle keeps a border of padding pixels on each side so neighbours
+/// never bleed into each other when sampled.
+class AtlasPacker
+{
+public:
+   AtlasPacker(std::uint32_t pageWidth, std::uint32_t pageHeight, std::uint32_t padding);
+
+   // Fills one placement per rectangle in the same order. Fails if a rectangle
+   // doesn't fit on an empty page.
+   bool pack(const std::vector<AtlasRect>& rects, std::vector<AtlasPlacement>& placements);
+
+   std::uint32_t pageWidth() const { return m_PageWidth; }
+   std::uint32_t pageHeight() const { return m_PageHeight; }
+   std::uint32_t padding() const { return m_Padding; }
+
+   // Pages used by the last pack
+   std::uint32_t pageCount() const { return m_PageCount; }
+
+private:
+   struct Shelf
+   {
+      std::uint32_t page;
+      std::uint32_t y;
+      std::uint32_t height;
+
+      // Width already taken from the left
+      std::uint32_t used;
+   };
+
+private:
+   std::uint32_t m_PageWidth;
+   std::uint32_t m_PageHeight;
+   std::uint32_t m_Padding;
+   std::uint32_t m_PageCount;
+   std::vector<Shelf> m_Shelves;
+};
+} // namespace korin
@@ -0,0 +1,125 @@
+// pack_file.h
+//
+// Describes the PackFile class which memory maps a pack of assets and hands out
+// pointers straight into it, and the PackWriter class which builds packs.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "korin/util/mapped_file.h"
+
+namespace korin
+{
+// Every blob starts on a multiple of this, so it can be read in place with any alignment
+constexpr std::size_t PACK_ALIGNMENT = 64;
+
+constexpr std::uint32_t PACK_MAGIC = 0x4B41504B; // "KPAK"
+constexpr std::uint16_t PACK_VERSION = 1;
+
+/// How a blob is stored. Raw and Image blobs are used in place; the others are decoded
+/// into memory first.
+enum class PackBlobType : std::uint16_t
+{
+   // Bytes the game reads itself
+   Raw,
+
+   // Width and height as u32, then the pixels packed with rgba()
+   Image,
+
+   // Width and height as u32, then runs of a varint count and a u32 color
+   RunLengthImage,
+
+   // A serialized Prefab
+   Prefab
+};
+
+/// One blob in the table of contents
+struct PackEntry
+{
+   std::uint64_t nameHash;
+   std::uint64_t offset;
+   std::uint64_t size;
+   std::string name;
+   PackBlobType type;
+};
+
+/// Read only view of a pack file. The file is
+///    header | blobs, each aligned to PACK_ALIGNMENT | table of contents | names
+/// The table is read once when the pack is opened, and sorted by name hash so an
+/// entry is found without touching the names. The blobs are never copied; the OS
+/// pages them in when they are first read.
+class PackFile
+{
+public:
+   PackFile();
+   ~PackFile();
+
+   PackFile(const PackFile&) = delete;
+   PackFile& operator=(const PackFile&) = delete;
+
+   // Fails if the file can't be mapped or isn't a pack this version understands
+   bool open(const std::string& path);
+   void close();
+
+   bool isOpen() const { return m_Data != nullptr; }
+
+   // Index of the entry or INVALID_PACK_ENTRY
+   std::uint32_t find(const std::string& name) const;
+
+   const std::vector<PackEntry>& entries() const { return m_Entries; }
+
+   // Points into the mapped file, valid until the pack is closed. Null if there is no such entry.
+   const std::uint8_t* data(std::uint32_t entry) const;
+
+   // 64-bit FNV-1a hash of an entry name
+   static std::uint64_t hashName(const std::string& name);
+
+public:
+   static constexpr std::uint32_t INVALID_PACK_ENTRY = UINT32_MAX;
+
+private:
+   bool readTableOfContents();
+
+private:
+   const std::uint8_t* m_Data;
+   std::size_t m_Size;
+   std::vector<PackEntry> m_Entries;
+   MappedFile m_File;
+};
+
+/// Collects blobs in memory and writes them out as a pack
+class PackWriter
+{
+public:
+   PackWriter();
+
+   // Adding a name twice replaces the first blob
+   void add(const std::string& name, PackBlobType type, const void* data, std::size_t size);
+
+   // Stores the pixels, packed with rgba(), run length encoded when asked
+   void addImage(const std::string& name, std::uint32_t width, std::uint32_t height, const std::uint32_t* pixels,
+      bool runLengthEncode = false);
+
+   bool write(const std::string& path) const;
+
+   std::size_t size() const { return m_Blobs.size(); }
+
+private:
+   struct Blob
+   {
+      std::string name;
+      PackBlobType type;
+      std::vector<std::uint8_t> bytes;
+   };
+
+private:
+   std::vector<Blob> m_Blobs;
+};
+} // namespace korin
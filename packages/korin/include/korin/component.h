@@ -7,12 +7,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <cstdint>
 #include <unordered_map>
 
 #include "korin/log.h"
+#include "korin/entity.h"
 
 namespace korin
 {
@@ -22,19 +24,30 @@ using ComponentTypeID = std::uint32_t;
 /// used to compose an Entity.
 struct Component 
 {
+friend class EntityAdmin;
+
 public:
    Component()
       : m_Siblings(std::unordered_map<ComponentTypeID, std::weak_ptr<Component>>()) 
+      , m_EntityID(INVALID_ENTITY_ID)
+      , m_SiblingsVersion(0)
       {}
 
    virtual ~Component() = default;
 
    // Create the component from a resource
-   virtual void create(std::string resource) = 0;
+   virtual void create(StringID resource) = 0;
 
    // Get the type ID of the component
    virtual ComponentTypeID typeID() = 0;
 
+   // Get the ID of the Entity this component was added to
+   EntityID entityID() const { return m_EntityID; }
+
+   // Changes whenever a sibling is added or removed, so a system that caches
+   // sibling lookups knows when to look them up again
+   std::uint32_t siblingsVersion() const { return m_SiblingsVersion; }
+
    // Get a sibling component by type
    template <typename T>
    std::weak_ptr<T> sibling() const
@@ -74,6 +87,19 @@ public:
       }
 
       m_Siblings[siblingPtr->typeID()] = component;
+      m_SiblingsVersion++;
+      return true;
+   }
+
+   // Remove a sibling component by type
+   bool removeSibling(ComponentTypeID siblingTypeID)
+   {
+      if (m_Siblings.erase(siblingTypeID) == 0)
+      {
+         return false;
+      }
+
+      m_SiblingsVersion++;
       return true;
    }
 
@@ -87,8 +113,11 @@ public:
    }
 
 private:
-   static ComponentTypeID m_NextID;
+   // Atomic since worlds on different threads may use a type for the first time at once
+   static std::atomic<ComponentTypeID> m_NextID;
    std::unordered_map<ComponentTypeID, std::weak_ptr<Component>> m_Siblings;
+   EntityID m_EntityID;
+   std::uint32_t m_SiblingsVersion;
 };
 
 using ComponentPtr = std::shared_ptr<Component>;
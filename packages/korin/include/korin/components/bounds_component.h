@@ -0,0 +1,45 @@
+// bounds_component.h
+//
+// Describes the BoundsComponent struct which is used to represent the extents of an 
+// entity around its TransformComponent for spatial queries.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include "korin/component.h"
+#include "korin/math/aabb.h"
+#include "korin/components/transform_component.h"
+
+namespace korin
+{
+struct BoundsComponent : public Component 
+{
+public:
+   BoundsComponent(float halfWidth, float halfHeight)
+      : halfWidth(halfWidth), halfHeight(halfHeight) {}
+
+   BoundsComponent() 
+      : halfWidth(0.5f), halfHeight(0.5f) {}
+
+   virtual ComponentTypeID typeID() override 
+   {
+      return Component::typeID<BoundsComponent>();
+   }
+
+   virtual void create(StringID resource) override {}
+
+   // World space bounds centered on the transform and scaled by it
+   AABB worldBounds(const TransformComponent& transform) const
+   {
+      const float extentX = halfWidth * (transform.scaleX < 0.0f ? -transform.scaleX : transform.scaleX);
+      const float extentY = halfHeight * (transform.scaleY < 0.0f ? -transform.scaleY : transform.scaleY);
+      return AABB(transform.x - extentX, transform.y - extentY, transform.x + extentX, transform.y + extentY);
+   }
+
+public:
+   // Half of the unscaled width and height of the entity
+   float halfWidth, halfHeight;
+};
+} // namespace korin
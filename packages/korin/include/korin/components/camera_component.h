@@ -0,0 +1,42 @@
+// camera_component.h
+//
+// Describes the CameraComponent struct which is used to show the world from the
+// position of its entity's TransformComponent.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+
+#include "korin/component.h"
+
+namespace korin
+{
+struct CameraComponent : public Component 
+{
+public:
+   CameraComponent(float pixelsPerUnit, std::int32_t priority = 0)
+      : pixelsPerUnit(pixelsPerUnit), priority(priority), active(true) {}
+
+   CameraComponent()
+      : CameraComponent(32.0f) {}
+
+   virtual ComponentTypeID typeID() override 
+   {
+      return Component::typeID<CameraComponent>();
+   }
+
+   virtual void create(StringID resource) override {}
+
+public:
+   // Zoom, in framebuffer pixels per world unit
+   float pixelsPerUnit;
+
+   // The active camera with the highest priority is the one the world is drawn from
+   std::int32_t priority;
+
+   bool active;
+};
+} // namespace korin
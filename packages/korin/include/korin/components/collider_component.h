@@ -0,0 +1,86 @@
+// collider_component.h
+//
+// Describes the ColliderComponent struct which is used to represent the collision shape 
+// and surface of an entity around its TransformComponent.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "korin/component.h"
+#include "korin/math/aabb.h"
+#include "korin/physics/collision.h"
+#include "korin/components/transform_component.h"
+
+namespace korin
+{
+enum class ColliderShape : std::uint8_t
+{
+   Box,
+   Circle
+};
+
+// Entities with a ColliderComponent but no enabled PhysicsComponent are static
+struct ColliderComponent : public Component 
+{
+public:
+   // Box collider
+   ColliderComponent(float halfWidth, float halfHeight)
+      : shape(ColliderShape::Box), halfWidth(halfWidth), halfHeight(halfHeight), radius(0.0f)
+      , friction(0.4f), restitution(0.0f), grounded(false) {}
+
+   // Circle collider
+   explicit ColliderComponent(float radius)
+      : shape(ColliderShape::Circle), halfWidth(radius), halfHeight(radius), radius(radius)
+      , friction(0.4f), restitution(0.0f), grounded(false) {}
+
+   ColliderComponent()
+      : ColliderComponent(0.5f, 0.5f) {}
+
+   virtual ComponentTypeID typeID() override 
+   {
+      return Component::typeID<ColliderComponent>();
+   }
+
+   virtual void create(StringID resource) override {}
+
+   // World space bounds of the shape centered on the transform and scaled by it
+   AABB worldBounds(const TransformComponent& transform) const
+   {
+      if (shape == ColliderShape::Circle)
+      {
+         const Circle circle = worldCircle(transform);
+         return AABB(circle.center.x - circle.radius, circle.center.y - circle.radius, 
+            circle.center.x + circle.radius, circle.center.y + circle.radius);
+      }
+
+      const float extentX = halfWidth * std::fabs(transform.scaleX);
+      const float extentY = halfHeight * std::fabs(transform.scaleY);
+      return AABB(transform.x - extentX, transform.y - extentY, transform.x + extentX, transform.y + extentY);
+   }
+
+   // World space circle, scaled by the larger of the transform's scales
+   Circle worldCircle(const TransformComponent& transform) const
+   {
+      return {Vector2D(transform.x, transform.y), radius * std::max(std::fabs(transform.scaleX), std::fabs(transform.scaleY))};
+   }
+
+public:
+   ColliderShape shape;
+
+   // Box half extents. For circles both are the radius.
+   float halfWidth, halfHeight;
+   float radius;
+
+   float friction;
+   float restitution;
+
+   // Set by the CollisionSystem when the entity is resting on something below it
+   bool grounded;
+};
+} // namespace korin
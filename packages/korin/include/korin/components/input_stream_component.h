@@ -7,35 +7,79 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+
 #include "korin/component.h"
+#include "korin/input/action_mask.h"
 
 namespace korin
 {
+// Bits in each of the bit-sliced per action tick counters, so they count up to 255 ticks
+constexpr std::size_t ACTION_COUNTER_BITS = 8;
+
+enum class InputSource : std::uint8_t
+{
+   // Driven by the input devices of this machine
+   Local,
+
+   // Driven by whoever writes externalActionStates, like AI or the network
+   External
+};
+
 // Contains information about the current state of the input devices
 struct InputStreamComponent : public Component
 {
 public:
    InputStreamComponent()
-      : currentActionStates(0), previousActionStates(0), actionsBegun(0), actionsEnded(0) {}
+      : currentActionStates(0), previousActionStates(0), actionsBegun(0), actionsEnded(0)
+      , source(InputSource::Local), externalActionStates(0)
+      , actionsHeld(0), actionsHoldBegun(0), actionsDoubleTapped(0), combosCompleted(0)
+      , holdCounter(), tapCounter(), tapArmed(0), comboState(0), comboIdleTicks(0) {}
 
    virtual ComponentTypeID typeID() override
    {
       return Component::typeID<InputStreamComponent>();
    }
 
-   virtual void create(std::string resource) override {}
+   virtual void create(StringID resource) override {}
 
 public:
    // Current frame's GameAction button states 
-   uint32_t currentActionStates;
+   ActionMask currentActionStates;
 
    // Previous frame's GameAction button states
-   uint32_t previousActionStates;
+   ActionMask previousActionStates;
 
    // 1 = GameAction key pressed this frame
-   uint32_t actionsBegun;
+   ActionMask actionsBegun;
 
    // 1 = GameAction key released this frame
-   uint32_t actionsEnded;
+   ActionMask actionsEnded;
+
+   InputSource source;
+
+   // Action states External streams will have next tick
+   ActionMask externalActionStates;
+
+   // 1 = GameAction held for at least the hold time
+   ActionMask actionsHeld;
+
+   // 1 = GameAction reached the hold time this frame
+   ActionMask actionsHoldBegun;
+
+   // 1 = GameAction pressed again within the double tap window this frame
+   ActionMask actionsDoubleTapped;
+
+   // 1 = combo at that index in the ActionStateMachine finished this frame
+   uint32_t combosCompleted;
+
+   // State of the ActionStateMachine. The counters are bit-sliced: bit n of 
+   // holdCounter[k] is bit k of the tick count of the GameAction at bit n.
+   std::array<ActionMask, ACTION_COUNTER_BITS> holdCounter;
+   std::array<ActionMask, ACTION_COUNTER_BITS> tapCounter;
+   ActionMask tapArmed;
+   uint64_t comboState;
+   uint32_t comboIdleTicks;
 };
-} // namespace korin
\ No newline at end of file
+} // namespace korin
@@ -11,27 +11,49 @@
 
 namespace korin
 {
-struct PhysicsComponent : public Component 
+struct PhysicsComponent : public Component
 {
 public:
    PhysicsComponent(float dx, float dy, float accelerationX, float accelerationY)
-      : dx(dx), dy(dy), accelerationX(0.0f), accelerationY(0.0f) {}
+      : dx(dx), dy(dy), accelerationX(accelerationX), accelerationY(accelerationY), inverseMass(1.0f)
+      , enabled(true), sleeping(false), sleepTime(0.0f) {}
 
-   PhysicsComponent() 
-      : dx(0.0f), dy(0.0f), accelerationX(0.0f), accelerationY(0.0f) {}
+   PhysicsComponent()
+      : dx(0.0f), dy(0.0f), accelerationX(0.0f), accelerationY(0.0f), inverseMass(1.0f)
+      , enabled(true), sleeping(false), sleepTime(0.0f) {}
 
-   virtual ComponentTypeID typeID() override 
+   virtual ComponentTypeID typeID() override
    {
       return Component::typeID<PhysicsComponent>();
    }
 
-   virtual void create(std::string resource) override 
+   virtual void create(StringID resource) override
    {
       // Do nothing
    }
 
+   // Wakes the body up so it is integrated again. Call after changing
+   // the velocity or acceleration of a sleeping body.
+   void wake()
+   {
+      sleeping = false;
+      sleepTime = 0.0f;
+   }
+
 public:
    float dx, dy;
-   float accelerationX, accelerationY; 
+   float accelerationX, accelerationY;
+
+   // One over the mass. Heavier bodies are pushed around less in collisions.
+   float inverseMass;
+
+   // Disabled bodies are never integrated and never fall asleep or wake up on their own
+   bool enabled;
+
+   // Sleeping bodies have come to rest and are skipped until woken
+   bool sleeping;
+
+   // Seconds the body has been below the sleep velocity
+   float sleepTime;
 };
 } // namespace korin
\ No newline at end of file
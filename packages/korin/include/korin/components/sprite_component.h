@@ -0,0 +1,76 @@
+// sprite_component.h
+//
+// Describes the SpriteComponent struct which is used to draw an entity as a textured
+// quad centered on its TransformComponent.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include "korin/component.h"
+#include "korin/render/render_backend.h"
+#include "korin/assets/asset_registry.h"
+
+namespace korin
+{
+struct SpriteComponent : public Component 
+{
+public:
+   SpriteComponent(TextureID textureID, float width, float height, std::int16_t layer = 0)
+      : textureID(textureID), assetID(INVALID_ASSET_ID), layer(layer), width(width), height(height)
+      , u0(0.0f), v0(0.0f), u1(1.0f), v1(1.0f), color(WHITE), visible(true) {}
+
+   SpriteComponent()
+      : SpriteComponent(0, 1.0f, 1.0f) {}
+
+   virtual ComponentTypeID typeID() override 
+   {
+      return Component::typeID<SpriteComponent>();
+   }
+
+   // Draws the registered image with the handle
+   virtual void create(StringID resource) override
+   {
+      setAsset(AssetRegistry::instance().find(resource));
+   }
+
+   // Copies the atlas page and rect of the asset. Fails if it isn't in a built atlas.
+   bool setAsset(AssetID asset)
+   {
+      const SpriteAsset* sprite = AssetRegistry::instance().sprite(asset);
+      if (!sprite)
+      {
+         return false;
+      }
+
+      assetID = asset;
+      textureID = sprite->textureID;
+      u0 = sprite->u0;
+      v0 = sprite->v0;
+      u1 = sprite->u1;
+      v1 = sprite->v1;
+      return true;
+   }
+
+public:
+   TextureID textureID;
+
+   // The image the texture and rect came from, or INVALID_ASSET_ID when they were set directly
+   AssetID assetID;
+
+   // Higher layers are drawn over lower ones
+   std::int16_t layer;
+
+   // Size in world units before the transform's scale
+   float width, height;
+
+   // Region of the texture to draw
+   float u0, v0, u1, v1;
+
+   // Tint multiplied with the texture, packed with rgba()
+   std::uint32_t color;
+
+   bool visible;
+};
+} // namespace korin
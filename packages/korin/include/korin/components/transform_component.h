@@ -18,12 +18,15 @@ public:
     TransformComponent(float x, float y, float rotation)
         : x(x), y(y), rotation(rotation), scaleX(1.0f), scaleY(1.0f) {}
 
+    TransformComponent()
+        : TransformComponent(0.0f, 0.0f, 0.0f) {}
+
     virtual ComponentTypeID typeID() override 
     {
         return Component::typeID<TransformComponent>();
     }
 
-    virtual void create(std::string resource) override {}
+    virtual void create(StringID resource) override {}
 
 public:
     float x, y;
@@ -19,4 +19,12 @@
    #else
       #define KORIN_API
    #endif
-#endif // KORIN_PLATFORM_MACOSX
\ No newline at end of file
+#endif // KORIN_PLATFORM_MACOSX
+
+#ifdef KORIN_PLATFORM_LINUX
+   #ifdef KORIN_BUILD_SHAREDLIB
+      #define KORIN_API __attribute__((visibility("default")))
+   #else
+      #define KORIN_API
+   #endif
+#endif // KORIN_PLATFORM_LINUX
\ No newline at end of file
@@ -10,11 +10,16 @@
 
 #include <memory>
 #include <cstdint>
-#include <string>
+
+#include "korin/util/string_id.h"
 
 namespace korin
 {
 using EntityID = std::uint32_t;
+
+// An EntityID that never refers to a living Entity
+constexpr EntityID INVALID_ENTITY_ID = UINT32_MAX;
+
 /// Entity is an object with no behavior and whose state
 /// is entirely composed of Components--other than its id.
 struct Entity 
@@ -22,21 +27,19 @@ struct Entity
 friend class EntityAdmin;
 
 public:
-   Entity(const std::string& resourceHandle)
-      : id(Entity::getNextID()), resourceHandle(resourceHandle) 
+   // IDs are handed out by the EntityAdmin of the world the Entity lives in
+   Entity(EntityID id, StringID resourceHandle)
+      : id(id), resourceHandle(resourceHandle)
       {}
 
    EntityID entityID() const { return id; }
-   std::string getResourceHandle() const { return resourceHandle; }
 
-private: 
-   static const EntityID getNextID() noexcept { return m_NextID++; }
+   // Use .str() for the name, which is only there if it was interned
+   StringID getResourceHandle() const { return resourceHandle; }
 
 private:
    EntityID id;
-   std::string resourceHandle;
-
-   static EntityID m_NextID;
+   StringID resourceHandle;
 };
 
 using EntityPtr = std::shared_ptr<Entity>;
@@ -16,22 +16,46 @@
 #include "korin/entity.h"
 #include "korin/component.h"
 #include "korin/system.h"
+#include "korin/system_schedule.h"
 
 namespace korin
 {
+class Prefab;
+
+/// Each EntityAdmin is a separate world with its own entities, components, systems 
+/// and entity IDs, so several can run side by side, each on its own thread. A world 
+/// starts without systems until addDefaultSystems or addSystem is called. Systems 
+/// are registered into phases and ordered within them by a SystemSchedule.
+///
+/// A world isn't thread safe itself and should only be touched by one thread at a 
+/// time. The ComponentRegistry, GameActionUtil and AssetRegistry are shared by every 
+/// world and don't lock. They must be filled before any world starts running on another 
+/// thread and only read after that, since their lookups hand out references into 
+/// tables that a later registration can move.
 class EntityAdmin 
 {
+friend class WorldSnapshot;
+friend class SceneFile;
+
 public:
-   static EntityAdmin& instance()
-   {
-      static EntityAdmin instance;
-      return instance;
-   }
+   EntityAdmin();
+   ~EntityAdmin();
+
    EntityAdmin(const EntityAdmin&) = delete;
 
    EntityAdmin& operator=(const EntityAdmin&) = delete; 
 
-   EntityPtr createEntity(const std::string& resourceHandle);
+   // Literal handles are hashed at compile time, so naming the entity allocates nothing
+   EntityPtr createEntity(StringID resourceHandle);
+
+   // Creates an entity with a known ID, like one from a snapshot or the network.
+   // Fails if the ID is already in use.
+   EntityPtr restoreEntity(EntityID entityID, StringID resourceHandle);
+
+   // Creates count entities with copies of the prefab's components and returns the ID
+   // of the first. Their IDs are contiguous. The components of each type are made in one
+   // allocation and filled in one pass. INVALID_ENTITY_ID if it would pass MAX_ENTITIES.
+   EntityID instantiate(const Prefab& prefab, std::uint32_t count);
 
    // Removes an entity from the admin
    void removeEntity(const EntityPtr entity);
@@ -45,38 +69,71 @@ public:
    // Gets a component relative to an entity from the admin
    ComponentPtr getComponent(EntityID entityID, ComponentTypeID componentTypeID);
 
-   // Adds a system to the admin
-   bool addSystem(const SystemPtr& system);
+   // Same as getComponent but returns null without warning when it isn't there
+   ComponentPtr findComponent(EntityID entityID, ComponentTypeID componentTypeID) const;
+
+   // Removes every entity and component. Systems are kept.
+   void clear();
+
+   const std::unordered_map<EntityID, EntityPtr>& entities() const { return m_Entities; }
+   std::uint32_t entityCount() const { return m_LivingEntityCount; }
+
+   // Components of an entity, empty if it doesn't exist
+   const std::vector<ComponentPtr>& components(EntityID entityID) const;
+
+   // ID the next created entity will get
+   EntityID nextEntityID() const { return m_NextEntityID; }
+
+   // Adds the engine's systems to their phases. Headless worlds, like servers and 
+   // simulations run in tests, don't read the platform's input devices.
+   void addDefaultSystems(bool headless = false);
+
+   // Adds a system to the admin. Without a description it goes in the Simulation 
+   // phase after the systems added before it.
+   bool addSystem(const SystemPtr& system, const SystemDesc& desc = SystemDesc());
 
    // Removes a system from the admin
    void removeSystem(SystemPtr system);
 
-   // Updates the input System
-   void updateInputSystem();
+   // Updates the systems of one phase with the given time step, unless it's disabled
+   void updatePhase(SystemPhase phase, float timeStep);
 
-   // Updates all systems with the given time step
+   // Updates the Input and Simulation phases for one fixed tick
    void updateSystems(float timeStep);
 
-   // Updates the render system
-   void updateRenderSystem();
+   // Updates the LateUpdate and Render phases once per displayed frame
+   void updateFrame(float deltaTime);
+
+   SystemSchedule& schedule() { return m_Schedule; }
+
+   // Tells every system the world was put back to an earlier state
+   void notifyWorldRestored();
+
+   // State of every system in schedule order. Loading is skipped if the systems changed.
+   void saveSystemStates(std::vector<std::vector<std::uint8_t>>& states);
+   void loadSystemStates(const std::vector<std::vector<std::uint8_t>>& states);
+
+   // Tells every system whether the ticks being updated are simulated again after a rollback
+   void setResimulating(bool resimulating);
 
 public:
    static const std::uint32_t MAX_ENTITIES = 5000;
 
 private:
-   EntityAdmin();
-   ~EntityAdmin();
-
-   // Initialize all systems in proper loop order
-   void initSystems();
+   // Adds an entity or component without checking or logging, for bulk 
+   // restores of data that has already been validated
+   void insertEntity(const EntityPtr& entity);
+   void attachComponent(EntityID entityID, const ComponentPtr& component);
+   void setNextEntityID(EntityID entityID) { m_NextEntityID = entityID; }
 
 private:
    std::unordered_map<EntityID, EntityPtr> m_Entities;
-   std::vector<SystemPtr> m_Systems;
+   SystemSchedule m_Schedule;
    std::unordered_map<ComponentTypeID, std::vector<ComponentPtr>> m_ComponentsByType;
    std::unordered_map<EntityID, std::vector<ComponentPtr>> m_ComponentsByEntity;
    
    std::queue<EntityID> m_AvailableEntityIDs;
    std::uint32_t m_LivingEntityCount;
+   EntityID m_NextEntityID;
 };
 }
\ No newline at end of file
@@ -0,0 +1,75 @@
+// action_mask.h
+//
+// Describes the GameAction bits and the ActionMask type every input stream stores them in.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace korin
+{
+// One bit per GameAction. Every action state, binding and recording uses this width.
+using ActionMask = std::uint64_t;
+
+enum class GameAction : ActionMask
+{
+   // Menu
+   Menu = 1ULL << 0,
+   Confirm = 1ULL << 1,
+   Cancel = 1ULL << 2,
+
+   // Movement
+   MoveForward = 1ULL << 3,
+   MoveBackward = 1ULL << 4,
+   MoveRight = 1ULL << 5,
+   MoveLeft = 1ULL << 6,
+   RotateRight = 1ULL << 7,
+   RotateLeft = 1ULL << 8,
+   Crouch = 1ULL << 9,
+   Sprint = 1ULL << 10,
+   Jump = 1ULL << 11,
+
+   // Camera
+   LookUp = 1ULL << 12,
+   LookDown = 1ULL << 13,
+   LookLeft = 1ULL << 14,
+   LookRight = 1ULL << 15,
+
+   // Actions
+   PrimaryAbility = 1ULL << 16,
+   SecondaryAbility = 1ULL << 17,
+   TertiaryAbility = 1ULL << 18,
+   QuaternaryAbility = 1ULL << 19,
+
+   Any = 0xFFFFFF,
+   None = 0
+};
+
+// Bits in an ActionMask, and so the most GameActions there can be
+constexpr std::size_t ACTION_MASK_BITS = 64;
+
+constexpr ActionMask toMask(GameAction action)
+{
+   return static_cast<ActionMask>(action);
+}
+
+constexpr bool hasAction(ActionMask mask, GameAction action)
+{
+   return (mask & toMask(action)) != 0;
+}
+
+/// Finds the actions begun and ended this tick for count streams at once. Every array
+/// must hold count masks. Pressed and released are the actions that went down or up at
+/// any point during the tick, which catches taps shorter than a tick.
+///   begun = (current & ~previous) | pressed
+///   ended = (previous & ~current) | (released & ~current)
+/// Two streams are evaluated per SIMD instruction with a scalar loop for the remainder.
+void computeActionEdges(std::size_t count,
+   const ActionMask* previous, const ActionMask* current,
+   const ActionMask* pressed, const ActionMask* released,
+   ActionMask* begun, ActionMask* ended);
+} // namespace korin
@@ -0,0 +1,76 @@
+// action_state_machine.h
+//
+// Describes the ActionStateMachine class which derives holds, double taps and combos from 
+// the GameAction bitmasks of InputStreamComponents.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+#include "korin/component.h"
+#include "korin/components/input_stream_component.h"
+#include "korin/util/game_action_util.h"
+
+namespace korin
+{
+/// Evaluates every GameAction of an input stream at once with bitwise operations over
+/// the action masks, so a tick costs the same few dozen instructions per stream no 
+/// matter how many actions are held, and nothing is allocated per tick.
+///
+/// Hold and double tap timers are bit-sliced counters stored on the stream, one 8 bit 
+/// counter for each of the 64 action bits. Combos are matched with a shift-and automaton:
+/// every step of every combo is one bit of a 64 bit state, each begun action shifts the
+/// state along and masks it with the steps that action can satisfy.
+class ActionStateMachine
+{
+public:
+   ActionStateMachine();
+
+   // Adds a combo of 2 or more actions pressed in order. Returns its index in 
+   // combosCompleted, or -1 if the steps don't fit. Clamps comboGapTicks to 254.
+   std::int32_t addCombo(std::initializer_list<GameAction> steps);
+   void clearCombos();
+
+   // Updates the holds, double taps and combos of a stream from its begun and current actions
+   void evaluate(InputStreamComponent& inputStream) const;
+
+   // Evaluates every stream in one pass
+   void evaluateBatch(const std::vector<ComponentPtr>& inputStreams) const;
+
+   // Ticks the action has been held, up to 255
+   static std::uint32_t heldTicks(const InputStreamComponent& inputStream, GameAction action);
+
+public:
+   static constexpr std::size_t MAX_COMBO_STEPS = 64;
+   static constexpr std::size_t MAX_COMBOS = 32;
+
+   // Ticks an action must be held to count as held, 1 to 254
+   std::uint32_t holdTicks;
+
+   // Ticks after a press that a second press counts as a double tap, 1 to 254
+   std::uint32_t doubleTapTicks;
+
+   // Ticks without any press before a combo in progress is dropped, 0 to 254
+   std::uint32_t comboGapTicks;
+
+private:
+   // Bit of the combo state where each combo starts and ends
+   std::uint64_t m_ComboStarts;
+   std::uint64_t m_ComboEnds;
+
+   // Combo steps each action bit satisfies
+   std::array<std::uint64_t, ACTION_MASK_BITS> m_StepsByAction;
+
+   // Combo index of each step
+   std::array<std::uint8_t, MAX_COMBO_STEPS> m_ComboOfStep;
+
+   std::uint32_t m_StepCount;
+   std::uint32_t m_ComboCount;
+};
+} // namespace korin
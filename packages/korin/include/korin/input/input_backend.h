@@ -0,0 +1,76 @@
+// input_backend.h
+//
+// Describes the InputBackend class which is the common interface between the platform's
+// input devices and the GameInputSystem.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "korin/input/input_event.h"
+#include "korin/util/spsc_queue.h"
+
+namespace korin
+{
+// Enough for several seconds of mashing at low tick rates
+constexpr std::size_t INPUT_QUEUE_CAPACITY = 1024;
+
+using InputQueue = SPSCQueue<InputEvent, INPUT_QUEUE_CAPACITY>;
+
+/// Backends push timestamped events from the platform's input thread as they happen
+/// and the GameInputSystem drains them once per frame, so nothing pressed between
+/// two frames is missed and the cost per frame follows the number of events.
+class InputBackend
+{
+public:
+   InputBackend()
+      : m_DroppedEventCount(0) {}
+
+   virtual ~InputBackend() = default;
+
+   InputBackend(const InputBackend&) = delete;
+   InputBackend& operator=(const InputBackend&) = delete;
+
+   // Starts delivering events. Returns false if the platform refused access.
+   virtual bool start() = 0;
+   virtual void stop() = 0;
+
+   // Called on the game thread right before the queue is drained each frame. Backends 
+   // without a thread of their own push their events from here.
+   virtual void poll() {}
+
+   // Consumer side. Pops the oldest event.
+   bool pollEvent(InputEvent& event) { return m_Queue.tryPop(event); }
+
+   // Events lost because the consumer fell too far behind
+   std::uint32_t droppedEventCount() const { return m_DroppedEventCount.load(std::memory_order_relaxed); }
+
+   // Creates the backend for the platform being built for, or null if there is none
+   static std::unique_ptr<InputBackend> createPlatformBackend();
+
+   // Microseconds on the steady clock, the time base of every event
+   static std::uint64_t now();
+
+protected:
+   // Producer side. Only one thread may push, either the backend's own thread or 
+   // the game thread from poll().
+   bool pushEvent(const InputEvent& event)
+   {
+      if (!m_Queue.tryPush(event))
+      {
+         m_DroppedEventCount.fetch_add(1, std::memory_order_relaxed);
+         return false;
+      }
+      return true;
+   }
+
+private:
+   InputQueue m_Queue;
+   std::atomic<std::uint32_t> m_DroppedEventCount;
+};
+} // namespace korin
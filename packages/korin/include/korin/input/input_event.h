@@ -0,0 +1,118 @@
+// input_event.h
+//
+// Describes the raw input events that platform backends hand to the GameInputSystem.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace korin
+{
+// Every key and button has a slot in one input code space. Keys use the platform 
+// key code directly, buttons are offset past the largest key code of any platform.
+constexpr std::uint16_t BUTTON_INPUT_CODE_BASE = 768;
+constexpr std::uint16_t INPUT_CODE_COUNT = 1024;
+
+// Axes are tracked separately from the input codes
+constexpr std::uint16_t INPUT_AXIS_COUNT = 8;
+
+/// Pressed state of every input code, one bit per code packed into 64 bit words 
+/// so whole sets of inputs can be masked and walked a word at a time.
+struct InputState
+{
+public:
+   static constexpr std::size_t WORD_COUNT = INPUT_CODE_COUNT / 64;
+
+   InputState()
+      : words() {}
+
+   void set(std::uint16_t code) { words[code >> 6] |= 1ULL << (code & 63); }
+   void reset(std::uint16_t code) { words[code >> 6] &= ~(1ULL << (code & 63)); }
+   void reset() { words.fill(0); }
+   bool test(std::uint16_t code) const { return (words[code >> 6] >> (code & 63)) & 1ULL; }
+
+   bool none() const
+   {
+      std::uint64_t any = 0;
+      for (const std::uint64_t word : words)
+      {
+         any |= word;
+      }
+      return any == 0;
+   }
+
+   static constexpr std::size_t size() { return INPUT_CODE_COUNT; }
+
+   InputState& operator|=(const InputState& other)
+   {
+      for (std::size_t i = 0; i < WORD_COUNT; i++)
+      {
+         words[i] |= other.words[i];
+      }
+      return *this;
+   }
+
+   InputState& operator&=(const InputState& other)
+   {
+      for (std::size_t i = 0; i < WORD_COUNT; i++)
+      {
+         words[i] &= other.words[i];
+      }
+      return *this;
+   }
+
+   InputState operator~() const
+   {
+      InputState result;
+      for (std::size_t i = 0; i < WORD_COUNT; i++)
+      {
+         result.words[i] = ~words[i];
+      }
+      return result;
+   }
+
+   InputState operator&(const InputState& other) const { return InputState(*this) &= other; }
+   bool operator==(const InputState& other) const { return words == other.words; }
+
+public:
+   std::array<std::uint64_t, WORD_COUNT> words;
+};
+
+enum class InputEventType : std::uint8_t
+{
+   KeyDown,
+   KeyUp,
+   ButtonDown,
+   ButtonUp,
+   Axis
+};
+
+struct InputEvent
+{
+   // Microseconds on the steady clock when the backend received the event
+   std::uint64_t timestamp;
+
+   InputEventType type;
+
+   // Platform key code, button index or axis index depending on the type
+   std::uint16_t code;
+
+   // Axis position or delta. Unused by keys and buttons.
+   float value;
+
+   // Slot of a key or button event in the input code space
+   std::uint16_t inputCode() const
+   {
+      return type == InputEventType::ButtonDown || type == InputEventType::ButtonUp
+         ? static_cast<std::uint16_t>(BUTTON_INPUT_CODE_BASE + code) : code;
+   }
+
+   bool isPress() const { return type == InputEventType::KeyDown || type == InputEventType::ButtonDown; }
+   bool isRelease() const { return type == InputEventType::KeyUp || type == InputEventType::ButtonUp; }
+};
+} // namespace korin
@@ -0,0 +1,109 @@
+// input_recording.h
+//
+// Describes the InputRecorder and InputPlayer classes which record the GameAction states 
+// of every InputStreamComponent tick by tick and play them back.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "korin/component.h"
+#include "korin/entity.h"
+#include "korin/input/action_mask.h"
+
+namespace korin
+{
+// Recording layout:
+//    u32 magic, u16 version, u16 reserved, u32 tick count
+//    then for every tick where some stream changed:
+//       varint ticks since the last written tick, varint entry count
+//       per entry: varint EntityID, varint current XOR previous current, varint begun, varint ended
+// Ticks where nothing changed take no space.
+constexpr std::uint32_t INPUT_RECORDING_MAGIC = 0x504E494B; // "KINP"
+constexpr std::uint16_t INPUT_RECORDING_VERSION = 1;
+
+/// Records the action states of the input streams after each tick into a compact
+/// binary buffer. Streams are identified by their EntityID, so a replay has to
+/// create its entities in the same order as the recorded session.
+class InputRecorder
+{
+public:
+   InputRecorder();
+
+   // Clears the recording and starts again from tick 0
+   void begin();
+
+   // Appends the states of the streams for the next tick
+   void recordTick(const std::vector<ComponentPtr>& inputStreams);
+
+   const std::vector<std::uint8_t>& data() const { return m_Data; }
+   std::uint32_t tickCount() const { return m_TickCount; }
+
+   bool saveToFile(const std::string& path) const;
+
+private:
+   struct Entry
+   {
+      EntityID entityID;
+      ActionMask changes;
+      ActionMask begun;
+      ActionMask ended;
+   };
+
+   std::vector<std::uint8_t> m_Data;
+   std::uint32_t m_TickCount;
+   std::uint32_t m_LastWrittenTick;
+
+   // Last recorded current state of each stream, indexed by EntityID
+   std::vector<ActionMask> m_LastStates;
+   std::vector<Entry> m_Entries;
+};
+
+/// Plays a recording back into the input streams one tick at a time.
+class InputPlayer
+{
+public:
+   InputPlayer();
+
+   // Validates the header and rewinds to tick 0. Returns false if the data isn't a recording.
+   bool load(std::vector<std::uint8_t> data);
+   bool loadFromFile(const std::string& path);
+
+   // Writes the states of the next tick into the streams. Returns false once the recording is over.
+   bool playTick(const std::vector<ComponentPtr>& inputStreams);
+
+   bool finished() const { return m_Tick >= m_TickCount; }
+   std::uint32_t tick() const { return m_Tick; }
+   std::uint32_t tickCount() const { return m_TickCount; }
+
+private:
+   // Reads the header of the next block of changes
+   void readBlockHeader();
+
+private:
+   struct State
+   {
+      ActionMask current;
+      ActionMask begun;
+      ActionMask ended;
+   };
+
+   std::vector<std::uint8_t> m_Data;
+   std::size_t m_Position;
+   std::uint32_t m_TickCount;
+   std::uint32_t m_Tick;
+
+   // Tick and size of the next block of changes, or UINT32_MAX when there are none left
+   std::uint32_t m_NextBlockTick;
+   std::uint32_t m_NextBlockEntries;
+
+   // Played back state of each stream for the current tick, indexed by EntityID
+   std::vector<State> m_States;
+   std::vector<EntityID> m_Touched;
+};
+} // namespace korin
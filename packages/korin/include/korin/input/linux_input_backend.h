@@ -0,0 +1,86 @@
+// linux_input_backend.h
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#ifdef KORIN_PLATFORM_LINUX
+
+#include <array>
+#include <bitset>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "korin/input/input_backend.h"
+
+namespace korin
+{
+/// Reads keyboards, mice and gamepads through evdev on its own thread and pushes their
+/// events into the input queue. Key codes are the evdev KEY_* codes. Mouse buttons go
+/// out as buttons 0 to 2, relative motion on axes 0 and 1 and absolute sticks on axes
+/// 2 to 5 in the range -1 to 1. Reading /dev/input needs the user to be in the input group.
+class LinuxInputBackend : public InputBackend
+{
+public:
+   // Opens every input device that has keys or relative axes
+   LinuxInputBackend();
+
+   // Opens only the given device paths, e.g. /dev/input/by-id/...-event-kbd
+   explicit LinuxInputBackend(std::vector<std::string> devicePaths);
+
+   virtual ~LinuxInputBackend() override;
+
+   // Returns false if no device could be opened
+   virtual bool start() override;
+   virtual void stop() override;
+
+   std::size_t deviceCount() const { return m_Devices.size(); }
+
+private:
+   struct AbsoluteAxis
+   {
+      std::int32_t minimum;
+      std::int32_t maximum;
+   };
+
+   struct Device
+   {
+      int fileDescriptor;
+      std::string path;
+
+      // The kernel timestamps events on the steady clock when it accepts CLOCK_MONOTONIC
+      bool monotonicTimestamps;
+
+      // Keys we have reported as held, to resynchronize after the kernel drops events
+      std::bitset<BUTTON_INPUT_CODE_BASE> keysDown;
+      bool dropping;
+
+      std::array<AbsoluteAxis, 4> absoluteAxes;
+   };
+
+   bool openDevice(const std::string& path);
+   void closeDevices();
+   void readLoop();
+   void readDevice(Device& device);
+
+   // Reports the difference between what we think is held and what the kernel says is held
+   void resynchronize(Device& device);
+
+   // Reports every key we think is held as released, for devices that went away
+   void releaseKeys(Device& device);
+
+   void pushKey(Device& device, std::uint16_t code, bool down, std::uint64_t timestamp);
+
+private:
+   std::vector<std::string> m_DevicePaths;
+   std::vector<Device> m_Devices;
+   std::thread m_Thread;
+
+   // Written to by stop() to wake the read loop
+   int m_WakeFileDescriptor;
+};
+} // namespace korin
+
+#endif // KORIN_PLATFORM_LINUX
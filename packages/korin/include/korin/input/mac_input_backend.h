@@ -0,0 +1,50 @@
+// mac_input_backend.h
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#ifdef KORIN_PLATFORM_MACOSX
+
+#include <atomic>
+#include <bitset>
+#include <thread>
+
+#include "korin/input/input_backend.h"
+
+namespace korin
+{
+/// Listens to keyboard and mouse events with a listen-only CGEventTap on its own run
+/// loop thread and pushes them into the input queue as they arrive.
+class MacInputBackend : public InputBackend
+{
+public:
+   MacInputBackend();
+   virtual ~MacInputBackend() override;
+
+   virtual bool start() override;
+   virtual void stop() override;
+
+   // Entry point of the event tap, forwards to the backend passed as user info
+   static void* tapCallback(void* proxy, std::uint32_t type, void* event, void* userInfo);
+
+private:
+   void runLoop();
+
+   // Called on the run loop thread for every tapped event
+   void handleEvent(std::uint32_t type, void* event);
+
+private:
+   std::thread m_Thread;
+
+   // CFMachPortRef and CFRunLoopRef, kept opaque so Carbon stays out of the header
+   void* m_EventTap;
+   std::atomic<void*> m_RunLoop;
+
+   // Modifier keys only report that the flags changed, so their state is tracked here
+   std::bitset<128> m_ModifiersDown;
+};
+} // namespace korin
+
+#endif // KORIN_PLATFORM_MACOSX
@@ -0,0 +1,85 @@
+// scripted_input_backend.h
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "korin/input/input_backend.h"
+
+namespace korin
+{
+/// Synthetic input for headless runs, tests and load tests. Events are scheduled on frame
+/// numbers and pushed from poll(), so they arrive at the same tick on every run no matter
+/// how fast the simulation goes. Works on every platform and needs no devices.
+///
+/// Events scheduled for a frame that already passed are skipped until the next rewind.
+///
+/// Scripts are plain text, one event per line, blank lines and # comments ignored:
+///    <frame> down <key code>
+///    <frame> up <key code>
+///    <frame> tap <key code>             down and up within the same frame
+///    <frame> button_down <button>
+///    <frame> button_up <button>
+///    <frame> axis <axis> <value>
+///    <frame> end                        length of the script when looping
+/// Key codes go below BUTTON_INPUT_CODE_BASE and buttons below the codes left after it.
+class ScriptedInputBackend : public InputBackend
+{
+public:
+   ScriptedInputBackend();
+
+   virtual bool start() override { return true; }
+   virtual void stop() override {}
+
+   // Pushes every event scheduled for the current frame and moves on to the next frame
+   virtual void poll() override;
+
+   void schedule(std::uint32_t frame, InputEventType type, std::uint16_t code, float value = 0.0f);
+   void press(std::uint32_t frame, std::uint16_t keyCode) { schedule(frame, InputEventType::KeyDown, keyCode); }
+   void release(std::uint32_t frame, std::uint16_t keyCode) { schedule(frame, InputEventType::KeyUp, keyCode); }
+   void tap(std::uint32_t frame, std::uint16_t keyCode);
+   void moveAxis(std::uint32_t frame, std::uint16_t axis, float value) { schedule(frame, InputEventType::Axis, axis, value); }
+
+   // Adds the events of a script. Returns false and adds nothing if a line can't be read.
+   bool loadScript(const std::string& script);
+   bool loadScriptFile(const std::string& path);
+
+   // Removes every event and rewinds
+   void clear();
+
+   // Starts again from frame 0
+   void rewind() { m_Frame = 0; m_NextEvent = 0; }
+
+   // Looping scripts start over after their last frame, for soak and load tests
+   void setLooping(bool looping) { m_Looping = looping; }
+
+   std::uint32_t frame() const { return m_Frame; }
+
+   // Frames until the script ends or loops
+   std::uint32_t length() const;
+   bool finished() const { return !m_Looping && m_Frame >= length(); }
+
+private:
+   struct ScriptedEvent
+   {
+      std::uint32_t frame;
+      InputEventType type;
+      std::uint16_t code;
+      float value;
+   };
+
+   std::vector<ScriptedEvent> m_Events;
+   bool m_Sorted;
+   std::size_t m_NextEvent;
+   std::uint32_t m_Frame;
+
+   // Length given by an end line, otherwise one past the last event
+   std::uint32_t m_Length;
+   bool m_Looping;
+};
+} // namespace korin
@@ -5,25 +5,47 @@
 
 #pragma once
 
+#include <atomic>
 #include <iostream>
+#include <chrono>
+#include <cstdint>
 
 namespace korin
 {
+class EntityAdmin;
+class RollbackSession;
+
+/// Runs the input, simulation and render updates of one world. A process hosting 
+/// several worlds runs a loop for each, typically one per thread.
 class KorinLoop
 {
 public:
-   KorinLoop()
-      : FRAME_TIME(1.0f / 60.0f), lastTime(std::chrono::high_resolution_clock::now())
-      , variableTickDeltaTime(0.0f), fixedTickLag(0.0f)
+   explicit KorinLoop(EntityAdmin& world)
+      : world(world), FRAME_TIME(1.0f / 60.0f), lastTime(std::chrono::steady_clock::now())
+      , variableTickDeltaTime(0.0f), fixedTickLag(0.0f), rollbackSession(nullptr), running(true)
       {}
 
    ~KorinLoop() = default;
 
+   // Ticks until stop is called, which may come from another thread
    void run();
+   void stop() { running = false; }
+
    void tickFixed();
    void tickVariable();
+
+   // Steps the fixed time step simulation as fast as possible without waiting on 
+   // the real world clock. Used to replay recorded input and for profiling.
+   void runFixedTicks(std::uint32_t tickCount);
+
+   // Runs every fixed tick through the session so late remote input can roll the 
+   // simulation back. Null goes back to updating the systems directly.
+   void setRollbackSession(RollbackSession* session) { rollbackSession = session; }
    
 private:
+   // The world this loop updates
+   EntityAdmin& world;
+
    // Time in seconds that each frame should take
    // TODO: This should be a setting that the user can choose
    const float FRAME_TIME;
@@ -39,5 +61,13 @@ private:
    // How far behind the game is from the real world
    // Used only in the fixed time step tick
    float fixedTickLag;
+
+   // Owner of the fixed ticks in rollback mode
+   RollbackSession* rollbackSession;
+
+   std::atomic<bool> running;
+
+private:
+   void simulateFixedTick();
 };
 }
\ No newline at end of file
@@ -33,8 +33,12 @@ public:
 
    float size() const;
 
+   float perimeter() const;
+
    bool contains(const Vector2D& point) const;
 
+   bool contains(const AABB& other) const;
+
    bool intersects(const AABB& other) const;
 
    bool operator==(const AABB& other) const;
@@ -42,6 +46,10 @@ public:
    bool operator!=(const AABB& other) const;
 
    void expandToInclude(const Vector2D& point);
+
+   AABB expanded(float margin) const;
+
+   static AABB combine(const AABB& a, const AABB& b);
 };
 } // namespace korin
 
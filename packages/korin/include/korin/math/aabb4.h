@@ -0,0 +1,162 @@
+// aabb4.h
+//
+// This file contains the AABB4 struct, which packs four axis-aligned bounding boxes in
+// structure-of-arrays form so they can be tested against a box or a ray in one SIMD operation.
+//
+// Copyright Zachary Duncan 10/19/2026
+
+#ifndef KORIN_AABB4_H
+#define KORIN_AABB4_H
+
+#include <cstdint>
+#include <limits>
+
+#include "korin/math/aabb.h"
+#include "korin/math/vector2d.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+   #include <emmintrin.h>
+   #define KORIN_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+   #include <arm_neon.h>
+   #define KORIN_SIMD_NEON
+#endif
+
+namespace korin
+{
+/// @struct AABB4
+/// @brief Four AABBs laid out lane by lane. Unused lanes hold an empty box that overlaps nothing.
+///
+struct alignas(16) AABB4
+{
+   float minX[4];
+   float minY[4];
+   float maxX[4];
+   float maxY[4];
+
+   AABB4() { clear(); }
+
+   /// @brief Resets every lane to an empty box.
+   ///
+   void clear()
+   {
+      for (int lane = 0; lane < 4; lane++)
+      {
+         minX[lane] = std::numeric_limits<float>::max();
+         minY[lane] = std::numeric_limits<float>::max();
+         maxX[lane] = -std::numeric_limits<float>::max();
+         maxY[lane] = -std::numeric_limits<float>::max();
+      }
+   }
+
+   /// @brief Stores a box in one of the four lanes.
+   ///
+   void set(int lane, const AABB& box)
+   {
+      minX[lane] = box.minX;
+      minY[lane] = box.minY;
+      maxX[lane] = box.maxX;
+      maxY[lane] = box.maxY;
+   }
+};
+
+/// @brief Tests all four lanes against a box.
+/// @return A 4 bit mask with bit n set when lane n intersects the box.
+///
+inline std::uint32_t overlapMask(const AABB4& boxes, const AABB& box)
+{
+#if defined(KORIN_SIMD_SSE2)
+   const __m128 minXOk = _mm_cmple_ps(_mm_load_ps(boxes.minX), _mm_set1_ps(box.maxX));
+   const __m128 minYOk = _mm_cmple_ps(_mm_load_ps(boxes.minY), _mm_set1_ps(box.maxY));
+   const __m128 maxXOk = _mm_cmpge_ps(_mm_load_ps(boxes.maxX), _mm_set1_ps(box.minX));
+   const __m128 maxYOk = _mm_cmpge_ps(_mm_load_ps(boxes.maxY), _mm_set1_ps(box.minY));
+   const __m128 overlap = _mm_and_ps(_mm_and_ps(minXOk, minYOk), _mm_and_ps(maxXOk, maxYOk));
+   return static_cast<std::uint32_t>(_mm_movemask_ps(overlap));
+
+#elif defined(KORIN_SIMD_NEON)
+   const uint32x4_t minXOk = vcleq_f32(vld1q_f32(boxes.minX), vdupq_n_f32(box.maxX));
+   const uint32x4_t minYOk = vcleq_f32(vld1q_f32(boxes.minY), vdupq_n_f32(box.maxY));
+   const uint32x4_t maxXOk = vcgeq_f32(vld1q_f32(boxes.maxX), vdupq_n_f32(box.minX));
+   const uint32x4_t maxYOk = vcgeq_f32(vld1q_f32(boxes.maxY), vdupq_n_f32(box.minY));
+   const uint32x4_t overlap = vandq_u32(vandq_u32(minXOk, minYOk), vandq_u32(maxXOk, maxYOk));
+   const uint32_t laneBits[4] = {1, 2, 4, 8};
+   return vaddvq_u32(vandq_u32(overlap, vld1q_u32(laneBits)));
+
+#else
+   std::uint32_t mask = 0;
+   for (int lane = 0; lane < 4; lane++)
+   {
+      const bool overlap = boxes.minX[lane] <= box.maxX && boxes.maxX[lane] >= box.minX
+         && boxes.minY[lane] <= box.maxY && boxes.maxY[lane] >= box.minY;
+      mask |= static_cast<std::uint32_t>(overlap) << lane;
+   }
+   return mask;
+#endif
+}
+
+/// @brief Slab tests a ray segment against all four lanes.
+/// @param origin The start of the ray.
+/// @param inverseDirection One over the (end - start) of the ray per axis.
+/// @param maxFraction Only hits closer than this fraction of the segment are reported.
+/// @return A 4 bit mask with bit n set when the segment enters lane n.
+///
+inline std::uint32_t raycastMask(const AABB4& boxes, const Vector2D& origin, const Vector2D& inverseDirection, float maxFraction)
+{
+#if defined(KORIN_SIMD_SSE2)
+   const __m128 originX = _mm_set1_ps(origin.x);
+   const __m128 originY = _mm_set1_ps(origin.y);
+   const __m128 inverseX = _mm_set1_ps(inverseDirection.x);
+   const __m128 inverseY = _mm_set1_ps(inverseDirection.y);
+
+   const __m128 nearX = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(boxes.minX), originX), inverseX);
+   const __m128 farX = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(boxes.maxX), originX), inverseX);
+   const __m128 nearY = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(boxes.minY), originY), inverseY);
+   const __m128 farY = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(boxes.maxY), originY), inverseY);
+
+   const __m128 entry = _mm_max_ps(_mm_max_ps(_mm_min_ps(nearX, farX), _mm_min_ps(nearY, farY)), _mm_setzero_ps());
+   const __m128 exit = _mm_min_ps(_mm_min_ps(_mm_max_ps(nearX, farX), _mm_max_ps(nearY, farY)), _mm_set1_ps(maxFraction));
+   return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_cmple_ps(entry, exit)));
+
+#elif defined(KORIN_SIMD_NEON)
+   const float32x4_t originX = vdupq_n_f32(origin.x);
+   const float32x4_t originY = vdupq_n_f32(origin.y);
+   const float32x4_t inverseX = vdupq_n_f32(inverseDirection.x);
+   const float32x4_t inverseY = vdupq_n_f32(inverseDirection.y);
+
+   const float32x4_t nearX = vmulq_f32(vsubq_f32(vld1q_f32(boxes.minX), originX), inverseX);
+   const float32x4_t farX = vmulq_f32(vsubq_f32(vld1q_f32(boxes.maxX), originX), inverseX);
+   const float32x4_t nearY = vmulq_f32(vsubq_f32(vld1q_f32(boxes.minY), originY), inverseY);
+   const float32x4_t farY = vmulq_f32(vsubq_f32(vld1q_f32(boxes.maxY), originY), inverseY);
+
+   const float32x4_t entry = vmaxq_f32(vmaxq_f32(vminq_f32(nearX, farX), vminq_f32(nearY, farY)), vdupq_n_f32(0.0f));
+   const float32x4_t exit = vminq_f32(vminq_f32(vmaxq_f32(nearX, farX), vmaxq_f32(nearY, farY)), vdupq_n_f32(maxFraction));
+   const uint32_t laneBits[4] = {1, 2, 4, 8};
+   return vaddvq_u32(vandq_u32(vcleq_f32(entry, exit), vld1q_u32(laneBits)));
+
+#else
+   std::uint32_t mask = 0;
+   for (int lane = 0; lane < 4; lane++)
+   {
+      const float nearX = (boxes.minX[lane] - origin.x) * inverseDirection.x;
+      const float farX = (boxes.maxX[lane] - origin.x) * inverseDirection.x;
+      const float nearY = (boxes.minY[lane] - origin.y) * inverseDirection.y;
+      const float farY = (boxes.maxY[lane] - origin.y) * inverseDirection.y;
+
+      float entry = nearX < farX ? nearX : farX;
+      const float entryY = nearY < farY ? nearY : farY;
+      entry = entry > entryY ? entry : entryY;
+      entry = entry > 0.0f ? entry : 0.0f;
+
+      float exit = nearX > farX ? nearX : farX;
+      const float exitY = nearY > farY ? nearY : farY;
+      exit = exit < exitY ? exit : exitY;
+      exit = exit < maxFraction ? exit : maxFraction;
+
+      mask |= static_cast<std::uint32_t>(entry <= exit) << lane;
+   }
+   return mask;
+#endif
+}
+} // namespace korin
+
+#endif // KORIN_AABB4_H
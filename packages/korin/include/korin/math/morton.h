@@ -0,0 +1,70 @@
+// morton.h
+//
+// This file contains helpers for encoding 2D cell coordinates as Morton (Z-order) codes so that
+// cells which are close together in space are also close together in memory and in sort order.
+//
+// Copyright Zachary Duncan 10/19/2026
+
+#ifndef KORIN_MORTON_H
+#define KORIN_MORTON_H
+
+#include <cstdint>
+
+namespace korin
+{
+using MortonCode = std::uint32_t;
+
+/// @brief Spreads the lower 16 bits of a value so that there is a zero bit between each of them.
+/// @param value The value to spread.
+/// @return The spread value.
+///
+inline std::uint32_t mortonSpreadBits(std::uint32_t value)
+{
+   value &= 0x0000FFFF;
+   value = (value | (value << 8)) & 0x00FF00FF;
+   value = (value | (value << 4)) & 0x0F0F0F0F;
+   value = (value | (value << 2)) & 0x33333333;
+   value = (value | (value << 1)) & 0x55555555;
+   return value;
+}
+
+/// @brief Compacts every other bit of a value back into the lower 16 bits. Inverse of mortonSpreadBits.
+/// @param value The value to compact.
+/// @return The compacted value.
+///
+inline std::uint32_t mortonCompactBits(std::uint32_t value)
+{
+   value &= 0x55555555;
+   value = (value | (value >> 1)) & 0x33333333;
+   value = (value | (value >> 2)) & 0x0F0F0F0F;
+   value = (value | (value >> 4)) & 0x00FF00FF;
+   value = (value | (value >> 8)) & 0x0000FFFF;
+   return value;
+}
+
+/// @brief Interleaves two 16 bit coordinates into a single Morton code.
+/// @param x The x coordinate.
+/// @param y The y coordinate.
+/// @return The Morton code with x in the even bits and y in the odd bits.
+///
+inline MortonCode mortonEncode(std::uint16_t x, std::uint16_t y)
+{
+   return mortonSpreadBits(x) | (mortonSpreadBits(y) << 1);
+}
+
+/// @brief Extracts the x coordinate from a Morton code.
+///
+inline std::uint16_t mortonDecodeX(MortonCode code)
+{
+   return static_cast<std::uint16_t>(mortonCompactBits(code));
+}
+
+/// @brief Extracts the y coordinate from a Morton code.
+///
+inline std::uint16_t mortonDecodeY(MortonCode code)
+{
+   return static_cast<std::uint16_t>(mortonCompactBits(code >> 1));
+}
+} // namespace korin
+
+#endif // KORIN_MORTON_H
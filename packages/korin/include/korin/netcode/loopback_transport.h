@@ -0,0 +1,65 @@
+// loopback_transport.h
+//
+// Describes the LoopbackTransport class which connects two peers in the same process
+// with simulated latency and packet loss.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "korin/netcode/transport.h"
+
+namespace korin
+{
+/// One end of an in-process connection, for tests and for running several peers on one
+/// machine. Time only passes when step is called, so latency is counted in steps and
+/// runs are deterministic. Not thread safe: both ends have to be used from one thread.
+class LoopbackTransport : public Transport
+{
+public:
+   // Two connected ends. A packet sent on one can be received on the other after it
+   // has stepped latencySteps times.
+   static std::pair<std::unique_ptr<LoopbackTransport>, std::unique_ptr<LoopbackTransport>> createPair(std::uint32_t latencySteps = 0);
+
+   virtual void send(const std::vector<std::uint8_t>& packet) override;
+   virtual bool receive(std::vector<std::uint8_t>& packet) override;
+
+   // Moves the packets heading to this end one step closer to arriving
+   void step();
+
+   // Latency of the packets sent from this end from now on
+   void setLatency(std::uint32_t latencySteps) { m_LatencySteps = latencySteps; }
+
+   // Drops every nth packet sent from this end. 0 drops nothing.
+   void setDropEvery(std::uint32_t nth) { m_DropEvery = nth; }
+
+   std::uint64_t packetsSent() const { return m_PacketsSent; }
+   std::uint64_t bytesSent() const { return m_BytesSent; }
+
+private:
+   struct Packet
+   {
+      std::uint32_t stepsLeft;
+      std::vector<std::uint8_t> data;
+   };
+
+   using Channel = std::deque<Packet>;
+
+   LoopbackTransport(std::shared_ptr<Channel> incoming, std::shared_ptr<Channel> outgoing, std::uint32_t latencySteps);
+
+private:
+   std::shared_ptr<Channel> m_Incoming;
+   std::shared_ptr<Channel> m_Outgoing;
+   std::uint32_t m_LatencySteps;
+   std::uint32_t m_DropEvery;
+   std::uint64_t m_PacketsSent;
+   std::uint64_t m_BytesSent;
+};
+} // namespace korin
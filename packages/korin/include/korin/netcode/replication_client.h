@@ -0,0 +1,83 @@
+// replication_client.h
+//
+// Describes the ReplicationClient class which rebuilds the world state sent by a
+// ReplicationServer and applies it to the local world.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "korin/netcode/replication_schema.h"
+
+namespace korin
+{
+class EntityAdmin;
+class Transport;
+class BitReader;
+
+/// Keeps the last historyTicks states it received, since the server sends deltas
+/// against whichever one it last heard an acknowledgement for. Every state that is
+/// rebuilt is acknowledged right away. States older than the newest one are dropped.
+class ReplicationClient
+{
+public:
+   ReplicationClient(const ReplicationSchema& schema, std::uint32_t historyTicks = 32);
+
+   void setTransport(Transport* transport) { m_Transport = transport; }
+
+   // Rebuilds and acknowledges every state that arrived. Returns true if there's a newer one.
+   bool receive();
+
+   // Creates, updates and removes entities so the replicated ones match the newest state.
+   // Entities the client didn't create are only touched if the server sends the same IDs.
+   void apply(EntityAdmin& admin);
+
+   // Null until the first state arrives
+   const ReplicatedState* latestState() const;
+
+   // Packets that were malformed, out of date or against a baseline that's gone
+   std::uint64_t droppedPackets() const { return m_DroppedPackets; }
+
+private:
+   const ReplicatedState* stateAt(std::uint32_t tick) const;
+
+   // Rebuilds the state in m_Packet into m_Decoded
+   bool readDelta();
+
+   // Reads the changed fields of an entity on top of its baseline rows
+   bool readEntity(BitReader& reader, const ReplicatedState* baseline, std::uint32_t baselineIndex, EntityID entityID);
+
+   // Appends the baseline entities before the ID that weren't removed
+   void copyBaseline(const ReplicatedState& baseline, EntityID beforeID);
+
+private:
+   ReplicationSchema m_Schema;
+   std::uint32_t m_SchemaHash;
+   Transport* m_Transport;
+
+   std::vector<ReplicatedState> m_History;
+   std::uint32_t m_LatestTick;
+   std::uint64_t m_DroppedPackets;
+
+   // Resource handles of replicated entities, sent once when they're new
+   std::unordered_map<EntityID, StringID> m_ResourceHandles;
+
+   // Entities and type masks the last apply left in the world, sorted by ID
+   std::vector<EntityID> m_AppliedIDs;
+   std::vector<std::uint32_t> m_AppliedMasks;
+
+   // Reused between packets
+   std::vector<std::uint8_t> m_Packet;
+   ReplicatedState m_Decoded;
+   std::vector<EntityID> m_Removed;
+   std::size_t m_BaselineCursor;
+   std::size_t m_RemovedCursor;
+   std::vector<std::uint8_t> m_ZeroRow;
+};
+} // namespace korin
@@ -0,0 +1,114 @@
+// replication_schema.h
+//
+// Describes the ReplicationSchema class which decides which components are sent to
+// clients and how their fields are encoded, and the ReplicatedState it captures.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "korin/entity.h"
+#include "korin/component.h"
+
+namespace korin
+{
+class EntityAdmin;
+
+/// The replicated components of every replicated entity at one tick. Entities are
+/// sorted by ID and their rows are packed back to back in schema type order.
+struct ReplicatedState
+{
+   void clear()
+   {
+      entityIDs.clear();
+      typeMasks.clear();
+      rowOffsets.clear();
+      rows.clear();
+   }
+
+   std::size_t entityCount() const { return entityIDs.size(); }
+
+   std::uint32_t tick;
+   std::vector<EntityID> entityIDs;
+
+   // Bit per schema type the entity has
+   std::vector<std::uint32_t> typeMasks;
+
+   // Start of each entity's rows, with the end of the last one at the back
+   std::vector<std::uint32_t> rowOffsets;
+   std::vector<std::uint8_t> rows;
+};
+
+struct ReplicatedField
+{
+   std::uint16_t offset;
+   std::uint16_t size;
+
+   // Quantized fields are 32 bit integers sent as the difference from the baseline.
+   // Every other field is sent as it is when it changes.
+   bool quantized;
+};
+
+struct ReplicatedType
+{
+   ComponentTypeID typeID;
+
+   // Index in the ComponentRegistry
+   std::uint32_t registryIndex;
+
+   std::vector<ReplicatedField> fields;
+   std::uint32_t rowSize;
+
+   // TransformComponent rows hold quantized fields instead of the registry's floats
+   bool quantizedTransform;
+};
+
+/// The server and its clients have to use the same schema, which they check by
+/// comparing hashes. TransformComponent positions are rounded to positionStep,
+/// scales to scaleStep and rotations to 1/65536th of a turn, so the numbers that
+/// change every tick turn into small integer deltas. Every other component is
+/// replicated with the fields it registered with the ComponentRegistry.
+class ReplicationSchema
+{
+public:
+   // Replicates the Transform, Physics, Bounds and Collider components
+   ReplicationSchema();
+
+   // Fails if the type isn't in the ComponentRegistry or the schema is full
+   bool addType(ComponentTypeID typeID);
+
+   void clearTypes() { m_Types.clear(); m_IndexByTypeID.clear(); }
+
+   const std::vector<ReplicatedType>& types() const { return m_Types; }
+
+   std::uint32_t hash() const;
+
+   // Captures every entity that has at least one replicated component
+   void capture(const EntityAdmin& admin, std::uint32_t tick, ReplicatedState& state) const;
+
+   // Writes a row captured for the type back into a component
+   void unpackRow(std::size_t typeIndex, const std::uint8_t* row, Component& component) const;
+
+   // Where the row of a type the entity has starts in the state's rows
+   std::uint32_t rowOffset(const ReplicatedState& state, std::size_t entityIndex, std::size_t typeIndex) const;
+
+public:
+   static const std::uint32_t MAX_TYPES = 32;
+
+   float positionStep;
+   float scaleStep;
+
+private:
+   void packRow(std::size_t typeIndex, Component& component, std::uint8_t* row) const;
+
+private:
+   std::vector<ReplicatedType> m_Types;
+
+   // Index into m_Types of each ComponentTypeID, or -1
+   std::vector<std::int32_t> m_IndexByTypeID;
+};
+} // namespace korin
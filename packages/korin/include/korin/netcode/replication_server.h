@@ -0,0 +1,116 @@
+// replication_server.h
+//
+// Describes the ReplicationServer class which sends each client the changes to the
+// replicated world state since the last state that client acknowledged.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "korin/netcode/replication_schema.h"
+
+namespace korin
+{
+class EntityAdmin;
+class Transport;
+class BitWriter;
+
+// State packet layout, bit packed after the first byte:
+//    u8 message type, 32 bit schema hash, 32 bit tick, 1 bit has baseline, [32 bit baseline tick],
+//    16 bit removed count, 16 bit changed count, removed IDs, changed entities
+// Entity IDs are sent as the difference from the previous ID in the list. A changed entity
+// is its ID, whether it's new, the resource handle of new entities, its type mask if that
+// changed, then a changed bit per field of each of its rows followed by the field if set.
+constexpr std::uint8_t REPLICATION_STATE_MESSAGE = 2;
+
+// Acknowledgement packet layout:
+//    u8 message type, varint tick
+constexpr std::uint8_t REPLICATION_ACK_MESSAGE = 3;
+
+struct ReplicationStats
+{
+   std::uint64_t packetsSent;
+   std::uint64_t bytesSent;
+
+   // Packets sent without a baseline because the client hadn't acknowledged a state
+   // that is still in the history
+   std::uint64_t fullUpdates;
+
+   // Entities written to the packets of the most recent update, over all clients
+   std::uint32_t lastChangedEntities;
+   std::uint32_t lastBytesSent;
+};
+
+/// Every update captures the world once into a ring of the last historyTicks states.
+/// Each client is then sent a delta against the newest state it acknowledged, which
+/// leaves out every entity and field that didn't change since then. A lost packet
+/// only costs bandwidth: the next delta is taken against the same older baseline
+/// until a newer one is acknowledged.
+class ReplicationServer
+{
+public:
+   ReplicationServer(const EntityAdmin& admin, const ReplicationSchema& schema, std::uint32_t historyTicks = 32);
+
+   // Returns the index the client is referred to by
+   std::uint32_t addClient(Transport* transport);
+   void removeClient(std::uint32_t client);
+
+   // Receives acknowledgements, captures the world and sends every client its delta
+   void update();
+
+   // Ticks captured so far, which is also the number of the next tick
+   std::uint32_t currentTick() const { return m_CurrentTick; }
+
+   // Newest tick the client acknowledged, or UINT32_MAX if none yet
+   std::uint32_t acknowledgedTick(std::uint32_t client) const;
+
+   const ReplicationStats& stats() const { return m_Stats; }
+
+private:
+   struct Client
+   {
+      Transport* transport;
+      std::uint32_t acknowledgedTick;
+   };
+
+   struct ChangedEntity
+   {
+      std::uint32_t index;
+
+      // Index of the entity in the baseline, or UINT32_MAX if it's new
+      std::uint32_t baselineIndex;
+   };
+
+   // Null if the tick has fallen out of the history
+   const ReplicatedState* stateAt(std::uint32_t tick) const;
+
+   void receiveAcknowledgements(Client& client);
+
+   // Fills m_Packet with the changes from the baseline, or everything if there's none
+   void writeDelta(const ReplicatedState* baseline, const ReplicatedState& current);
+   void writeEntity(BitWriter& writer, const ReplicatedState* baseline, const ReplicatedState& current,
+      const ChangedEntity& changed);
+
+private:
+   const EntityAdmin& m_Admin;
+   ReplicationSchema m_Schema;
+   std::uint32_t m_SchemaHash;
+   std::uint32_t m_CurrentTick;
+
+   std::vector<ReplicatedState> m_History;
+   std::vector<Client> m_Clients;
+   ReplicationStats m_Stats;
+
+   // Reused for every client so updates don't allocate once they've warmed up
+   std::vector<std::uint8_t> m_Packet;
+   std::vector<EntityID> m_Removed;
+   std::vector<ChangedEntity> m_Changed;
+
+   // Baseline of components an entity didn't have before
+   std::vector<std::uint8_t> m_ZeroRow;
+};
+} // namespace korin
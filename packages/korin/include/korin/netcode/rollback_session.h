@@ -0,0 +1,160 @@
+// rollback_session.h
+//
+// Describes the RollbackSession class which runs the fixed tick simulation ahead of
+// remote input and rewinds and resimulates when a prediction turns out wrong.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "korin/entity.h"
+#include "korin/input/action_mask.h"
+#include "korin/serialization/world_snapshot.h"
+
+namespace korin
+{
+class EntityAdmin;
+class Transport;
+
+struct RollbackStats
+{
+   // Times a late input contradicted a prediction
+   std::uint64_t rollbacks;
+
+   // Ticks simulated again because of rollbacks
+   std::uint64_t resimulatedTicks;
+
+   // Remote inputs older than the snapshot history, which can't be applied anymore
+   std::uint64_t droppedInputs;
+
+   // Ticks and seconds of the most recent rollback, including restoring the snapshot
+   std::uint32_t lastResimulatedTicks;
+   float lastResimulationSeconds;
+   float maxResimulationSeconds;
+};
+
+// Input packet layout:
+//    u8 message type, u8 player, varint first tick, u8 input count, varint ActionMask per tick
+constexpr std::uint8_t ROLLBACK_INPUT_MESSAGE = 1;
+
+/// Each player's InputStreamComponent is driven through its externalActionStates. Local
+/// input is applied right away and sent to the other peer. Remote input that hasn't
+/// arrived yet is predicted to repeat the last input received from that player.
+///
+/// A snapshot of the world is kept for each of the last maxRollbackTicks ticks. When a
+/// remote input arrives for a tick that was simulated with a different prediction, the
+/// next advance restores the snapshot of that tick and simulates every tick since then
+/// again, all within the same frame.
+///
+/// Resimulation is only exact if every system derives its state from the components in
+/// the snapshot, or saves the rest with System::saveState, which is kept with each frame.
+class RollbackSession
+{
+public:
+   RollbackSession(EntityAdmin& admin, std::uint32_t maxRollbackTicks = 8);
+
+   // Adds a player whose input drives the InputStreamComponent of the entity. The
+   // stream is switched to External input. Players are numbered the same on every peer.
+   bool addPlayer(std::uint8_t player, EntityID entityID, bool local);
+
+   // Local input is sent over the transport every tick and remote input is received from it
+   void setTransport(Transport* transport) { m_Transport = transport; }
+
+   // Input of a local player for the next tick
+   void setLocalInput(std::uint8_t player, ActionMask actions);
+
+   // Input of a remote player for a tick. Returns false if the tick is too old to roll back to.
+   bool addRemoteInput(std::uint8_t player, std::uint32_t tick, ActionMask actions);
+
+   // Receives remote input, rolls back and resimulates if needed, simulates the next
+   // tick and sends the local input
+   void advance(float timeStep);
+
+   // Ticks simulated so far, which is also the number of the next tick
+   std::uint32_t currentTick() const { return m_CurrentTick; }
+
+   // Every tick before this one was simulated with confirmed input from all players
+   std::uint32_t confirmedTick() const;
+
+   const RollbackStats& stats() const { return m_Stats; }
+   std::uint32_t maxRollbackTicks() const { return m_MaxRollbackTicks; }
+
+   // Appends an input message to the packet
+   static void writeInputMessage(std::vector<std::uint8_t>& packet, std::uint8_t player,
+      std::uint32_t firstTick, const ActionMask* inputs, std::uint8_t count);
+
+public:
+   // Ticks of past local input repeated in every packet so a lost packet doesn't stall the other peer
+   std::uint8_t inputRedundancy;
+
+private:
+   struct InputSlot
+   {
+      std::uint32_t tick;
+      ActionMask actions;
+
+      // Whether actions is the real input for the tick rather than nothing
+      bool known;
+
+      // Whether the tick has been simulated, and with which input
+      bool simulated;
+      ActionMask used;
+   };
+
+   struct Player
+   {
+      std::uint8_t index;
+      EntityID entityID;
+      bool local;
+
+      // Ring of inputs for the ticks around the current one
+      std::vector<InputSlot> inputs;
+
+      // Input is known for every tick before this one
+      std::uint32_t knownThrough;
+
+      // Input of the tick before knownThrough, which predicts the ticks after it
+      ActionMask lastKnown;
+   };
+
+   struct Frame
+   {
+      std::uint32_t tick;
+      WorldSnapshot snapshot;
+      std::vector<std::vector<std::uint8_t>> systemStates;
+   };
+
+   Player* findPlayer(std::uint8_t player);
+   InputSlot& slot(Player& player, std::uint32_t tick);
+
+   // Input to simulate the tick with, known or predicted
+   ActionMask inputFor(Player& player, std::uint32_t tick);
+
+   // Stores the input, returning true if the tick was already simulated with something else
+   bool storeInput(Player& player, std::uint32_t tick, ActionMask actions);
+
+   void simulateTick(float timeStep);
+   void rollback(float timeStep);
+   void receivePackets();
+   void sendLocalInputs();
+
+private:
+   EntityAdmin& m_Admin;
+   Transport* m_Transport;
+   std::uint32_t m_MaxRollbackTicks;
+   std::uint32_t m_CurrentTick;
+
+   // Earliest simulated tick that has to be simulated again, or UINT32_MAX
+   std::uint32_t m_RollbackTick;
+
+   std::vector<Player> m_Players;
+   std::vector<Frame> m_Frames;
+   RollbackStats m_Stats;
+
+   std::vector<std::uint8_t> m_Packet;
+};
+} // namespace korin
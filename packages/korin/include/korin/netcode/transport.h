@@ -0,0 +1,27 @@
+// transport.h
+//
+// Describes the Transport interface which moves packets between two peers.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace korin
+{
+/// Unreliable, unordered packet delivery to one other peer. Netcode on top of a 
+/// Transport has to cope with packets that arrive late, twice or never.
+class Transport
+{
+public:
+   virtual ~Transport() = default;
+
+   virtual void send(const std::vector<std::uint8_t>& packet) = 0;
+
+   // Pops the next packet that has arrived. Returns false when there are none.
+   virtual bool receive(std::vector<std::uint8_t>& packet) = 0;
+};
+} // namespace korin
@@ -0,0 +1,65 @@
+// collision.h
+//
+// Narrow-phase tests between AABB and circle shapes that produce contact manifolds,
+// and a swept AABB test for bodies that move far enough in one tick to tunnel.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+
+#include "korin/math/aabb.h"
+#include "korin/math/vector2d.h"
+
+namespace korin
+{
+struct Circle
+{
+   Vector2D center;
+   float radius;
+};
+
+struct ContactPoint
+{
+   // World space position of the contact
+   Vector2D position;
+
+   // How far the shapes overlap along the manifold normal at this point
+   float penetration;
+};
+
+/// Result of a narrow-phase test between shape A and shape B.
+struct Manifold
+{
+   // Unit normal pointing from A towards B
+   Vector2D normal;
+
+   ContactPoint points[2];
+   std::int32_t pointCount;
+
+   // Deepest penetration of all the points
+   float penetration() const
+   {
+      return pointCount > 1 && points[1].penetration > points[0].penetration
+         ? points[1].penetration : points[0].penetration;
+   }
+};
+
+/// Separates two boxes along the axis of least penetration. The two contact points
+/// span the overlapping edge so resting boxes are supported at both ends.
+bool collideAABBs(const AABB& a, const AABB& b, Manifold& manifold);
+
+bool collideCircles(const Circle& a, const Circle& b, Manifold& manifold);
+
+/// The normal points from the circle towards the box.
+bool collideCircleAABB(const Circle& a, const AABB& b, Manifold& manifold);
+
+/// Sweeps a moving box against a stationary one. On a hit the fraction of the
+/// displacement travelled before impact and the normal of the face that was hit
+/// (pointing back towards the moving box) are returned. Boxes that already
+/// overlap at the start are not reported.
+bool sweepAABBs(const AABB& moving, const Vector2D& displacement, const AABB& target,
+   float& timeOfImpact, Vector2D& normal);
+} // namespace korin
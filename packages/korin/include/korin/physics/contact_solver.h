@@ -0,0 +1,129 @@
+// contact_solver.h
+//
+// Describes the ContactSolver class which resolves contact manifolds with iterated
+// impulses, warm started from the impulses of the previous tick.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "korin/math/vector2d.h"
+#include "korin/physics/collision.h"
+
+namespace korin
+{
+class ThreadPool;
+class ByteWriter;
+class ByteReader;
+
+/// Velocity state of a body for the duration of a solve. Bodies do not rotate
+/// so only linear velocity and mass are needed.
+struct SolverBody
+{
+   Vector2D velocity;
+
+   // Accumulated position change needed to push the body out of penetration
+   Vector2D positionCorrection;
+
+   // Zero for static bodies
+   float inverseMass;
+};
+
+struct ContactConstraint
+{
+   // Indices into the body list passed to solve
+   std::uint32_t bodyA;
+   std::uint32_t bodyB;
+
+   // Stable key of the body pair used to warm start the next tick
+   std::uint64_t key;
+
+   Manifold manifold;
+   float friction;
+   float restitution;
+
+   // Solver state. Accumulated impulses are read back out after the solve.
+   float normalImpulse;
+   float tangentImpulse;
+   float normalMass;
+   float velocityBias;
+};
+
+/// Sequential impulse solver. Contacts are grouped into islands of bodies that touch
+/// each other. Islands share no dynamic bodies so large solves spread them across a
+/// ThreadPool, and the result is the same no matter how many threads are used.
+class ContactSolver
+{
+public:
+   ContactSolver();
+   ~ContactSolver();
+
+   // Solves the contacts and writes the new velocities and position corrections into the bodies
+   void solve(std::vector<SolverBody>& bodies, std::vector<ContactConstraint>& contacts);
+
+   // Drops the cached impulses of a pair that stopped touching
+   void forget(std::uint64_t key);
+
+   void clearCache();
+
+   // Saves and loads the cached impulses, sorted by pair so equal caches write equal bytes
+   void writeCache(ByteWriter& writer) const;
+   bool readCache(ByteReader& reader);
+
+   // Islands found by the last solve
+   std::size_t islandCount() const { return m_IslandOffsets.empty() ? 0 : m_IslandOffsets.size() - 1; }
+
+public:
+   std::int32_t velocityIterations;
+   std::int32_t positionIterations;
+
+   // Fraction of the penetration removed per position iteration
+   float baumgarte;
+
+   // Penetration allowed before position correction kicks in, which keeps resting contacts alive
+   float linearSlop;
+
+   // Largest position correction applied per contact per iteration
+   float maxCorrection;
+
+   // Closing speeds below this don't bounce
+   float restitutionThreshold;
+
+   bool warmStarting;
+
+   // Solves with fewer contacts than this stay on the calling thread
+   std::size_t parallelThreshold;
+
+private:
+   struct CachedImpulse
+   {
+      float normal;
+      float tangent;
+   };
+
+   void buildIslands(const std::vector<SolverBody>& bodies, const std::vector<ContactConstraint>& contacts);
+   void solveIsland(std::size_t island, std::vector<SolverBody>& bodies, std::vector<ContactConstraint>& contacts) const;
+
+   std::uint32_t findRoot(std::uint32_t body);
+
+private:
+   std::unordered_map<std::uint64_t, CachedImpulse> m_ImpulseCache;
+
+   // Union-find parents of the bodies
+   std::vector<std::uint32_t> m_Parents;
+
+   // Contact indices grouped by island. Island n owns [m_IslandOffsets[n], m_IslandOffsets[n + 1]).
+   std::vector<std::uint32_t> m_IslandContacts;
+   std::vector<std::uint32_t> m_IslandOffsets;
+   std::vector<std::uint32_t> m_ContactIslands;
+   std::vector<std::uint32_t> m_RootIslands;
+
+   std::unique_ptr<ThreadPool> m_ThreadPool;
+};
+} // namespace korin
@@ -0,0 +1,21 @@
+// integration.h
+//
+// Batched integrators that advance structure-of-arrays body state by one time step.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstddef>
+
+namespace korin
+{
+/// Advances count bodies with semi-implicit (symplectic) Euler: velocity is integrated
+/// first and the new velocity moves the position. Every array must hold count floats.
+/// Four bodies are integrated per SIMD instruction with a scalar loop for the remainder.
+void integrateSemiImplicitEuler(std::size_t count, float timeStep,
+   float* positionX, float* positionY,
+   float* velocityX, float* velocityY,
+   const float* accelerationX, const float* accelerationY);
+} // namespace korin
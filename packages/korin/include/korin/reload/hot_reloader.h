@@ -0,0 +1,66 @@
+// hot_reloader.h
+//
+// Describes the HotReloader class which reloads prefabs, scenes and system modules
+// into a running world when their files change.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "korin/util/file_watcher.h"
+
+namespace korin
+{
+class EntityAdmin;
+class PrefabLibrary;
+class SystemModule;
+
+/// Development tool for tuning a running game. Call update between frames, never from
+/// inside a system update. A file that fails to load, like one still being written,
+/// leaves the world as it was and is tried again the next time it changes.
+///    HotReloader reloader(world);
+///    reloader.watchPrefabs("assets/prefabs.kpak", prefabs);
+///    reloader.watchSystemModule("build/libgameplay.so");
+class HotReloader
+{
+public:
+   explicit HotReloader(EntityAdmin& admin);
+   ~HotReloader();
+
+   HotReloader(const HotReloader&) = delete;
+   HotReloader& operator=(const HotReloader&) = delete;
+
+   // Reloads the pack's prefabs into the library when it changes and applies the
+   // changes to the entities already made from them
+   void watchPrefabs(const std::string& packPath, PrefabLibrary& library);
+
+   // Replaces the world's entities with the scene's whenever it changes
+   void watchScene(const std::string& scenePath);
+
+   // Loads the module now and swaps in the new build whenever it changes
+   bool watchSystemModule(const std::string& libraryPath);
+
+   // Reloads whatever changed. Returns how many files did.
+   std::size_t update();
+
+   // Reloads that succeeded
+   std::uint32_t reloadCount() const { return m_ReloadCount; }
+
+   SystemModule* systemModule() const { return m_SystemModule.get(); }
+
+private:
+   bool reloadPrefabs(const std::string& packPath, PrefabLibrary& library);
+   bool reloadScene(const std::string& scenePath);
+
+private:
+   EntityAdmin& m_Admin;
+   FileWatcher m_Watcher;
+   std::unique_ptr<SystemModule> m_SystemModule;
+   std::uint32_t m_ReloadCount;
+};
+} // namespace korin
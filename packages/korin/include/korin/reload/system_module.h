@@ -0,0 +1,89 @@
+// system_module.h
+//
+// Describes the SystemModule class which loads gameplay systems from a shared library
+// and swaps them for a rebuilt copy without touching the world.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "korin/system.h"
+#include "korin/system_schedule.h"
+
+#if defined(KORIN_PLATFORM_WINDOWS)
+   #define KORIN_MODULE_EXPORT extern "C" __declspec(dllexport)
+#else
+   #define KORIN_MODULE_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+namespace korin
+{
+class EntityAdmin;
+
+// A system a module hands over, and where it goes in the schedule
+struct ModuleSystem
+{
+   SystemPtr system;
+   SystemDesc desc;
+};
+
+// Every system module exports this function, linked against the same korin library as the game:
+//    KORIN_MODULE_EXPORT void korinCreateSystems(std::vector<korin::ModuleSystem>& systems)
+//    {
+//       systems.push_back({std::make_shared<WaveSystem>(), {"Wave", korin::SystemPhase::Simulation}});
+//    }
+using CreateSystemsFunction = void (*)(std::vector<ModuleSystem>& systems);
+constexpr const char* SYSTEM_MODULE_ENTRY_POINT = "korinCreateSystems";
+
+/// The world keeps its entities and components across a reload; only the module's
+/// systems are replaced. Anything whose code lives in the module is destroyed before
+/// the old library is closed, so components stay in the game or korin, and state a
+/// system keeps for itself rebuilds after a reload like it does after a rollback.
+///
+/// The library is copied before it is loaded, so the build can overwrite the original
+/// while the copy is in use.
+class SystemModule
+{
+public:
+   explicit SystemModule(EntityAdmin& admin);
+   ~SystemModule();
+
+   SystemModule(const SystemModule&) = delete;
+   SystemModule& operator=(const SystemModule&) = delete;
+
+   // Loads the library and adds its systems. On failure the systems already loaded are kept.
+   bool load(const std::string& path);
+
+   // Loads the library again from the same path
+   bool reload();
+
+   // Removes the module's systems and closes the library
+   void unload();
+
+   bool isLoaded() const { return m_Library != nullptr; }
+   const std::string& path() const { return m_Path; }
+   const std::vector<SystemPtr>& systems() const { return m_Systems; }
+   std::uint32_t loadCount() const { return m_LoadCount; }
+
+private:
+   static void* openLibrary(const std::string& path);
+   static void* findSymbol(void* library, const char* name);
+   static void closeLibrary(void* library);
+
+private:
+   EntityAdmin& m_Admin;
+   std::string m_Path;
+
+   // Platform handle of the loaded copy
+   void* m_Library;
+   std::string m_LoadedPath;
+
+   std::vector<SystemPtr> m_Systems;
+   std::uint32_t m_LoadCount;
+};
+} // namespace korin
@@ -0,0 +1,85 @@
+// render_backend.h
+//
+// Describes the RenderBackend class which is the common interface between the
+// RenderSystem and whatever draws the sprites, and the instance data it is handed.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace korin
+{
+using TextureID = std::uint32_t;
+
+// Packs a color so its bytes are red, green, blue and alpha in memory
+constexpr std::uint32_t rgba(std::uint8_t red, std::uint8_t green, std::uint8_t blue, std::uint8_t alpha = 255)
+{
+   return static_cast<std::uint32_t>(red) | (static_cast<std::uint32_t>(green) << 8)
+      | (static_cast<std::uint32_t>(blue) << 16) | (static_cast<std::uint32_t>(alpha) << 24);
+}
+
+constexpr std::uint32_t WHITE = rgba(255, 255, 255);
+
+/// One sprite as a GPU would read it from an instance buffer. The rotation is
+/// precomputed so backends never call trigonometric functions per sprite.
+struct SpriteInstance
+{
+   // Center in world units
+   float x, y;
+
+   // Half the size in world units, scale included
+   float halfWidth, halfHeight;
+
+   float cosRotation, sinRotation;
+
+   // Region of the texture, with v going down from the top of the texture
+   float u0, v0, u1, v1;
+
+   std::uint32_t color;
+};
+
+/// A run of instances that share a texture and layer and are drawn with one call
+struct DrawBatch
+{
+   TextureID textureID;
+   std::int16_t layer;
+   std::uint32_t firstInstance;
+   std::uint32_t instanceCount;
+};
+
+/// The part of the world shown on screen
+struct RenderView
+{
+   float centerX, centerY;
+   float pixelsPerUnit;
+};
+
+/// A frame is beginFrame, one drawInstances per batch in back to front order, then
+/// endFrame. Every drawInstances is a single draw call with its own texture binding.
+class RenderBackend
+{
+public:
+   RenderBackend() = default;
+   virtual ~RenderBackend() = default;
+
+   RenderBackend(const RenderBackend&) = delete;
+   RenderBackend& operator=(const RenderBackend&) = delete;
+
+   virtual void beginFrame(const RenderView& view) = 0;
+   virtual void drawInstances(TextureID textureID, const SpriteInstance* instances, std::size_t count) = 0;
+   virtual void endFrame() = 0;
+
+   // Size of what is drawn into, in pixels
+   virtual std::uint32_t width() const = 0;
+   virtual std::uint32_t height() const = 0;
+
+   // Creates the backend for the platform being built for. Until there is a GPU 
+   // backend this is the software one, drawing offscreen.
+   static std::unique_ptr<RenderBackend> createPlatformBackend();
+};
+} // namespace korin
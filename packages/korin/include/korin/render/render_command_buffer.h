@@ -0,0 +1,67 @@
+// render_command_buffer.h
+//
+// Describes the RenderCommandBuffer class which records a frame of rendering as
+// compact commands so it can be drawn later, on another thread.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "korin/render/render_backend.h"
+
+namespace korin
+{
+enum class RenderCommandType : std::uint8_t
+{
+   BeginFrame,
+   DrawInstances,
+   EndFrame
+};
+
+/// Draws refer to a range of the buffer's own copy of the instances, so a command
+/// is a few words no matter how many sprites it draws.
+struct RenderCommand
+{
+   RenderCommandType type;
+   TextureID textureID;
+   std::uint32_t firstInstance;
+   std::uint32_t instanceCount;
+};
+
+/// Stands in for the real backend while a frame is recorded, then replays the frame
+/// into it with execute. Recording copies everything the frame needs, so the source
+/// buffers can change as soon as the frame is recorded. The buffers are kept between
+/// frames and only grow.
+class RenderCommandBuffer : public RenderBackend
+{
+public:
+   // Takes the size of the backend the frame will be drawn into
+   RenderCommandBuffer(std::uint32_t width, std::uint32_t height);
+
+   // Starts over, dropping whatever was recorded before
+   virtual void beginFrame(const RenderView& view) override;
+   virtual void drawInstances(TextureID textureID, const SpriteInstance* instances, std::size_t count) override;
+   virtual void endFrame() override;
+
+   virtual std::uint32_t width() const override { return m_Width; }
+   virtual std::uint32_t height() const override { return m_Height; }
+
+   // Replays the commands into the backend in the order they were recorded
+   void execute(RenderBackend& backend) const;
+
+   const RenderView& view() const { return m_View; }
+   const std::vector<RenderCommand>& commands() const { return m_Commands; }
+   const std::vector<SpriteInstance>& instances() const { return m_Instances; }
+
+private:
+   std::uint32_t m_Width;
+   std::uint32_t m_Height;
+   RenderView m_View;
+   std::vector<RenderCommand> m_Commands;
+   std::vector<SpriteInstance> m_Instances;
+};
+} // namespace korin
@@ -0,0 +1,96 @@
+// render_thread.h
+//
+// Describes the RenderThread class which draws recorded frames into a backend on a
+// thread of its own so the simulation never waits on rendering.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "korin/render/render_backend.h"
+#include "korin/render/render_command_buffer.h"
+#include "korin/util/spsc_queue.h"
+
+namespace korin
+{
+/// Frames travel between the simulation thread and the render thread in a fixed set
+/// of command buffers, passed back and forth through two lock-free queues. The
+/// simulation records into a free buffer and submits it; the render thread draws the
+/// newest submitted frame and hands every buffer back. When the render thread falls
+/// behind, older submitted frames are skipped, and when no buffer is free the
+/// simulation drops its frame instead of waiting.
+class RenderThread
+{
+public:
+   explicit RenderThread(std::unique_ptr<RenderBackend> backend);
+   ~RenderThread();
+
+   RenderThread(const RenderThread&) = delete;
+   RenderThread& operator=(const RenderThread&) = delete;
+
+   // Returns false if the thread is already running
+   bool start();
+
+   // Draws the frames still waiting, then joins the thread
+   void stop();
+
+   bool running() const { return m_Thread.joinable(); }
+
+   // Simulation thread only. Null when every buffer is queued or being drawn.
+   RenderCommandBuffer* acquireFrame();
+   void submitFrame(RenderCommandBuffer* frame);
+
+   // Draws the newest submitted frame on the calling thread. Only for when the thread isn't running.
+   bool renderPending();
+
+   // Only safe to touch from other threads while the render thread isn't running
+   RenderBackend& backend() { return *m_Backend; }
+   std::unique_ptr<RenderBackend> releaseBackend();
+
+   std::uint32_t framesRendered() const { return m_FramesRendered.load(std::memory_order_relaxed); }
+
+   // Submitted frames that were replaced by a newer one before they were drawn
+   std::uint32_t framesSkipped() const { return m_FramesSkipped.load(std::memory_order_relaxed); }
+
+   // Frames the simulation couldn't record because no buffer was free
+   std::uint32_t framesDropped() const { return m_FramesDropped.load(std::memory_order_relaxed); }
+
+public:
+   // One being recorded, one waiting and one being drawn
+   static constexpr std::uint32_t FRAME_COUNT = 3;
+
+private:
+   void renderLoop();
+
+private:
+   std::unique_ptr<RenderBackend> m_Backend;
+   std::array<std::unique_ptr<RenderCommandBuffer>, FRAME_COUNT> m_Frames;
+
+   // Simulation to render thread
+   SPSCQueue<std::uint32_t, 4> m_Submitted;
+
+   // Render thread back to simulation
+   SPSCQueue<std::uint32_t, 4> m_Free;
+
+   std::thread m_Thread;
+   std::atomic<bool> m_Stopping;
+
+   // Only the render thread waits on these. Submitting notifies without locking so
+   // the simulation never blocks; a missed wake up is covered by the wait timeout.
+   std::mutex m_WakeMutex;
+   std::condition_variable m_Wake;
+
+   std::atomic<std::uint32_t> m_FramesRendered;
+   std::atomic<std::uint32_t> m_FramesSkipped;
+   std::atomic<std::uint32_t> m_FramesDropped;
+};
+} // namespace korin
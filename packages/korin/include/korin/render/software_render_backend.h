@@ -0,0 +1,66 @@
+// software_render_backend.h
+//
+// Describes the SoftwareRenderBackend class which draws sprites on the CPU into an
+// offscreen RGBA framebuffer, for machines without a GPU and for tests.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "korin/render/render_backend.h"
+
+namespace korin
+{
+/// Textures are looked up once per draw call and sampled with the nearest texel.
+/// Sprites whose texture was never set are drawn in their color. Transparent texels
+/// are skipped and translucent ones are blended over what's already drawn.
+class SoftwareRenderBackend : public RenderBackend
+{
+public:
+   SoftwareRenderBackend(std::uint32_t width, std::uint32_t height);
+
+   // Copies the pixels, packed with rgba(), row by row from the top
+   void setTexture(TextureID textureID, std::uint32_t width, std::uint32_t height, const std::uint32_t* pixels);
+
+   virtual void beginFrame(const RenderView& view) override;
+   virtual void drawInstances(TextureID textureID, const SpriteInstance* instances, std::size_t count) override;
+   virtual void endFrame() override {}
+
+   virtual std::uint32_t width() const override { return m_Width; }
+   virtual std::uint32_t height() const override { return m_Height; }
+   const std::vector<std::uint32_t>& pixels() const { return m_Pixels; }
+   std::uint32_t pixel(std::uint32_t x, std::uint32_t y) const { return m_Pixels[y * m_Width + x]; }
+
+   // Counted since the last beginFrame
+   std::uint32_t drawCalls() const { return m_DrawCalls; }
+   std::uint32_t instancesDrawn() const { return m_InstancesDrawn; }
+
+public:
+   std::uint32_t clearColor;
+
+private:
+   struct Texture
+   {
+      std::uint32_t width;
+      std::uint32_t height;
+      std::vector<std::uint32_t> pixels;
+   };
+
+   void drawInstance(const SpriteInstance& instance, const Texture* texture);
+
+private:
+   std::uint32_t m_Width;
+   std::uint32_t m_Height;
+   std::vector<std::uint32_t> m_Pixels;
+   std::unordered_map<TextureID, Texture> m_Textures;
+
+   RenderView m_View;
+   std::uint32_t m_DrawCalls;
+   std::uint32_t m_InstancesDrawn;
+};
+} // namespace korin
@@ -0,0 +1,66 @@
+// sprite_batcher.h
+//
+// Describes the SpriteBatcher class which turns SpriteComponents into a sorted
+// instance buffer split into as few draw batches as possible.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "korin/component.h"
+#include "korin/math/aabb.h"
+#include "korin/math/aabb4.h"
+#include "korin/render/render_backend.h"
+
+namespace korin
+{
+/// Sprites are sorted by layer, then texture, then the order they were gathered in,
+/// so each layer costs one draw call per texture it uses no matter how many sprites
+/// it has. Sprites outside the visible area are culled four at a time before sorting,
+/// so the cost after gathering scales with what is on screen. The buffers are kept
+/// between frames and only grow.
+class SpriteBatcher
+{
+public:
+   SpriteBatcher();
+
+   // Gathers the visible sprites that have a TransformComponent sibling
+   void build(const std::vector<ComponentPtr>& sprites);
+
+   // Also drops the sprites whose rotated bounds are outside of the area
+   void build(const std::vector<ComponentPtr>& sprites, const AABB& visibleArea);
+
+   // Draws every batch. Doesn't begin or end the frame.
+   void submit(RenderBackend& backend) const;
+
+   const std::vector<SpriteInstance>& instances() const { return m_Instances; }
+   const std::vector<DrawBatch>& batches() const { return m_Batches; }
+
+   // Sprites left out of the last build for being off screen
+   std::uint32_t culledCount() const { return m_CulledCount; }
+
+private:
+   struct SortEntry
+   {
+      // Layer in the high bits and texture in the low bits
+      std::uint64_t key;
+      std::uint32_t index;
+   };
+
+private:
+   std::vector<SpriteInstance> m_Gathered;
+   std::vector<std::uint64_t> m_GatheredKeys;
+
+   // Bounds of the gathered sprites, four to an AABB4
+   std::vector<AABB4> m_Bounds;
+
+   std::vector<SortEntry> m_SortEntries;
+   std::vector<SpriteInstance> m_Instances;
+   std::vector<DrawBatch> m_Batches;
+   std::uint32_t m_CulledCount;
+};
+} // namespace korin
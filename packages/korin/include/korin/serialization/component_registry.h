@@ -0,0 +1,167 @@
+// component_registry.h
+//
+// Describes the ComponentRegistry class which knows how to create each Component type
+// and copy its plain data fields in and out of packed rows.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "korin/component.h"
+#include "korin/entity.h"
+
+namespace korin
+{
+class EntityAdmin;
+
+/// Everything the registry knows about one Component type. A row is the fields of one
+/// component packed back to back in the order they were registered.
+struct ComponentType
+{
+   ComponentTypeID typeID;
+   std::string name;
+
+   // Hash of the name. Unlike the ComponentTypeID it is the same in every build and run.
+   std::uint32_t stableID;
+
+   // Bumped whenever the fields change so old data is rejected instead of misread
+   std::uint16_t schemaVersion;
+
+   std::vector<std::uint16_t> fieldSizes;
+   std::uint32_t rowSize;
+
+   std::function<ComponentPtr()> create;
+
+   // Creates count components in a single allocation, freed once all of them are gone
+   std::function<void(std::size_t count, ComponentPtr* components)> createBlock;
+
+   // Copy the fields of count components to or from count rows
+   std::function<void(Component* const* components, std::size_t count, std::uint8_t* rows)> pack;
+   std::function<void(Component* const* components, std::size_t count, const std::uint8_t* rows)> unpack;
+};
+
+/// The registered components of one type in a world, in EntityID order
+struct ComponentColumn
+{
+   std::vector<EntityID> entityIDs;
+   std::vector<Component*> components;
+};
+
+/// How a column of rows was laid out when it was saved
+struct ColumnSchema
+{
+   std::uint32_t stableID;
+   std::uint16_t schemaVersion;
+   std::vector<std::uint16_t> fieldSizes;
+   std::uint32_t rowSize;
+};
+
+/// Registry of the Component types that can be saved, restored and sent over the network.
+/// Only the registered fields are copied, each with a memcpy, so every field has to be
+/// trivially copyable. The built in components are registered on first use. Register
+/// game types at startup: find() hands out pointers that a later registration can move,
+/// so the registry is only safe to share between world threads once it stops changing.
+class ComponentRegistry
+{
+public:
+   ComponentRegistry(const ComponentRegistry&) = delete;
+   void operator=(const ComponentRegistry&) = delete;
+
+   static ComponentRegistry& instance()
+   {
+      static ComponentRegistry instance;
+      return instance;
+   }
+
+   // Registers T with the given fields, replacing an earlier registration of T.
+   // T must be default constructible.
+   //    registry.registerType<HealthComponent>("Health", 1, &HealthComponent::current, &HealthComponent::max);
+   template <typename T, typename... Fields>
+   bool registerType(const std::string& name, std::uint16_t schemaVersion, Fields T::*... fields)
+   {
+      static_assert(std::is_base_of<Component, T>::value, "T must derive from Component");
+      static_assert(std::is_default_constructible<T>::value, "T must be default constructible");
+      static_assert((std::is_trivially_copyable<Fields>::value && ...), "Registered fields must be trivially copyable");
+
+      ComponentType type;
+      type.typeID = Component::typeID<T>();
+      type.name = name;
+      type.stableID = hashName(name);
+      type.schemaVersion = schemaVersion;
+      type.fieldSizes = {static_cast<std::uint16_t>(sizeof(Fields))...};
+      type.rowSize = static_cast<std::uint32_t>((sizeof(Fields) + ... + 0));
+      type.create = []() -> ComponentPtr { return std::make_shared<T>(); };
+      type.createBlock = [](std::size_t count, ComponentPtr* components)
+      {
+         auto block = std::make_shared<std::vector<T>>(count);
+         for (std::size_t i = 0; i < count; i++)
+         {
+            components[i] = ComponentPtr(block, &(*block)[i]);
+         }
+      };
+
+      type.pack = [fields...](Component* const* components, std::size_t count, std::uint8_t* rows)
+      {
+         for (std::size_t i = 0; i < count; i++)
+         {
+            const T& component = *static_cast<const T*>(components[i]);
+            std::uint8_t* out = rows + i * (sizeof(Fields) + ... + 0);
+            ((std::memcpy(out, &(component.*fields), sizeof(Fields)), out += sizeof(Fields)), ...);
+         }
+      };
+
+      type.unpack = [fields...](Component* const* components, std::size_t count, const std::uint8_t* rows)
+      {
+         for (std::size_t i = 0; i < count; i++)
+         {
+            T& component = *static_cast<T*>(components[i]);
+            const std::uint8_t* in = rows + i * (sizeof(Fields) + ... + 0);
+            ((std::memcpy(&(component.*fields), in, sizeof(Fields)), in += sizeof(Fields)), ...);
+         }
+      };
+
+      return add(std::move(type));
+   }
+
+   // Null if the type isn't registered
+   const ComponentType* find(ComponentTypeID typeID) const;
+   const ComponentType* findStable(std::uint32_t stableID) const;
+
+   const std::vector<ComponentType>& types() const { return m_Types; }
+
+   // Groups the registered components of a world by type so columns[n] holds those of types()[n].
+   // entityIDs is left with every entity in ID order, so the same world always gathers the same way.
+   void gather(const EntityAdmin& admin, std::vector<EntityID>& entityIDs, std::vector<ComponentColumn>& columns) const;
+
+   // The registered type of a saved column. Null, with a warning that starts with source, 
+   // if the type isn't registered or its fields changed since the column was saved.
+   const ComponentType* matchSchema(const ColumnSchema& schema, const std::string& source) const;
+
+   // Hash of a type name, the same as its StringID
+   static std::uint32_t hashName(const std::string& name);
+
+private:
+   ComponentRegistry();
+
+   bool add(ComponentType type);
+
+   // Registers the components that ship with the engine
+   void registerBuiltinTypes();
+
+private:
+   std::vector<ComponentType> m_Types;
+
+   // Index into m_Types of each ComponentTypeID, or -1
+   std::vector<std::int32_t> m_IndexByTypeID;
+   std::unordered_map<std::uint32_t, std::int32_t> m_IndexByStableID;
+};
+} // namespace korin
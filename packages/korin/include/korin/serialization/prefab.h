@@ -0,0 +1,97 @@
+// prefab.h
+//
+// Describes the Prefab class which is a template of component data that entities are
+// stamped out from, and the PrefabLibrary which finds prefabs by resource handle.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "korin/component.h"
+#include "korin/util/string_id.h"
+
+namespace korin
+{
+class EntityAdmin;
+class PackFile;
+
+constexpr std::uint32_t PREFAB_MAGIC = 0x4246504B; // "KPFB"
+constexpr std::uint16_t PREFAB_VERSION = 1;
+
+/// The registered fields of each component of an entity, packed once so every copy
+/// is a memcpy. Instantiate it with EntityAdmin::instantiate. Components whose type
+/// isn't in the ComponentRegistry can't be part of a prefab. Serialized as
+///    u32 magic, u16 version, u16 component count
+///    per component: u32 stable type ID, u16 schema version, u16 field count,
+///       u16 size of each field, u32 row size, then the row
+class Prefab
+{
+friend class EntityAdmin;
+
+public:
+   Prefab();
+   explicit Prefab(StringID handle);
+
+   // Copies the component's registered fields, replacing a component of the same type
+   bool add(const ComponentPtr& component);
+
+   // Copies every registered component of an entity
+   bool capture(const EntityAdmin& admin, EntityID entityID);
+
+   void serialize(std::vector<std::uint8_t>& data) const;
+
+   // Fails, leaving the prefab empty, if a type isn't registered or its schema changed
+   bool deserialize(const std::uint8_t* data, std::size_t size);
+
+   // Brings the entities made from the previous version of this prefab up to date. Only
+   // fields that differ between the versions are copied, so the rest keep their live
+   // values. Component types the prefab gained are added and ones it lost are removed.
+   // Returns how many entities were updated.
+   std::uint32_t applyChanges(EntityAdmin& admin, const Prefab& previous) const;
+
+   // Given to every entity made from the prefab
+   StringID handle() const { return m_Handle; }
+   void setHandle(StringID handle) { m_Handle = handle; }
+
+   std::size_t componentCount() const { return m_Components.size(); }
+   bool empty() const { return m_Components.empty(); }
+
+private:
+   struct Entry
+   {
+      // Index into the ComponentRegistry's types
+      std::size_t typeIndex;
+      std::vector<std::uint8_t> row;
+   };
+
+private:
+   StringID m_Handle;
+   std::vector<Entry> m_Components;
+};
+
+/// Prefabs by resource handle
+class PrefabLibrary
+{
+public:
+   PrefabLibrary();
+
+   // Replaces a prefab with the same handle
+   void add(Prefab prefab);
+
+   // Null if there is no prefab with the handle
+   const Prefab* find(StringID handle) const;
+
+   // Loads every Prefab blob of the pack under its name. Returns how many loaded.
+   std::size_t load(const PackFile& pack);
+
+   std::size_t size() const { return m_Prefabs.size(); }
+
+private:
+   std::unordered_map<StringID, Prefab> m_Prefabs;
+};
+} // namespace korin
@@ -0,0 +1,111 @@
+// scene_file.h
+//
+// Describes the SceneWriter class which saves a world as a level, and the SceneFile
+// class which loads a level straight out of the mapped file.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "korin/entity.h"
+#include "korin/serialization/component_registry.h"
+#include "korin/util/mapped_file.h"
+
+namespace korin
+{
+class EntityAdmin;
+
+// Scene layout:
+//    u32 magic, u16 version, u16 column count, u32 entity count, u32 next EntityID,
+//    u32 offset of the EntityIDs, u32 offset of the resource handles
+//    per column, one for each registered component type present:
+//       u32 stable type ID, u16 schema version, u16 field count, u32 row size,
+//       u32 row count, u32 offset of the row EntityIDs, u32 offset of the rows,
+//       u16 size of each field
+//    then the arrays the offsets point to, each aligned to SCENE_ALIGNMENT:
+//       u32 EntityID of each entity, u32 resource handle StringID of each entity,
+//       and per column a u32 EntityID of each row and the packed rows
+// The arrays are in native layout, so they're used where they lie in the mapping and
+// each column is copied into its components with a single unpack. Like snapshots, a
+// scene is only meant to be read by a build with the same component layouts and byte order.
+constexpr std::uint32_t SCENE_MAGIC = 0x4E43534B; // "KSCN"
+constexpr std::uint16_t SCENE_VERSION = 1;
+constexpr std::size_t SCENE_ALIGNMENT = 16;
+
+/// Saves the entities and registered components of a world as a scene
+class SceneWriter
+{
+public:
+   SceneWriter();
+
+   // Replaces the scene with the current state of the world
+   void capture(const EntityAdmin& admin);
+
+   bool write(const std::string& path) const;
+
+   const std::vector<std::uint8_t>& data() const { return m_Data; }
+
+private:
+   std::vector<std::uint8_t> m_Data;
+};
+
+/// Read only view of a scene. Opening only reads the header and the column directory;
+/// the arrays are read in place when the scene is loaded into a world.
+class SceneFile
+{
+public:
+   SceneFile();
+
+   SceneFile(const SceneFile&) = delete;
+   SceneFile& operator=(const SceneFile&) = delete;
+
+   // Maps the file. Fails if it isn't a scene or a component schema changed since it was written.
+   bool open(const std::string& path);
+
+   // Views a scene already in memory, like a pack blob. The data has to stay alive
+   // while the scene is open and start on a multiple of SCENE_ALIGNMENT.
+   bool open(const std::uint8_t* data, std::size_t size);
+
+   void close();
+
+   bool isOpen() const { return m_Data != nullptr; }
+
+   // Replaces every entity and component of the world with the scene's. Systems are kept.
+   bool load(EntityAdmin& admin) const;
+
+   // One line per entity and per component row with the field bytes in hex, in a
+   // stable order, so two versions of a scene can be compared with a text diff
+   std::string exportText() const;
+
+   std::uint32_t entityCount() const { return m_EntityCount; }
+   std::size_t columnCount() const { return m_Columns.size(); }
+
+private:
+   struct Column
+   {
+      // Index into the registry types
+      std::size_t typeIndex;
+      std::uint32_t rowCount;
+      const EntityID* entityIDs;
+      const std::uint8_t* rows;
+   };
+
+   // Reads the header and column directory. Nothing changes if it isn't valid.
+   bool parse(const std::uint8_t* data, std::size_t size);
+
+private:
+   MappedFile m_File;
+   const std::uint8_t* m_Data;
+   std::vector<Column> m_Columns;
+   std::uint32_t m_EntityCount;
+   EntityID m_NextEntityID;
+   const EntityID* m_EntityIDs;
+   const std::uint32_t* m_Handles;
+};
+} // namespace korin
@@ -0,0 +1,102 @@
+// world_snapshot.h
+//
+// Describes the WorldSnapshot class which saves every entity of an EntityAdmin and their
+// registered components into one binary buffer and restores the world from it.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "korin/component.h"
+#include "korin/entity.h"
+#include "korin/serialization/component_registry.h"
+
+namespace korin
+{
+class EntityAdmin;
+
+// Snapshot layout:
+//    u32 magic, u16 version, u16 reserved, u32 entity count, u32 column count, u32 next EntityID
+//    per entity, by ascending EntityID: u32 EntityID, u32 resource handle StringID
+//    per column, one for each registered component type present:
+//       u32 stable type ID, u16 schema version, u16 field count, u16 size of each field,
+//       u32 row size, u32 row count, u32 EntityID of each row, then the packed rows
+// Rows are raw copies of the registered fields so a snapshot is only meant to be read
+// by a build with the same component layouts and byte order.
+constexpr std::uint32_t WORLD_SNAPSHOT_MAGIC = 0x504E534B; // "KSNP"
+constexpr std::uint16_t WORLD_SNAPSHOT_VERSION = 2;
+
+/// Copy of the whole world at one point in time. Only components whose type is in the
+/// ComponentRegistry are saved, and state kept inside systems, like contact caches and
+/// broad-phase pairs, is not part of the world and rebuilds itself.
+///
+/// Capturing and restoring reuse their buffers, so a snapshot kept around and captured
+/// every tick stops allocating once it has grown to the size of the world.
+class WorldSnapshot
+{
+public:
+   WorldSnapshot();
+
+   // Replaces the snapshot with the current state of the world
+   void capture(const EntityAdmin& admin);
+
+   // Puts the world back the way it was captured. A world that still holds exactly the
+   // captured entities and components only has its component fields copied back. Any
+   // other world is cleared and rebuilt. Returns false without touching the world if
+   // there is nothing to restore. Systems are told the world was restored.
+   bool restore(EntityAdmin& admin) const;
+
+   // Adopts snapshot data, like a save game. Returns false if it isn't a snapshot or if
+   // a component schema changed since it was written.
+   bool load(std::vector<std::uint8_t> data);
+   bool loadFromFile(const std::string& path);
+   bool saveToFile(const std::string& path) const;
+
+   const std::vector<std::uint8_t>& data() const { return m_Data; }
+   bool empty() const { return m_Data.empty(); }
+   std::uint32_t entityCount() const { return m_EntityCount; }
+
+   // Whether the last restore copied into the existing components instead of rebuilding the world
+   bool lastRestoreWasInPlace() const { return m_LastRestoreInPlace; }
+
+private:
+   struct Column
+   {
+      // Index into the registry types. Indices stay valid as more types are registered.
+      std::size_t typeIndex;
+      std::uint32_t rowCount;
+      std::size_t entityIDsOffset;
+      std::size_t rowsOffset;
+   };
+
+   // Reads the header and column layout of the data. Nothing changes if it isn't valid.
+   bool parse(const std::vector<std::uint8_t>& data);
+
+   EntityID rowEntityID(const Column& column, std::uint32_t row) const;
+   static const ComponentType& columnType(const Column& column);
+
+   // Finds the component of every row in the world. Returns false if the world
+   // doesn't hold exactly the captured entities and components.
+   bool gatherExisting(const EntityAdmin& admin) const;
+   void rebuild(EntityAdmin& admin) const;
+
+private:
+   std::vector<std::uint8_t> m_Data;
+   std::vector<Column> m_Columns;
+   std::uint32_t m_EntityCount;
+   std::uint32_t m_RowCount;
+   EntityID m_NextEntityID;
+   std::size_t m_EntitiesOffset;
+
+   // Scratch space reused between captures and restores
+   std::vector<EntityID> m_EntityIDs;
+   std::vector<ComponentColumn> m_Gathered;
+   mutable std::vector<Component*> m_Components;
+   mutable bool m_LastRestoreInPlace;
+};
+} // namespace korin
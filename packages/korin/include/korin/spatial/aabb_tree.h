@@ -0,0 +1,143 @@
+// aabb_tree.h
+//
+// Describes the AABBTree class which is a dynamic bounding volume hierarchy of entity
+// AABBs for overlap queries and raycasts in scenes with uneven entity density.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "korin/entity.h"
+#include "korin/math/aabb.h"
+#include "korin/math/vector2d.h"
+
+namespace korin
+{
+using ProxyID = std::int32_t;
+
+// A ProxyID that never refers to a node in the tree
+constexpr ProxyID NULL_PROXY = -1;
+
+struct RaycastHit
+{
+   EntityID entityID;
+
+   // Fraction along the segment from start to end where the ray entered the bounds
+   float fraction;
+
+   Vector2D point;
+   Vector2D normal;
+};
+
+/// Binary tree of AABBs where each leaf holds an entity's bounds enlarged by a margin
+/// (its fat AABB) so small movements don't require the tree to change. Inserts pick the
+/// cheapest sibling by perimeter and every insert or removal rebalances the ancestors
+/// with tree rotations. Traversals test four nodes at a time with SIMD.
+class AABBTree
+{
+public:
+   // fatMargin: How far leaf bounds are enlarged past the entity's bounds
+   // displacementMultiplier: How far leaf bounds are stretched in the direction of movement
+   explicit AABBTree(float fatMargin = 0.1f, float displacementMultiplier = 2.0f);
+
+   // Adds an entity's bounds as a new leaf
+   ProxyID createProxy(EntityID entityID, const AABB& bounds);
+
+   // Removes a leaf from the tree
+   void destroyProxy(ProxyID proxyID);
+
+   // Moves a leaf. The tree only changes when the bounds escape the leaf's fat AABB.
+   // Returns true if the leaf was re-inserted.
+   bool moveProxy(ProxyID proxyID, const AABB& bounds, const Vector2D& displacement);
+
+   // Removes every leaf from the tree
+   void clear();
+
+   EntityID entityID(ProxyID proxyID) const;
+   const AABB& fatBounds(ProxyID proxyID) const;
+   const AABB& bounds(ProxyID proxyID) const;
+
+   // Appends every entity whose bounds intersect the region
+   void query(const AABB& region, std::vector<EntityID>& results) const;
+
+   // Finds the closest entity hit by the segment from start to end. Returns false on a miss.
+   bool raycast(const Vector2D& start, const Vector2D& end, RaycastHit& hit) const;
+
+   // Appends every entity hit by the segment from start to end in no particular order
+   void raycastAll(const Vector2D& start, const Vector2D& end, std::vector<RaycastHit>& hits) const;
+
+   // Number of leaves in the tree
+   std::size_t size() const { return m_ProxyCount; }
+
+   // Height of the root. An empty tree has a height of -1.
+   std::int32_t height() const;
+
+   // Largest height difference between the children of any node
+   std::int32_t maxBalance() const;
+
+   // Sum of all node perimeters divided by the root's. Lower is a tighter tree.
+   float areaRatio() const;
+
+   // Checks the structure and bounds of every node with KORIN_ASSERT
+   void validate() const;
+
+private:
+   struct Node
+   {
+      // Fat bounds for leaves, union of the children for branches
+      AABB fatBounds;
+
+      // Exact bounds of the entity, only meaningful for leaves
+      AABB bounds;
+
+      // Free nodes use the parent index as the next free node
+      ProxyID parent;
+      ProxyID child1;
+      ProxyID child2;
+
+      // Leaves are 0 and free nodes are -1
+      std::int32_t height;
+
+      EntityID entityID;
+
+      bool isLeaf() const { return child1 == NULL_PROXY; }
+   };
+
+   ProxyID allocateNode();
+   void freeNode(ProxyID nodeID);
+
+   void insertLeaf(ProxyID leafID);
+   void removeLeaf(ProxyID leafID);
+
+   // Walks up from a node restoring bounds and heights and rotating unbalanced nodes
+   void refitAncestors(ProxyID nodeID);
+
+   // Performs a left or right rotation if the node is unbalanced. Returns the new subtree root.
+   ProxyID balance(ProxyID nodeID);
+
+   bool isValidProxy(ProxyID proxyID) const;
+   void validateNode(ProxyID nodeID) const;
+
+   // Slab test of a segment against a single box. Returns the entry fraction and normal.
+   static bool raycastBounds(const AABB& bounds, const Vector2D& start, const Vector2D& inverseDirection,
+      float maxFraction, float& fraction, Vector2D& normal);
+
+   static Vector2D inverseDirection(const Vector2D& start, const Vector2D& end);
+
+private:
+   float m_FatMargin;
+   float m_DisplacementMultiplier;
+
+   std::vector<Node> m_Nodes;
+   ProxyID m_Root;
+   ProxyID m_FreeList;
+   std::size_t m_ProxyCount;
+
+   // Reused traversal stack so queries don't allocate
+   mutable std::vector<ProxyID> m_Stack;
+};
+} // namespace korin
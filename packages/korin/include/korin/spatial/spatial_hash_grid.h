@@ -0,0 +1,111 @@
+// spatial_hash_grid.h
+//
+// Describes the SpatialHashGrid class which is a broad-phase index of entity AABBs
+// bucketed into uniform cells keyed by Morton code.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+
+#include "korin/entity.h"
+#include "korin/math/aabb.h"
+#include "korin/math/morton.h"
+#include "korin/util/entity_slot_map.h"
+
+namespace korin
+{
+class Vector2D;
+
+/// Uniform grid that indexes entity AABBs so region, point and pair queries only
+/// touch entities in nearby cells instead of testing every entity against every other.
+///
+/// Note: Queries stamp proxies to avoid duplicate results so a single grid must not
+/// be queried from multiple threads at once.
+class SpatialHashGrid
+{
+public:
+   explicit SpatialHashGrid(float cellSize);
+
+   // Adds an entity's bounds to the grid, or updates them if it is already indexed.
+   // Bounds that are NaN or infinite are rejected.
+   void insert(EntityID entityID, const AABB& bounds);
+
+   // Moves an entity's bounds. Only touches cell buckets when the covered cells changed.
+   // Bounds that are NaN or infinite are rejected and the old bounds kept.
+   void update(EntityID entityID, const AABB& bounds);
+
+   // Removes an entity from the grid
+   void remove(EntityID entityID);
+
+   // Removes every entity from the grid
+   void clear();
+
+   bool contains(EntityID entityID) const;
+
+   // Number of entities indexed by the grid
+   std::size_t size() const { return m_Count; }
+
+   float cellSize() const { return m_CellSize; }
+
+   // Appends every entity whose bounds intersect the region
+   void queryRegion(const AABB& region, std::vector<EntityID>& results) const;
+
+   // Appends every entity whose bounds contain the point
+   void queryPoint(const Vector2D& point, std::vector<EntityID>& results) const;
+
+   // Appends every pair of entities whose bounds intersect. Each pair is reported once
+   // with the lower EntityID first. Cells are visited in Morton order.
+   void queryPairs(std::vector<std::pair<EntityID, EntityID>>& pairs) const;
+
+private:
+   // Inclusive range of cell coordinates covered by a set of bounds
+   struct CellRange
+   {
+      std::int32_t minX, minY;
+      std::int32_t maxX, maxY;
+
+      bool operator==(const CellRange& other) const
+      {
+         return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+      }
+   };
+
+   struct Proxy
+   {
+      AABB bounds;
+      CellRange cells;
+      EntityID entityID;
+   };
+
+   CellRange cellRangeFor(const AABB& bounds) const;
+   std::int32_t cellCoordinate(float value) const;
+   static MortonCode cellKey(std::int32_t cellX, std::int32_t cellY);
+
+   static bool isFinite(const AABB& bounds);
+
+   void addToCells(std::uint32_t slot, const CellRange& cells);
+   void removeFromCells(std::uint32_t slot, const CellRange& cells);
+
+private:
+   float m_CellSize;
+   float m_InverseCellSize;
+
+   // Proxies are indexed by slot, and the cells hold slots
+   EntitySlotMap m_Slots;
+   std::vector<Proxy> m_Proxies;
+   std::size_t m_Count;
+
+   std::unordered_map<MortonCode, std::vector<std::uint32_t>> m_Cells;
+
+   // Per proxy stamp of the last region query that reported it
+   mutable std::vector<std::uint32_t> m_QueryStamps;
+   mutable std::uint32_t m_QueryStamp;
+   mutable std::vector<MortonCode> m_SortedCellKeys;
+};
+} // namespace korin
@@ -0,0 +1,139 @@
+// sweep_and_prune.h
+//
+// Describes the SweepAndPrune class which is a broad-phase that keeps AABB endpoints sorted
+// on the X axis across frames and reports when pairs of entities begin and end overlapping.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "korin/entity.h"
+#include "korin/math/aabb.h"
+#include "korin/util/entity_slot_map.h"
+
+namespace korin
+{
+enum class OverlapEventType : std::uint8_t
+{
+   Begin,   // The pair started overlapping this update
+   Persist, // The pair was already overlapping last update
+   End      // The pair stopped overlapping or one of them was removed
+};
+
+struct OverlapEvent
+{
+   // Always the lower of the two EntityIDs
+   EntityID a;
+   EntityID b;
+   OverlapEventType type;
+};
+
+/// Sort and sweep broad-phase. Entities rarely move far between ticks so the endpoints
+/// stay nearly sorted and the insertion sort in updatePairs is close to linear. Both axes
+/// are sorted, and a pair can only start or stop overlapping when one of its endpoints 
+/// passes the other's, so the overlapping pairs are added and removed as the insertion sort 
+/// swaps endpoints. A tick costs as much as the endpoints that moved past each other.
+class SweepAndPrune
+{
+public:
+   SweepAndPrune();
+
+   // Adds an entity's bounds, or updates them if it is already tracked. 
+   // Inverted or NaN bounds are rejected.
+   void insert(EntityID entityID, const AABB& bounds);
+
+   // Moves an entity's bounds. Takes effect on the next updatePairs. 
+   // Inverted or NaN bounds are rejected and the old bounds kept.
+   void update(EntityID entityID, const AABB& bounds);
+
+   // Stops tracking an entity. Its pairs are reported as ended on the next updatePairs.
+   void remove(EntityID entityID);
+
+   bool contains(EntityID entityID) const;
+
+   // Number of entities being tracked
+   std::size_t size() const { return m_Count; }
+
+   // Re-sorts the endpoints and appends the pairs that began and ended overlapping since 
+   // the last update. Persisting pairs are only reported when includePersisting is set, 
+   // which visits every overlapping pair.
+   void updatePairs(std::vector<OverlapEvent>& events, bool includePersisting = false);
+
+   // Keys of the pairs that overlapped as of the last updatePairs
+   const std::set<std::uint64_t>& overlappingPairs() const { return m_Pairs; }
+
+   // Replaces the pairs the next updatePairs compares against, to resume from saved state.
+   // The next updatePairs sweeps every endpoint once to bring them back in step.
+   void restorePairs(const std::vector<std::uint64_t>& pairs);
+
+   static std::uint64_t pairKey(EntityID a, EntityID b);
+   static EntityID pairKeyFirst(std::uint64_t key) { return static_cast<EntityID>(key >> 32); }
+   static EntityID pairKeySecond(std::uint64_t key) { return static_cast<EntityID>(key & 0xFFFFFFFF); }
+
+private:
+   struct Endpoint
+   {
+      float value;
+      std::uint32_t slot;
+      bool isMax;
+
+      // Min endpoints sort before max endpoints at the same value so touching bounds overlap
+      bool operator<(const Endpoint& other) const
+      {
+         return value < other.value || (value == other.value && !isMax && other.isMax);
+      }
+   };
+
+   struct Proxy
+   {
+      AABB bounds;
+      EntityID entityID;
+      bool active;
+
+      // Removed proxies keep their endpoints until the next updatePairs
+      bool hasEndpoints;
+
+      // Position in the active list during a sweep
+      std::uint32_t sweepIndex;
+   };
+
+   static bool isValidBounds(const AABB& bounds);
+
+   void addPair(EntityID a, EntityID b, std::vector<OverlapEvent>& events);
+   void removePair(EntityID a, EntityID b, std::vector<OverlapEvent>& events);
+
+   void removeStaleEndpoints(std::vector<OverlapEvent>& events);
+
+   // Insertion sorts one axis and adds or removes pairs as endpoints pass each other
+   void sortAxis(std::vector<Endpoint>& endpoints, std::vector<OverlapEvent>& events);
+
+   // Sorts both axes from scratch and finds every pair with one sweep over X
+   void rebuildPairs(std::vector<OverlapEvent>& events);
+
+private:
+   // Proxies and endpoints refer to entities by slot. An entity keeps its slot 
+   // until its endpoints are dropped.
+   EntitySlotMap m_Slots;
+   std::vector<Proxy> m_Proxies;
+   std::size_t m_Count;
+
+   std::vector<Endpoint> m_EndpointsX;
+   std::vector<Endpoint> m_EndpointsY;
+   std::size_t m_InsertedSinceSort;
+   std::size_t m_RemovedSinceSort;
+
+   // Ordered so the pairs are visited the same way no matter how they were found
+   std::set<std::uint64_t> m_Pairs;
+   bool m_PairsRestored;
+
+   // Scratch space for rebuildPairs
+   std::vector<std::uint64_t> m_SweptPairs;
+   std::vector<std::uint32_t> m_Active;
+   std::vector<std::uint64_t> m_Begun;
+};
+} // namespace korin
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "korin/component.h"
@@ -22,11 +23,36 @@ public:
    /// Sends the time step to update the Component and potentially its siblings.
    virtual void update(float timeStep, const ComponentPtr& component) = 0;
 
+   /// Sends the time step to update every Component of the primary type at once.
+   /// Systems that process their Components in batches override this.
+   virtual void updateBatch(float timeStep, const std::vector<ComponentPtr>& components)
+   {
+      for (const auto& component : components)
+      {
+         update(timeStep, component);
+      }
+   }
+
    /// Notifies the System that a Component needs to be updated.
    virtual void notify(const ComponentPtr& component) = 0;
 
    /// Returns the ComponentTypeIDs of the required Components.
    virtual ComponentTypeID primaryComponentTypeID() const = 0;
+
+   /// Called after the world was put back to an earlier state, like a snapshot restore
+   /// or a scene load. Anything cached about the old components has to be dropped.
+   virtual void onWorldRestored() {}
+
+   /// State a System carries from tick to tick that changes the simulation, like warm
+   /// start impulses. Rollback saves it with every frame and loads it back after
+   /// onWorldRestored so resimulated ticks match the ones simulated on time.
+   virtual void saveState(std::vector<std::uint8_t>& state) const {}
+   virtual void loadState(const std::vector<std::uint8_t>& state) {}
+
+   /// Set while a rollback simulates ticks again that were already simulated once.
+   /// Systems that take something from outside the world, like events from an input
+   /// device, must leave it for the next real tick.
+   virtual void setResimulating(bool resimulating) {}
 };
 
 using SystemPtr = std::shared_ptr<System>;
@@ -0,0 +1,91 @@
+// system_schedule.h
+//
+// Describes the SystemSchedule class which groups systems into phases and sorts each
+// phase so every system runs after the systems it depends on.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "korin/system.h"
+
+namespace korin
+{
+/// Phases run in this order. Input and Simulation run once per fixed tick, so they run
+/// several times in a frame that catches up and again when a rollback resimulates.
+/// LateUpdate and Render run once per displayed frame.
+enum class SystemPhase : std::uint8_t
+{
+   Input,
+   Simulation,
+   LateUpdate,
+   Render
+};
+
+constexpr std::size_t SYSTEM_PHASE_COUNT = 4;
+
+/// Where a system goes in the schedule. The after and before lists name other systems
+/// of the same phase. Names that aren't registered are ignored, so a system can be
+/// ordered against one that is optional.
+///    {"Physics", SystemPhase::Simulation, {"Movement"}, {"Collision"}}
+struct SystemDesc
+{
+   // Every field has a default, so a description can leave off the ones it doesn't need
+   SystemDesc(std::string name = std::string(), SystemPhase phase = SystemPhase::Simulation,
+      std::vector<std::string> after = std::vector<std::string>(), std::vector<std::string> before = std::vector<std::string>())
+      : name(std::move(name)), phase(phase), after(std::move(after)), before(std::move(before)) {}
+
+   std::string name;
+   SystemPhase phase;
+   std::vector<std::string> after;
+   std::vector<std::string> before;
+};
+
+/// Systems without constraints between them keep the order they were added in. The
+/// phases are sorted again the next time they're used after a system was added or removed.
+class SystemSchedule
+{
+public:
+   SystemSchedule();
+
+   // Fails if the system was already added or another system has the same name
+   bool add(const SystemPtr& system, const SystemDesc& desc);
+   bool remove(const SystemPtr& system);
+   bool contains(const SystemPtr& system) const;
+   void clear();
+
+   // Systems of the phase in the order they run
+   const std::vector<SystemPtr>& phase(SystemPhase phase);
+
+   // Disabled phases are skipped, like Render on a dedicated server
+   void setPhaseEnabled(SystemPhase phase, bool enabled) { m_Enabled[static_cast<std::size_t>(phase)] = enabled; }
+   bool phaseEnabled(SystemPhase phase) const { return m_Enabled[static_cast<std::size_t>(phase)]; }
+
+   std::size_t size() const { return m_Entries.size(); }
+
+private:
+   struct Entry
+   {
+      SystemPtr system;
+      SystemDesc desc;
+   };
+
+   void sort();
+   void sortPhase(SystemPhase phase);
+
+private:
+   // In the order the systems were added
+   std::vector<Entry> m_Entries;
+
+   std::array<std::vector<SystemPtr>, SYSTEM_PHASE_COUNT> m_Phases;
+   std::array<bool, SYSTEM_PHASE_COUNT> m_Enabled;
+   bool m_Sorted;
+};
+} // namespace korin
@@ -0,0 +1,40 @@
+// camera_system.h
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <memory>
+
+#include "korin/system.h"
+#include "korin/components/camera_component.h"
+#include "korin/systems/render_system.h"
+
+namespace korin
+{
+/// Points the RenderSystem's view at the active CameraComponent with the highest
+/// priority. Runs in LateUpdate so the camera follows where its entity ended the frame.
+/// Without an active camera the view is left where it was.
+class CameraSystem : public System
+{
+public:
+   explicit CameraSystem(std::weak_ptr<RenderSystem> renderSystem);
+
+   // Request the CameraComponent type
+   virtual ComponentTypeID primaryComponentTypeID() const override
+   {
+      return Component::typeID<CameraComponent>();
+   }
+
+   virtual void notify(const ComponentPtr& component) override {}
+
+   virtual void update(float timeStep, const ComponentPtr& component) override;
+
+   // Picks the camera for this frame out of all of them
+   virtual void updateBatch(float timeStep, const std::vector<ComponentPtr>& components) override;
+
+private:
+   std::weak_ptr<RenderSystem> m_RenderSystem;
+};
+} // namespace korin
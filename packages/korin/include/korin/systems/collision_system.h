@@ -0,0 +1,128 @@
+// collision_system.h
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "korin/system.h"
+#include "korin/components/collider_component.h"
+#include "korin/components/physics_component.h"
+#include "korin/components/transform_component.h"
+#include "korin/physics/contact_solver.h"
+#include "korin/spatial/sweep_and_prune.h"
+
+namespace korin
+{
+/// Resolves contacts between every entity with a ColliderComponent and a TransformComponent.
+/// The sweep-and-prune broad phase reports the pairs whose bounds overlap, the narrow phase
+/// builds a contact manifold for each and the ContactSolver pushes the bodies apart. Pairs
+/// that stay in contact keep their impulses from tick to tick to warm start the solver.
+class CollisionSystem : public System
+{
+public:
+   CollisionSystem();
+
+   // Request the ColliderComponent type
+   virtual ComponentTypeID primaryComponentTypeID() const override
+   {
+      return Component::typeID<ColliderComponent>();
+   }
+
+   virtual void notify(const ComponentPtr& component) override {}
+
+   // Contacts involve pairs of colliders so a single collider only refreshes its broad-phase bounds
+   virtual void update(float timeStep, const ComponentPtr& component) override;
+
+   // Finds and resolves every contact between the colliders
+   virtual void updateBatch(float timeStep, const std::vector<ComponentPtr>& components) override;
+
+   // Starts over with an empty broad phase, solver cache and sibling cache
+   virtual void onWorldRestored() override;
+
+   // The pairs overlapping as of the last tick and the warm start impulses
+   virtual void saveState(std::vector<std::uint8_t>& state) const override;
+   virtual void loadState(const std::vector<std::uint8_t>& state) override;
+
+   const SweepAndPrune& broadPhase() const { return m_BroadPhase; }
+   ContactSolver& solver() { return m_Solver; }
+
+   // Contacts resolved by the last batch
+   const std::vector<ContactConstraint>& contacts() const { return m_Contacts; }
+
+private:
+   struct Body
+   {
+      ColliderComponent* collider;
+      TransformComponent* transform;
+
+      // Null for static colliders
+      PhysicsComponent* physics;
+
+      // Distance moved this tick, only tracked for bodies fast enough to tunnel
+      Vector2D displacement;
+      bool fast;
+
+      // Earliest swept impact this tick as a fraction of the displacement, 1 if none
+      float timeOfImpact;
+   };
+
+   // A pair of bodies that passed into each other during the tick
+   struct SweptPair
+   {
+      std::uint32_t bodyA;
+      std::uint32_t bodyB;
+      std::uint64_t key;
+      float timeOfImpact;
+
+      // Points back towards A
+      Vector2D normal;
+   };
+
+   // Cached sibling lookups for the collider at index in the last batch
+   void refreshSiblings(std::size_t index, ColliderComponent* collider);
+
+   bool isDynamic(const Body& body) const;
+
+   // Narrow phase between two bodies at their current positions
+   bool collide(const Body& a, const Body& b, Manifold& manifold) const;
+
+   // Catches fast bodies that passed through each other during the tick. Finds the
+   // time of impact without moving either body.
+   bool collideSwept(const Body& a, const Body& b, float& timeOfImpact, Vector2D& normal) const;
+
+   // Moves every body hit by a sweep back to its earliest impact, then adds the contacts
+   // of the swept pairs that touch there
+   void resolveSweptPairs();
+
+   void addContact(std::uint32_t indexA, std::uint32_t indexB, std::uint64_t key, const Manifold& manifold);
+
+private:
+   SweepAndPrune m_BroadPhase;
+   ContactSolver m_Solver;
+
+   std::vector<const Component*> m_CachedComponents;
+   std::vector<std::uint32_t> m_CachedSiblingsVersions;
+   std::vector<std::shared_ptr<TransformComponent>> m_CachedTransforms;
+   std::vector<std::shared_ptr<PhysicsComponent>> m_CachedPhysics;
+
+   std::vector<Body> m_Bodies;
+
+   // Index into m_Bodies of each tracked entity. EntityIDs are never reused, 
+   // so a table indexed by them would grow with every collider ever spawned.
+   std::unordered_map<EntityID, std::uint32_t> m_BodyIndices;
+
+   // Entities in the broad phase, to find the ones whose collider went away
+   std::vector<EntityID> m_Tracked;
+   std::vector<EntityID> m_Present;
+
+   std::vector<OverlapEvent> m_Events;
+   std::vector<SweptPair> m_SweptPairs;
+   std::vector<SolverBody> m_SolverBodies;
+   std::vector<ContactConstraint> m_Contacts;
+};
+} // namespace korin
@@ -5,19 +5,42 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
+#include <vector>
 
 #include "korin/system.h"
 #include "korin/component.h"
 #include "korin/components/input_stream_component.h"
+#include "korin/input/input_backend.h"
+#include "korin/input/input_recording.h"
+#include "korin/input/action_state_machine.h"
 
 namespace korin
 {
+enum class InputMode : std::uint8_t
+{
+   // Action states come from the backend
+   Live,
+
+   // Action states come from the backend and are recorded every tick
+   Recording,
+
+   // Action states come from a recording and the backend is ignored
+   Replaying
+};
+
 class GameInputSystem : public System
 {
 public:
+   // Reads the devices through the platform's backend
    GameInputSystem();
 
+   // Reads input from the given backend, or only from recordings and external
+   // streams without one
+   explicit GameInputSystem(std::unique_ptr<InputBackend> backend);
+   virtual ~GameInputSystem() override;
+
    // Request the InputStreamComponent type
    virtual ComponentTypeID primaryComponentTypeID() const override
    {
@@ -26,18 +49,88 @@ public:
 
    virtual void notify(const ComponentPtr& component) override {}
 
-   // Update method to process the input
+   // Updates a single input stream as a batch of one
    virtual void update(float timeStep, const ComponentPtr& component) override;
 
+   // Drains the input queue once and updates every input stream, then evaluates the holds,
+   // double taps and combos of all of them in one pass. Each call is one tick of a 
+   // recording or replay.
+   virtual void updateBatch(float timeStep, const std::vector<ComponentPtr>& components) override;
+
+   // Resimulated ticks leave the backend's queue alone and only use the external states
+   // the rollback stored for each tick
+   virtual void setResimulating(bool resimulating) override { m_Resimulating = resimulating; }
+
+   // Replaces the backend, stopping the old one and starting the new one
+   void setBackend(std::unique_ptr<InputBackend> backend);
+   InputBackend* backend() const { return m_Backend.get(); }
+
+   // Latest value received on an axis
+   float axisValue(std::uint16_t axis) const { return axis < INPUT_AXIS_COUNT ? m_AxisValues[axis] : 0.0f; }
+
+   // Sum of the values received on an axis during the last frame, for relative axes like the mouse
+   float axisDelta(std::uint16_t axis) const { return axis < INPUT_AXIS_COUNT ? m_AxisDeltas[axis] : 0.0f; }
+
+   // Starts a new recording of every tick from now on
+   void startRecording();
+
+   // Replays a recording from its first tick. Live input resumes when it runs out.
+   bool startReplay(std::vector<std::uint8_t> recording);
+
+   // Stops recording or replaying. A finished recording stays available from recorder().
+   void resumeLiveInput();
+
+   InputMode mode() const { return m_Mode; }
+   const InputRecorder& recorder() const { return m_Recorder; }
+   const InputPlayer& player() const { return m_Player; }
+
+   // Hold and double tap timings and the combos shared by every stream
+   ActionStateMachine& actionStateMachine() { return m_ActionStateMachine; }
+
 public:
    bool consumed;
 
 private:
-   // Assuming that ButtonStates and PreviousButtonStates 
-   // are valid, generate ButtonDowns and ButtonUps
-   void updateButtonUpDownEvents(const std::shared_ptr<InputStreamComponent>& inputStream);
-   void requestListenEventAccess() const;
-   void assignDefaultGameActions() const;
-   uint64_t pollKeyCodes() const;
+   // Applies every queued event to the pressed state and maps it to GameActions
+   void drainEvents();
+
+   // Pops every event the backend has queued into the pressed state
+   void pollBackend();
+
+   // Writes the GameAction states of the drained frame into every stream, finding the
+   // begun and ended actions of all of them with one call to computeActionEdges
+   void updateActionStates(const std::vector<ComponentPtr>& inputStreams);
+
+   static void assignDefaultGameActions();
+
+private:
+   std::unique_ptr<InputBackend> m_Backend;
+
+   InputMode m_Mode;
+   bool m_Resimulating;
+   InputRecorder m_Recorder;
+   InputPlayer m_Player;
+   ActionStateMachine m_ActionStateMachine;
+
+   // Inputs held down right now
+   InputState m_PressedInputs;
+
+   // Inputs pressed or released at any point during the last frame. A tap shorter 
+   // than a frame shows up in both even though it is no longer held.
+   InputState m_PressedThisFrame;
+   InputState m_ReleasedThisFrame;
+
+   // GameActions of the inputs above, shared by every Local stream
+   ActionMask m_LocalActions;
+   ActionMask m_LocalActionsPressed;
+   ActionMask m_LocalActionsReleased;
+
+   // Structure-of-arrays scratch space for computeActionEdges. Holds six 
+   // runs of masks, one mask per stream in each: previous, current, 
+   // pressed, released, begun and ended.
+   std::vector<ActionMask> m_EdgeMasks;
+
+   std::array<float, INPUT_AXIS_COUNT> m_AxisValues;
+   std::array<float, INPUT_AXIS_COUNT> m_AxisDeltas;
 };
-} // namespace korin
\ No newline at end of file
+} // namespace korin
@@ -13,7 +13,6 @@
 #include "korin/system.h"
 #include "korin/component.h"
 #include "korin/components/transform_component.h"
-#include "korin/util/game_action_util.h"
 
 namespace korin
 {
@@ -31,9 +30,5 @@ public:
 
    // Update method to move the TransformComponents
    virtual void update(float timeStep, const ComponentPtr& component) override;
-
-private:
-   bool didActionBegin(GameAction action, const std::shared_ptr<InputStreamComponent>& inputStream) const;
-   bool didActionContinue(GameAction action, const std::shared_ptr<InputStreamComponent>& inputStream) const;
 };
 } // namespace korin
\ No newline at end of file
@@ -0,0 +1,71 @@
+// physics_system.h
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "korin/system.h"
+#include "korin/components/physics_component.h"
+#include "korin/components/transform_component.h"
+
+namespace korin
+{
+/// Integrates the velocity and acceleration of every awake PhysicsComponent into its
+/// sibling TransformComponent. Bodies are copied into structure-of-arrays buffers so
+/// the integration runs as one vectorized pass, then copied back.
+class PhysicsSystem : public System
+{
+public:
+   PhysicsSystem();
+
+   // Request the PhysicsComponent type
+   virtual ComponentTypeID primaryComponentTypeID() const override
+   {
+      return Component::typeID<PhysicsComponent>();
+   }
+
+   virtual void notify(const ComponentPtr& component) override {}
+
+   // Integrates a single body
+   virtual void update(float timeStep, const ComponentPtr& component) override;
+
+   // Integrates every awake body in one batch
+   virtual void updateBatch(float timeStep, const std::vector<ComponentPtr>& components) override;
+
+   // Drops the cached sibling lookups
+   virtual void onWorldRestored() override;
+
+public:
+   // Bodies slower than this (units per second) start counting towards sleep
+   float sleepVelocity;
+
+   // Seconds a body must stay slow with no acceleration before it falls asleep
+   float timeToSleep;
+
+private:
+   // Counts down to sleep for bodies at rest. Returns true if the body fell asleep.
+   bool updateSleep(float timeStep, PhysicsComponent& body) const;
+
+private:
+   struct Body
+   {
+      PhysicsComponent* physics;
+      TransformComponent* transform;
+   };
+
+   // Cached sibling lookups, parallel to the component list of the last batch
+   std::vector<const Component*> m_CachedComponents;
+   std::vector<std::uint32_t> m_CachedSiblingsVersions;
+   std::vector<std::shared_ptr<TransformComponent>> m_CachedTransforms;
+
+   // Structure-of-arrays buffers for the awake bodies of the current batch
+   std::vector<Body> m_Awake;
+   std::vector<float> m_PositionX, m_PositionY;
+   std::vector<float> m_VelocityX, m_VelocityY;
+   std::vector<float> m_AccelerationX, m_AccelerationY;
+};
+} // namespace korin
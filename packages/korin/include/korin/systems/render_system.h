@@ -5,25 +5,67 @@
 
 #pragma once
 
+#include <memory>
+
 #include "korin/system.h"
-#include "korin/components/transform_component.h"
+#include "korin/math/aabb.h"
+#include "korin/components/sprite_component.h"
+#include "korin/render/render_backend.h"
+#include "korin/render/render_thread.h"
+#include "korin/render/sprite_batcher.h"
 
 namespace korin
 {
+/// Draws every visible SpriteComponent once per frame. The sprites are batched by
+/// layer and texture and handed to the backend one batch per draw call. Sprites
+/// outside of the view are culled before they are sorted. The view follows the
+/// active camera when there is a CameraSystem. With the render thread started the
+/// frame is only recorded here and drawn on the render thread.
 class RenderSystem : public System
 {
 public:
-   RenderSystem() {}
+   RenderSystem();
 
-   // Request the TransformComponent type
+   // Request the SpriteComponent type
    virtual ComponentTypeID primaryComponentTypeID() const override
    {
-      return Component::typeID<TransformComponent>();
+      return Component::typeID<SpriteComponent>();
    }
 
    virtual void notify(const ComponentPtr& component) override {}
 
-   // Update method to process the input
    virtual void update(float timeStep, const ComponentPtr& component) override;
+
+   // Draws one frame of all the sprites
+   virtual void updateBatch(float timeStep, const std::vector<ComponentPtr>& components) override;
+
+   // Null stops drawing while still batching. Stops the render thread.
+   void setBackend(std::unique_ptr<RenderBackend> backend);
+
+   // Owned by the render thread while it runs, so only read it from here once it's stopped
+   RenderBackend* backend() const;
+
+   // Hands the backend to a new render thread. Fails without a backend or if it's already started.
+   bool startRenderThread();
+
+   // Draws the frames still waiting and takes the backend back
+   void stopRenderThread();
+
+   // Null unless the render thread was started
+   const RenderThread* renderThread() const { return m_RenderThread.get(); }
+
+   const SpriteBatcher& batcher() const { return m_Batcher; }
+
+   // World area the view shows on the backend
+   AABB visibleArea() const;
+
+public:
+   // Part of the world that is drawn
+   RenderView view;
+
+private:
+   std::unique_ptr<RenderBackend> m_Backend;
+   std::unique_ptr<RenderThread> m_RenderThread;
+   SpriteBatcher m_Batcher;
 };
-} // namespace korin
\ No newline at end of file
+} // namespace korin
@@ -0,0 +1,51 @@
+// spatial_query_system.h
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <vector>
+
+#include "korin/system.h"
+#include "korin/components/bounds_component.h"
+#include "korin/spatial/spatial_hash_grid.h"
+
+namespace korin
+{
+/// Keeps a SpatialHashGrid in sync with the world bounds of every entity 
+/// that has a BoundsComponent and a TransformComponent.
+class SpatialQuerySystem : public System
+{
+public:
+   explicit SpatialQuerySystem(float cellSize = 4.0f)
+      : m_Grid(cellSize), m_Tracked(std::vector<EntityID>()), m_Present(std::vector<EntityID>()) {}
+
+   // Request the BoundsComponent type
+   virtual ComponentTypeID primaryComponentTypeID() const override
+   {
+      return Component::typeID<BoundsComponent>();
+   }
+
+   virtual void notify(const ComponentPtr& component) override {}
+
+   // Update method to re-index the bounds of moved entities
+   virtual void update(float timeStep, const ComponentPtr& component) override;
+
+   // Updates every entity and removes the ones whose bounds are gone
+   virtual void updateBatch(float timeStep, const std::vector<ComponentPtr>& components) override;
+
+   // The index built from the last update for region, point and pair queries
+   const SpatialHashGrid& grid() const { return m_Grid; }
+
+private:
+   // Writes the entity's bounds to the grid and returns false if it has no transform
+   bool index(const BoundsComponent& bounds);
+
+   SpatialHashGrid m_Grid;
+
+   // Entities in the grid after the last batch and the ones seen in this batch
+   std::vector<EntityID> m_Tracked;
+   std::vector<EntityID> m_Present;
+};
+} // namespace korin
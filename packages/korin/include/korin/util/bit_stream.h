@@ -0,0 +1,154 @@
+// bit_stream.h
+//
+// Describes the BitWriter and BitReader classes which pack values into the fewest bits
+// they need, for data that goes over the network.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace korin
+{
+/// Appends bits to a byte buffer, lowest bit first. Call flush once everything is
+/// written to push out the last partial byte.
+class BitWriter
+{
+public:
+   explicit BitWriter(std::vector<std::uint8_t>& buffer)
+      : m_Buffer(buffer), m_Scratch(0), m_ScratchBits(0), m_BitCount(0) {}
+
+   // Writes the low bitCount bits of the value, up to 64
+   void writeBits(std::uint64_t value, std::uint32_t bitCount)
+   {
+      while (bitCount > 0)
+      {
+         const std::uint32_t chunk = bitCount < 32 ? bitCount : 32;
+         const std::uint64_t bits = value & ((1ULL << chunk) - 1);
+         m_Scratch |= bits << m_ScratchBits;
+         m_ScratchBits += chunk;
+         m_BitCount += chunk;
+         value = chunk < 64 ? value >> chunk : 0;
+         bitCount -= chunk;
+
+         while (m_ScratchBits >= 8)
+         {
+            m_Buffer.push_back(static_cast<std::uint8_t>(m_Scratch));
+            m_Scratch >>= 8;
+            m_ScratchBits -= 8;
+         }
+      }
+   }
+
+   void writeBool(bool value) { writeBits(value ? 1 : 0, 1); }
+
+   // Small values take few bits: a 2 bit size class picks 4, 10, 20 or 36 bits for the value
+   void writeVarBits(std::uint64_t value)
+   {
+      static constexpr std::uint32_t WIDTHS[4] = {4, 10, 20, 36};
+      std::uint32_t sizeClass = 0;
+      while (sizeClass < 3 && value >= (1ULL << WIDTHS[sizeClass]))
+      {
+         sizeClass++;
+      }
+      writeBits(sizeClass, 2);
+      writeBits(value, WIDTHS[sizeClass]);
+   }
+
+   // Signed values are zigzag encoded first so small negative values stay small
+   void writeSignedVarBits(std::int64_t value)
+   {
+      writeVarBits((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+   }
+
+   void flush()
+   {
+      if (m_ScratchBits > 0)
+      {
+         m_Buffer.push_back(static_cast<std::uint8_t>(m_Scratch));
+         m_Scratch = 0;
+         m_ScratchBits = 0;
+      }
+   }
+
+   std::size_t bitCount() const { return m_BitCount; }
+
+private:
+   std::vector<std::uint8_t>& m_Buffer;
+   std::uint64_t m_Scratch;
+   std::uint32_t m_ScratchBits;
+   std::size_t m_BitCount;
+};
+
+/// Reads what a BitWriter wrote. Every read returns false instead of running past
+/// the end, and once a read fails the reader stays failed.
+class BitReader
+{
+public:
+   BitReader(const std::uint8_t* data, std::size_t size)
+      : m_Data(data), m_BitSize(size * 8), m_BitPosition(0), m_Failed(false) {}
+
+   bool readBits(std::uint64_t& value, std::uint32_t bitCount)
+   {
+      if (m_Failed || bitCount > 64 || bitCount > m_BitSize - m_BitPosition)
+      {
+         m_Failed = true;
+         return false;
+      }
+
+      value = 0;
+      for (std::uint32_t bit = 0; bit < bitCount;)
+      {
+         const std::size_t byte = m_BitPosition >> 3;
+         const std::uint32_t offset = static_cast<std::uint32_t>(m_BitPosition & 7);
+         const std::uint32_t take = (8 - offset) < (bitCount - bit) ? (8 - offset) : (bitCount - bit);
+         const std::uint64_t bits = (m_Data[byte] >> offset) & ((1u << take) - 1);
+         value |= bits << bit;
+         bit += take;
+         m_BitPosition += take;
+      }
+      return true;
+   }
+
+   bool readBool(bool& value)
+   {
+      std::uint64_t bit = 0;
+      if (!readBits(bit, 1))
+      {
+         return false;
+      }
+      value = bit != 0;
+      return true;
+   }
+
+   bool readVarBits(std::uint64_t& value)
+   {
+      static constexpr std::uint32_t WIDTHS[4] = {4, 10, 20, 36};
+      std::uint64_t sizeClass = 0;
+      return readBits(sizeClass, 2) && readBits(value, WIDTHS[sizeClass]);
+   }
+
+   bool readSignedVarBits(std::int64_t& value)
+   {
+      std::uint64_t zigzag = 0;
+      if (!readVarBits(zigzag))
+      {
+         return false;
+      }
+      value = static_cast<std::int64_t>(zigzag >> 1) ^ -static_cast<std::int64_t>(zigzag & 1);
+      return true;
+   }
+
+   bool failed() const { return m_Failed; }
+
+private:
+   const std::uint8_t* m_Data;
+   std::size_t m_BitSize;
+   std::size_t m_BitPosition;
+   bool m_Failed;
+};
+} // namespace korin
@@ -0,0 +1,51 @@
+// bit_util.h
+//
+// Portable helpers for iterating and counting the set bits of masks.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace korin
+{
+// Index of the lowest set bit. The mask must not be zero.
+inline int countTrailingZeros(std::uint32_t mask)
+{
+   #if defined(_MSC_VER)
+      unsigned long index;
+      _BitScanForward(&index, mask);
+      return static_cast<int>(index);
+   #else
+      return __builtin_ctz(mask);
+   #endif
+}
+
+// Index of the lowest set bit. The mask must not be zero.
+inline int countTrailingZeros(std::uint64_t mask)
+{
+   #if defined(_MSC_VER)
+      unsigned long index;
+      _BitScanForward64(&index, mask);
+      return static_cast<int>(index);
+   #else
+      return __builtin_ctzll(mask);
+   #endif
+}
+
+// Number of set bits
+inline int popCount(std::uint64_t mask)
+{
+   #if defined(_MSC_VER)
+      return static_cast<int>(__popcnt64(mask));
+   #else
+      return __builtin_popcountll(mask);
+   #endif
+}
+} // namespace korin
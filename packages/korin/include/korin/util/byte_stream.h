@@ -0,0 +1,196 @@
+// byte_stream.h
+//
+// Describes the ByteWriter and ByteReader classes which write and read little-endian 
+// binary data with variable length integers.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace korin
+{
+/// Appends to a byte buffer. Fixed width values are little-endian no matter the platform.
+class ByteWriter
+{
+public:
+   explicit ByteWriter(std::vector<std::uint8_t>& buffer)
+      : m_Buffer(buffer) {}
+
+   void writeU8(std::uint8_t value) { m_Buffer.push_back(value); }
+   void writeU16(std::uint16_t value) { writeLittleEndian(value, 2); }
+   void writeU32(std::uint32_t value) { writeLittleEndian(value, 4); }
+   void writeU64(std::uint64_t value) { writeLittleEndian(value, 8); }
+
+   void writeF32(float value)
+   {
+      std::uint32_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      writeU32(bits);
+   }
+
+   // Seven bits per byte, so small values take a single byte
+   void writeVarint(std::uint64_t value)
+   {
+      while (value >= 0x80)
+      {
+         m_Buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+         value >>= 7;
+      }
+      m_Buffer.push_back(static_cast<std::uint8_t>(value));
+   }
+
+   void writeBytes(const void* data, std::size_t size)
+   {
+      const auto* bytes = static_cast<const std::uint8_t*>(data);
+      m_Buffer.insert(m_Buffer.end(), bytes, bytes + size);
+   }
+
+   // Overwrites a value written earlier, for headers filled in after the fact
+   void patchU32(std::size_t offset, std::uint32_t value)
+   {
+      for (std::size_t i = 0; i < 4; i++)
+      {
+         m_Buffer[offset + i] = static_cast<std::uint8_t>(value >> (i * 8));
+      }
+   }
+
+   std::size_t size() const { return m_Buffer.size(); }
+
+private:
+   void writeLittleEndian(std::uint64_t value, std::size_t byteCount)
+   {
+      for (std::size_t i = 0; i < byteCount; i++)
+      {
+         m_Buffer.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+      }
+   }
+
+private:
+   std::vector<std::uint8_t>& m_Buffer;
+};
+
+/// Reads what a ByteWriter wrote. Every read returns false instead of running past 
+/// the end, and once a read fails the reader stays failed.
+class ByteReader
+{
+public:
+   ByteReader(const std::uint8_t* data, std::size_t size)
+      : m_Data(data), m_Size(size), m_Position(0), m_Failed(false) {}
+
+   explicit ByteReader(const std::vector<std::uint8_t>& buffer)
+      : ByteReader(buffer.data(), buffer.size()) {}
+
+   bool readU8(std::uint8_t& value) { return readLittleEndian(value, 1); }
+   bool readU16(std::uint16_t& value) { return readLittleEndian(value, 2); }
+   bool readU32(std::uint32_t& value) { return readLittleEndian(value, 4); }
+   bool readU64(std::uint64_t& value) { return readLittleEndian(value, 8); }
+
+   bool readF32(float& value)
+   {
+      std::uint32_t bits;
+      if (!readU32(bits))
+      {
+         return false;
+      }
+      std::memcpy(&value, &bits, sizeof(value));
+      return true;
+   }
+
+   bool readVarint(std::uint64_t& value)
+   {
+      value = 0;
+      for (std::uint32_t shift = 0; shift < 64; shift += 7)
+      {
+         std::uint8_t byte;
+         if (!readU8(byte))
+         {
+            return false;
+         }
+
+         value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+         if ((byte & 0x80) == 0)
+         {
+            return true;
+         }
+      }
+
+      // More than ten bytes can't be a valid 64 bit value
+      m_Failed = true;
+      return false;
+   }
+
+   bool readVarint(std::uint32_t& value)
+   {
+      std::uint64_t wide;
+      if (!readVarint(wide) || wide > UINT32_MAX)
+      {
+         m_Failed = true;
+         return false;
+      }
+      value = static_cast<std::uint32_t>(wide);
+      return true;
+   }
+
+   bool readBytes(void* data, std::size_t size)
+   {
+      if (m_Failed || size > m_Size - m_Position)
+      {
+         m_Failed = true;
+         return false;
+      }
+      std::memcpy(data, m_Data + m_Position, size);
+      m_Position += size;
+      return true;
+   }
+
+   // Skips ahead without copying. Returns null if there aren't enough bytes left.
+   const std::uint8_t* skip(std::size_t size)
+   {
+      if (m_Failed || size > m_Size - m_Position)
+      {
+         m_Failed = true;
+         return nullptr;
+      }
+      const std::uint8_t* start = m_Data + m_Position;
+      m_Position += size;
+      return start;
+   }
+
+   std::size_t position() const { return m_Position; }
+   std::size_t remaining() const { return m_Size - m_Position; }
+   bool atEnd() const { return m_Position == m_Size; }
+   bool failed() const { return m_Failed; }
+
+private:
+   template <typename T>
+   bool readLittleEndian(T& value, std::size_t byteCount)
+   {
+      if (m_Failed || byteCount > m_Size - m_Position)
+      {
+         m_Failed = true;
+         return false;
+      }
+
+      std::uint64_t result = 0;
+      for (std::size_t i = 0; i < byteCount; i++)
+      {
+         result |= static_cast<std::uint64_t>(m_Data[m_Position + i]) << (i * 8);
+      }
+      m_Position += byteCount;
+      value = static_cast<T>(result);
+      return true;
+   }
+
+private:
+   const std::uint8_t* m_Data;
+   std::size_t m_Size;
+   std::size_t m_Position;
+   bool m_Failed;
+};
+} // namespace korin
@@ -0,0 +1,51 @@
+// entity_slot_map.h
+//
+// Describes the EntitySlotMap class which gives each EntityID a small reusable slot
+// so per-entity tables can be indexed densely.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "korin/entity.h"
+
+namespace korin
+{
+/// EntityIDs are never reused, so a table indexed by EntityID grows with every entity
+/// ever spawned. Indexing it by slot instead keeps it as large as the most entities
+/// that were in it at once. Released slots are handed out again before new ones.
+class EntitySlotMap
+{
+public:
+   static constexpr std::uint32_t NO_SLOT = UINT32_MAX;
+
+   EntitySlotMap();
+
+   // The entity's slot, or NO_SLOT if it has none
+   std::uint32_t find(EntityID entityID) const;
+
+   // The entity's slot, giving it one if it has none
+   std::uint32_t assign(EntityID entityID);
+
+   // Frees the entity's slot for another entity
+   void release(EntityID entityID);
+
+   void clear();
+
+   // One past the highest slot handed out, which is the size a table indexed by slot needs
+   std::uint32_t slotCount() const { return static_cast<std::uint32_t>(m_Entities.size()); }
+
+   // The entity in a slot, or INVALID_ENTITY_ID if the slot is free
+   EntityID entityAt(std::uint32_t slot) const { return m_Entities[slot]; }
+
+private:
+   std::unordered_map<EntityID, std::uint32_t> m_Slots;
+   std::vector<EntityID> m_Entities;
+   std::vector<std::uint32_t> m_FreeSlots;
+};
+} // namespace korin
@@ -0,0 +1,53 @@
+// file_watcher.h
+//
+// Describes the FileWatcher class which notices when files on disk change.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace korin
+{
+/// Polls the modification time and size of each watched file. Polling works the same
+/// on every platform and a few stat calls a frame cost nothing next to a reload. A
+/// file that is missing, like one an editor is in the middle of replacing, is skipped
+/// until it comes back.
+class FileWatcher
+{
+public:
+   using Callback = std::function<void(const std::string& path)>;
+
+   FileWatcher();
+
+   // Changes from now on call the callback. Watching a path again replaces its callback.
+   void watch(const std::string& path, Callback onChanged);
+   void unwatch(const std::string& path);
+
+   // Calls the callback of every file that changed since the last poll. Returns how many did.
+   std::size_t poll();
+
+   std::size_t size() const { return m_Files.size(); }
+
+private:
+   struct WatchedFile
+   {
+      std::string path;
+      Callback onChanged;
+      std::filesystem::file_time_type modified;
+      std::uintmax_t size;
+   };
+
+   // False if the file can't be read right now
+   static bool stamp(const std::string& path, std::filesystem::file_time_type& modified, std::uintmax_t& size);
+
+private:
+   std::vector<WatchedFile> m_Files;
+};
+} // namespace korin
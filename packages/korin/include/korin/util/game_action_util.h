@@ -5,45 +5,26 @@
 
 #pragma once
 
-#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
 #include "korin/log.h"
+#include "korin/input/action_mask.h"
+#include "korin/input/input_event.h"
+#include "korin/util/bit_util.h"
 
 namespace korin
 {
-enum class GameAction : uint64_t
-{
-   // Menu
-   Menu = 1 << 0,
-   Confirm = 1 << 1,
-   Cancel = 1 << 2,
-
-   // Movement
-   MoveForward = 1 << 3,
-   MoveBackward = 1 << 4,
-   MoveRight = 1 << 5,
-   MoveLeft = 1 << 6,
-   RotateRight = 1 << 7,
-   RotateLeft = 1 << 8,
-   Crouch = 1 << 9,
-   Sprint = 1 << 10,
-   Jump = 1 << 11,
-
-   // Camera
-   LookUp = 1 << 12,
-   LookDown = 1 << 13,
-   LookLeft = 1 << 14,
-   LookRight = 1 << 15,
-
-   // Actions
-   PrimaryAbility = 1 << 16,
-   SecondaryAbility = 1 << 17,
-   TertiaryAbility = 1 << 18,
-   QuaternaryAbility = 1 << 19,
-
-   Any = 0xFFFFFF,
-   None = 0
-};
-
+/// Maps raw input codes to GameAction bits. Bindings are compiled into a dense table
+/// indexed by input code, so mapping the pressed inputs to actions walks only the set
+/// bits of the InputState with no hashing. A key may trigger several actions and an 
+/// action may be bound to several keys or chords.
+///
+/// Every world reads the same bindings without locking, so bind everything before
+/// worlds run on their own threads.
 class GameActionUtil
 {
 public:
@@ -58,32 +39,162 @@ public:
 
    void mapInputToAction(uint64_t input, GameAction action)
    {
-      m_ActionsByInput[input] = action;
-      KORIN_INFO("Mapped Keycode:{0}", input, " with Action:{0}", static_cast<uint64_t>(action));
+      if (input >= INPUT_CODE_COUNT)
+      {
+         KORIN_CORE_WARN("Keycode(" + std::to_string(input) + ") is outside of the input code range.");
+         return;
+      }
+
+      m_ActionsByInput[input] |= toMask(action);
+      KORIN_INFO("Mapped Keycode:{0}", input, " with Action:{0}", toMask(action));
    }
 
-   uint64_t getActionsForInput(uint64_t input)
+   // Binds an action to inputs that must all be held together. While a chord is held 
+   // its inputs don't also trigger their own single input actions.
+   bool mapChordToAction(std::initializer_list<std::uint16_t> inputs, GameAction action)
    {
-      uint64_t actions = 0;
-      for (const auto& [key, value] : m_ActionsByInput)
+      if (inputs.size() < 2 || inputs.size() > MAX_CHORD_INPUTS)
       {
-         if ((1ULL << key) & input)
+         KORIN_CORE_WARN("Chords need between 2 and " + std::to_string(MAX_CHORD_INPUTS) + " inputs.");
+         return false;
+      }
+
+      Chord chord = {};
+      for (const std::uint16_t input : inputs)
+      {
+         if (input >= INPUT_CODE_COUNT)
          {
-            actions |= static_cast<uint64_t>(value);
+            KORIN_CORE_WARN("Keycode(" + std::to_string(input) + ") is outside of the input code range.");
+            return false;
          }
+         chord.inputs.set(input);
+         chord.anchor = chord.inputCount == 0 ? input : std::min(chord.anchor, input);
+         chord.inputCount++;
+      }
+      chord.actions = toMask(action);
+
+      m_Chords.push_back(chord);
+      compileChords();
+      return true;
+   }
+
+   // Removes every action bound to the input on its own. Chords are left alone.
+   void unmapInput(uint64_t input)
+   {
+      if (input < INPUT_CODE_COUNT)
+      {
+         m_ActionsByInput[input] = 0;
+      }
+   }
+
+   void clearMappings()
+   {
+      m_ActionsByInput.fill(0);
+      m_Chords.clear();
+      compileChords();
+   }
+
+   ActionMask getActionsForInput(const InputState& input) const
+   {
+      ActionMask actions = 0;
+
+      // Chords are only checked when one of their anchors is held
+      InputState consumed;
+      InputState heldAnchors = input & m_ChordAnchors;
+      if (!heldAnchors.none())
+      {
+         forEachInput(heldAnchors, [&](std::uint16_t anchor)
+         {
+            for (std::uint32_t i = m_ChordOffsets[anchor]; i < m_ChordOffsets[anchor + 1]; i++)
+            {
+               const Chord& chord = m_SortedChords[i];
+               if ((input & chord.inputs) == chord.inputs)
+               {
+                  actions |= chord.actions;
+                  consumed |= chord.inputs;
+               }
+            }
+         });
       }
 
+      forEachInput(consumed.none() ? input : input & ~consumed, [&](std::uint16_t code)
+      {
+         actions |= m_ActionsByInput[code];
+      });
+
       return actions;
    }
 
-   std::unordered_map<uint64_t, GameAction> getActionsByInput() const
+   // Actions bound to the input on its own
+   ActionMask getActionsForInputCode(std::uint16_t input) const
+   {
+      return input < INPUT_CODE_COUNT ? m_ActionsByInput[input] : 0;
+   }
+
+public:
+   static constexpr std::size_t MAX_CHORD_INPUTS = 4;
+
+private:
+   struct Chord
+   {
+      InputState inputs;
+      std::uint16_t anchor;
+      std::uint16_t inputCount;
+      ActionMask actions;
+   };
+
+   GameActionUtil()
+      : m_ActionsByInput(), m_Chords(std::vector<Chord>()), m_SortedChords(std::vector<Chord>()), m_ChordOffsets() {}
+
+   // Calls the function with each set input code, lowest first
+   template <typename Function>
+   static void forEachInput(const InputState& input, Function&& function)
+   {
+      for (std::size_t word = 0; word < InputState::WORD_COUNT; word++)
+      {
+         std::uint64_t bits = input.words[word];
+         while (bits)
+         {
+            function(static_cast<std::uint16_t>(word * 64 + countTrailingZeros(bits)));
+            bits &= bits - 1;
+         }
+      }
+   }
+
+   // Groups the chords by their lowest input so a lookup only visits chords that could be held
+   void compileChords()
    {
-      return m_ActionsByInput;
+      m_ChordOffsets.fill(0);
+      m_ChordAnchors.reset();
+      for (const Chord& chord : m_Chords)
+      {
+         m_ChordOffsets[chord.anchor + 1]++;
+         m_ChordAnchors.set(chord.anchor);
+      }
+
+      for (std::size_t code = 0; code < INPUT_CODE_COUNT; code++)
+      {
+         m_ChordOffsets[code + 1] += m_ChordOffsets[code];
+      }
+
+      m_SortedChords.resize(m_Chords.size());
+      std::array<std::uint32_t, INPUT_CODE_COUNT> cursors;
+      std::copy(m_ChordOffsets.begin(), m_ChordOffsets.end() - 1, cursors.begin());
+      for (const Chord& chord : m_Chords)
+      {
+         m_SortedChords[cursors[chord.anchor]++] = chord;
+      }
    }
 
 private:
-   GameActionUtil() = default;
+   // Actions of every input code pressed on its own
+   std::array<ActionMask, INPUT_CODE_COUNT> m_ActionsByInput;
 
-   std::unordered_map<uint64_t, GameAction> m_ActionsByInput;
+   // Chords in the order they were bound, and grouped by anchor. The chords anchored 
+   // on an input are m_SortedChords[m_ChordOffsets[input], m_ChordOffsets[input + 1]).
+   std::vector<Chord> m_Chords;
+   std::vector<Chord> m_SortedChords;
+   std::array<std::uint32_t, INPUT_CODE_COUNT + 1> m_ChordOffsets;
+   InputState m_ChordAnchors;
 };
 } // namespace korin
\ No newline at end of file
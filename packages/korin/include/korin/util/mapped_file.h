@@ -0,0 +1,44 @@
+// mapped_file.h
+//
+// Describes the MappedFile class which maps a whole file read only into memory.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace korin
+{
+/// Read only view of a file. Nothing is copied; the OS pages the file in as it is
+/// read. The mapping starts on a page boundary, so offsets aligned in the file are
+/// aligned in memory too. Empty files can't be mapped.
+class MappedFile
+{
+public:
+   MappedFile();
+   ~MappedFile();
+
+   MappedFile(const MappedFile&) = delete;
+   MappedFile& operator=(const MappedFile&) = delete;
+
+   bool open(const std::string& path);
+   void close();
+
+   bool isOpen() const { return m_Data != nullptr; }
+
+   // Valid until the file is closed
+   const std::uint8_t* data() const { return m_Data; }
+   std::size_t size() const { return m_Size; }
+
+private:
+   const std::uint8_t* m_Data;
+   std::size_t m_Size;
+
+   // Platform handle of the mapping
+   void* m_Mapping;
+};
+} // namespace korin
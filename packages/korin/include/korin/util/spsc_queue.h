@@ -0,0 +1,95 @@
+// spsc_queue.h
+//
+// Describes the SPSCQueue class, a bounded lock-free queue for handing values from one
+// producer thread to one consumer thread.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace korin
+{
+// Size of a cache line on the platforms we target
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+/// Ring buffer where exactly one thread pushes and exactly one other thread pops.
+/// Neither side ever blocks or takes a lock. The head and tail live on their own
+/// cache lines and each side keeps a cached copy of the other's index, so the
+/// shared indices are only read when the queue looks full or empty.
+template <typename T, std::size_t Capacity>
+class SPSCQueue
+{
+   static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SPSCQueue capacity must be a power of two");
+
+public:
+   SPSCQueue()
+      : m_Head(0), m_CachedTail(0), m_Tail(0), m_CachedHead(0) {}
+
+   SPSCQueue(const SPSCQueue&) = delete;
+   SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+   // Producer only. Returns false without blocking if the queue is full.
+   bool tryPush(const T& value)
+   {
+      const std::size_t tail = m_Tail.load(std::memory_order_relaxed);
+      if (tail - m_CachedHead == Capacity)
+      {
+         m_CachedHead = m_Head.load(std::memory_order_acquire);
+         if (tail - m_CachedHead == Capacity)
+         {
+            return false;
+         }
+      }
+
+      m_Slots[tail & MASK] = value;
+      m_Tail.store(tail + 1, std::memory_order_release);
+      return true;
+   }
+
+   // Consumer only. Returns false without blocking if the queue is empty.
+   bool tryPop(T& value)
+   {
+      const std::size_t head = m_Head.load(std::memory_order_relaxed);
+      if (head == m_CachedTail)
+      {
+         m_CachedTail = m_Tail.load(std::memory_order_acquire);
+         if (head == m_CachedTail)
+         {
+            return false;
+         }
+      }
+
+      value = m_Slots[head & MASK];
+      m_Head.store(head + 1, std::memory_order_release);
+      return true;
+   }
+
+   // Only exact when called from the consumer or producer while the other side is idle
+   std::size_t sizeApprox() const
+   {
+      return m_Tail.load(std::memory_order_acquire) - m_Head.load(std::memory_order_acquire);
+   }
+
+   bool empty() const { return sizeApprox() == 0; }
+
+   static constexpr std::size_t capacity() { return Capacity; }
+
+private:
+   static constexpr std::size_t MASK = Capacity - 1;
+
+   // Consumer side
+   alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_Head;
+   std::size_t m_CachedTail;
+
+   // Producer side
+   alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_Tail;
+   std::size_t m_CachedHead;
+
+   alignas(CACHE_LINE_SIZE) std::array<T, Capacity> m_Slots;
+};
+} // namespace korin
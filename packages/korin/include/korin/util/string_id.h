@@ -0,0 +1,128 @@
+// string_id.h
+//
+// Describes the StringID class which stands in for a string with its 32-bit hash, and
+// the StringTable that remembers the strings behind the hashes.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace korin
+{
+/// FNV-1a hash of a string. String literals are hashed at compile time, so passing
+/// one where a StringID is expected costs nothing at run time. Comparing, hashing
+/// and copying a StringID are integer operations. The string itself is only kept
+/// by the StringTable, for strings that were interned.
+///    constexpr StringID CRATE = "crate";
+///    StringID loaded = StringID::intern(nameFromFile);
+class StringID
+{
+public:
+   constexpr StringID()
+      : m_Value(hash("", 0)) {}
+
+   // Hashes up to the first NUL, so a char buffer gives the ID of the string it holds
+   // rather than of its whole size
+   template <std::size_t N>
+   constexpr StringID(const char (&literal)[N])
+      : m_Value(hash(literal, terminatedLength(literal, N))) {}
+
+   // Hashes without interning, so str() is empty unless the string was interned elsewhere
+   constexpr explicit StringID(std::string_view string)
+      : m_Value(hash(string.data(), string.size())) {}
+
+   // Rebuilds an ID from a value saved or sent earlier
+   static constexpr StringID fromValue(std::uint32_t value)
+   {
+      StringID id;
+      id.m_Value = value;
+      return id;
+   }
+
+   // Hashes the string and records it in the StringTable
+   static StringID intern(std::string_view string);
+
+   constexpr std::uint32_t value() const { return m_Value; }
+
+   // The interned string, or empty if it never was
+   const std::string& str() const;
+
+   constexpr bool operator==(const StringID& other) const { return m_Value == other.m_Value; }
+   constexpr bool operator!=(const StringID& other) const { return m_Value != other.m_Value; }
+   constexpr bool operator<(const StringID& other) const { return m_Value < other.m_Value; }
+
+   static constexpr std::uint32_t hash(const char* string, std::size_t length)
+   {
+      std::uint32_t value = 2166136261u;
+      for (std::size_t i = 0; i < length; i++)
+      {
+         value ^= static_cast<std::uint8_t>(string[i]);
+         value *= 16777619u;
+      }
+      return value;
+   }
+
+private:
+   static constexpr std::size_t terminatedLength(const char* string, std::size_t capacity)
+   {
+      std::size_t length = 0;
+      while (length < capacity && string[length] != '\0')
+      {
+         length++;
+      }
+      return length;
+   }
+
+private:
+   std::uint32_t m_Value;
+};
+
+/// Every string interned by the process, by hash. Interning is for loading and
+/// tools; nothing in a tick should need it. Safe to use from any thread.
+class StringTable
+{
+public:
+   StringTable(const StringTable&) = delete;
+   void operator=(const StringTable&) = delete;
+
+   static StringTable& instance()
+   {
+      static StringTable instance;
+      return instance;
+   }
+
+   // Warns when a different string already has the same hash
+   StringID intern(std::string_view string);
+
+   // Empty if the ID was never interned
+   const std::string& find(StringID id) const;
+
+   std::size_t size() const;
+
+private:
+   StringTable();
+
+private:
+   mutable std::mutex m_Mutex;
+
+   // Nodes don't move, so references to the strings stay valid
+   std::unordered_map<std::uint32_t, std::string> m_Strings;
+};
+} // namespace korin
+
+namespace std
+{
+template <>
+struct hash<korin::StringID>
+{
+   std::size_t operator()(const korin::StringID& id) const { return id.value(); }
+};
+} // namespace std
@@ -0,0 +1,58 @@
+// thread_pool.h
+//
+// Describes the ThreadPool class which runs jobs on a fixed set of worker threads.
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace korin
+{
+/// Fixed set of worker threads that are started once and reused, so systems can 
+/// split work across cores every tick without paying for thread creation.
+class ThreadPool
+{
+public:
+   // A worker count of 0 runs every job on the calling thread
+   explicit ThreadPool(std::size_t workerCount = defaultWorkerCount());
+   ~ThreadPool();
+
+   ThreadPool(const ThreadPool&) = delete;
+   ThreadPool& operator=(const ThreadPool&) = delete;
+
+   std::size_t workerCount() const { return m_Workers.size(); }
+
+   // Queues a job to run on a worker thread
+   void enqueue(std::function<void()> job);
+
+   // Splits [0, count) into contiguous ranges and runs them on the workers and the 
+   // calling thread. Blocks until every range has finished.
+   void parallelFor(std::size_t count, const std::function<void(std::size_t begin, std::size_t end)>& job);
+
+   // One less than the hardware threads so the calling thread keeps a core
+   static std::size_t defaultWorkerCount();
+
+private:
+   void workerLoop();
+
+   // Runs one queued job on the calling thread. Returns false if the queue was empty.
+   bool runPendingJob();
+
+private:
+   std::vector<std::thread> m_Workers;
+   std::deque<std::function<void()>> m_Jobs;
+   std::mutex m_Mutex;
+   std::condition_variable m_JobAvailable;
+   bool m_Stopping;
+};
+} // namespace korin
@@ -103,6 +103,22 @@ project 'korin' do
         buildoptions {'-flto=full'}
     end
 
+    filter {'system:linux'} do
+        links 
+        { 
+            'pthread',
+            'dl',     -- System modules
+        }
+        defines 
+        {
+            'KORIN_PLATFORM_LINUX'
+        }
+        buildoptions 
+        {
+            '-fPIC'
+        }
+    end
+
     filter 'system:windows' do
         architecture 'x64'
         runtime 'Release'
@@ -0,0 +1,310 @@
+// asset_loader.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/assets/asset_loader.h"
+#include "korin/util/byte_stream.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+constexpr std::size_t IMAGE_HEADER_SIZE = 8;
+
+// Largest width or height a decoded image may have, the common texture size limit
+constexpr std::uint32_t MAX_IMAGE_DIMENSION = 16384;
+
+bool decodeRunLengthImage(const std::uint8_t* bytes, std::size_t size, std::vector<std::uint8_t>& decoded)
+{
+   ByteReader reader(bytes, size);
+   std::uint32_t width = 0;
+   std::uint32_t height = 0;
+   if (!reader.readU32(width) || !reader.readU32(height) || width > MAX_IMAGE_DIMENSION || height > MAX_IMAGE_DIMENSION)
+   {
+      return false;
+   }
+
+   // The runs are checked before anything is allocated, so a blob can't claim 
+   // more pixels than it holds runs for
+   const std::size_t pixelCount = static_cast<std::size_t>(width) * height;
+   std::size_t counted = 0;
+   while (counted < pixelCount)
+   {
+      std::uint64_t run = 0;
+      std::uint32_t color = 0;
+      if (!reader.readVarint(run) || !reader.readU32(color) || run == 0 || run > pixelCount - counted)
+      {
+         return false;
+      }
+      counted += run;
+   }
+   if (reader.remaining() != 0)
+   {
+      return false;
+   }
+
+   decoded.clear();
+   decoded.reserve(IMAGE_HEADER_SIZE + pixelCount * 4);
+   ByteWriter writer(decoded);
+   writer.writeU32(width);
+   writer.writeU32(height);
+
+   ByteReader runs(bytes + IMAGE_HEADER_SIZE, size - IMAGE_HEADER_SIZE);
+   for (std::size_t written = 0; written < pixelCount;)
+   {
+      std::uint64_t run = 0;
+      std::uint32_t color = 0;
+      runs.readVarint(run);
+      runs.readU32(color);
+      for (std::uint64_t i = 0; i < run; i++)
+      {
+         writer.writeU32(color);
+      }
+      written += run;
+   }
+   return true;
+}
+} // namespace
+
+AssetLoader::AssetLoader(const PackFile& pack, ThreadPool& threadPool, std::size_t memoryBudget)
+   : m_Pack(pack), m_ThreadPool(threadPool), m_MemoryBudget(memoryBudget), m_MemoryUsed(0), m_EvictionCount(0)
+   , m_Entries(std::vector<Entry>(pack.entries().size())), m_Decoders(std::vector<Decoder>(3))
+   , m_Unused(std::list<std::uint32_t>()), m_Loading(0), m_Completed(std::vector<Completed>())
+{
+   for (Entry& entry : m_Entries)
+   {
+      entry.state = AssetState::Unloaded;
+      entry.referenceCount = 0;
+      entry.unused = false;
+   }
+   setDecoder(PackBlobType::RunLengthImage, decodeRunLengthImage);
+}
+
+AssetLoader::~AssetLoader()
+{
+   finishLoading();
+}
+
+void AssetLoader::setDecoder(PackBlobType type, Decoder decoder)
+{
+   const auto index = static_cast<std::size_t>(type);
+   if (index >= m_Decoders.size())
+   {
+      m_Decoders.resize(index + 1);
+   }
+   m_Decoders[index] = std::move(decoder);
+}
+
+std::uint32_t AssetLoader::acquire(const std::string& name)
+{
+   const std::uint32_t entry = m_Pack.find(name);
+   if (entry == PackFile::INVALID_PACK_ENTRY)
+   {
+      KORIN_CORE_WARN("Asset " + name + " isn't in the pack.");
+      return entry;
+   }
+
+   acquire(entry);
+   return entry;
+}
+
+void AssetLoader::acquire(std::uint32_t entry)
+{
+   if (!isValidEntry(entry))
+   {
+      return;
+   }
+
+   Entry& asset = m_Entries[entry];
+   if (asset.referenceCount++ == 0 && asset.unused)
+   {
+      m_Unused.erase(asset.unusedIt);
+      asset.unused = false;
+   }
+
+   if (asset.state == AssetState::Unloaded)
+   {
+      startLoading(entry);
+   }
+}
+
+void AssetLoader::release(std::uint32_t entry)
+{
+   if (!isValidEntry(entry))
+   {
+      return;
+   }
+
+   Entry& asset = m_Entries[entry];
+   if (asset.referenceCount == 0)
+   {
+      KORIN_CORE_WARN("Released asset " + m_Pack.entries()[entry].name + " more times than it was acquired.");
+      return;
+   }
+
+   // Loading assets join the queue when they finish. Assets read in place have nothing to free.
+   if (--asset.referenceCount == 0 && asset.state == AssetState::Ready && decoderFor(m_Pack.entries()[entry].type))
+   {
+      asset.unusedIt = m_Unused.insert(m_Unused.end(), entry);
+      asset.unused = true;
+      evict();
+   }
+}
+
+void AssetLoader::update()
+{
+   std::vector<Completed> completed;
+   {
+      std::lock_guard<std::mutex> lock(m_CompletedMutex);
+      completed.swap(m_Completed);
+   }
+
+   for (Completed& finished : completed)
+   {
+      publish(finished);
+   }
+   evict();
+}
+
+void AssetLoader::finishLoading()
+{
+   while (m_Loading > 0)
+   {
+      {
+         std::unique_lock<std::mutex> lock(m_CompletedMutex);
+         m_CompletedAvailable.wait(lock, [this]() { return !m_Completed.empty(); });
+      }
+      update();
+   }
+}
+
+bool AssetLoader::get(std::uint32_t entry, AssetData& data) const
+{
+   if (!isValidEntry(entry))
+   {
+      return false;
+   }
+
+   const Entry& asset = m_Entries[entry];
+   if (asset.state != AssetState::Ready)
+   {
+      return false;
+   }
+
+   const PackEntry& packEntry = m_Pack.entries()[entry];
+   if (decoderFor(packEntry.type))
+   {
+      // Every built in decoded type turns into an Image
+      data = {asset.decoded.data(), asset.decoded.size(),
+         packEntry.type == PackBlobType::RunLengthImage ? PackBlobType::Image : packEntry.type};
+   }
+   else
+   {
+      data = {m_Pack.data(entry), static_cast<std::size_t>(packEntry.size), packEntry.type};
+   }
+   return true;
+}
+
+AssetState AssetLoader::state(std::uint32_t entry) const
+{
+   return isValidEntry(entry) ? m_Entries[entry].state : AssetState::Failed;
+}
+
+std::uint32_t AssetLoader::referenceCount(std::uint32_t entry) const
+{
+   return isValidEntry(entry) ? m_Entries[entry].referenceCount : 0;
+}
+
+bool AssetLoader::readImage(const AssetData& data, ImageView& image)
+{
+   ByteReader reader(data.bytes, data.size);
+   reader.readU32(image.width);
+   reader.readU32(image.height);
+   if (data.type != PackBlobType::Image || reader.failed()
+      || static_cast<std::size_t>(image.width) * image.height * 4 != reader.remaining())
+   {
+      return false;
+   }
+   image.pixels = reinterpret_cast<const std::uint32_t*>(data.bytes + IMAGE_HEADER_SIZE);
+   return true;
+}
+
+bool AssetLoader::isValidEntry(std::uint32_t entry) const
+{
+   if (entry >= m_Entries.size())
+   {
+      KORIN_CORE_WARN("Asset entry " + std::to_string(entry) + " isn't in the pack.");
+      return false;
+   }
+   return true;
+}
+
+void AssetLoader::startLoading(std::uint32_t entry)
+{
+   const PackEntry& packEntry = m_Pack.entries()[entry];
+   const Decoder* decoder = decoderFor(packEntry.type);
+   if (!decoder)
+   {
+      m_Entries[entry].state = AssetState::Ready;
+      return;
+   }
+
+   m_Entries[entry].state = AssetState::Loading;
+   m_Loading++;
+
+   const std::uint8_t* bytes = m_Pack.data(entry);
+   const auto size = static_cast<std::size_t>(packEntry.size);
+   m_ThreadPool.enqueue([this, entry, bytes, size, decode = *decoder]()
+   {
+      Completed completed = {entry, false, std::vector<std::uint8_t>()};
+      completed.decoded = decode(bytes, size, completed.bytes);
+
+      std::lock_guard<std::mutex> lock(m_CompletedMutex);
+      m_Completed.push_back(std::move(completed));
+      m_CompletedAvailable.notify_all();
+   });
+}
+
+void AssetLoader::publish(Completed& completed)
+{
+   Entry& asset = m_Entries[completed.entry];
+   m_Loading--;
+   if (!completed.decoded)
+   {
+      KORIN_CORE_WARN("Could not decode asset " + m_Pack.entries()[completed.entry].name + ".");
+      asset.state = AssetState::Failed;
+      return;
+   }
+
+   asset.decoded = std::move(completed.bytes);
+   asset.state = AssetState::Ready;
+   m_MemoryUsed += asset.decoded.size();
+   if (asset.referenceCount == 0)
+   {
+      asset.unusedIt = m_Unused.insert(m_Unused.end(), completed.entry);
+      asset.unused = true;
+   }
+}
+
+void AssetLoader::evict()
+{
+   while (m_MemoryUsed > m_MemoryBudget && !m_Unused.empty())
+   {
+      Entry& asset = m_Entries[m_Unused.front()];
+      m_Unused.pop_front();
+      asset.unused = false;
+
+      m_MemoryUsed -= asset.decoded.size();
+      asset.decoded = std::vector<std::uint8_t>();
+      asset.state = AssetState::Unloaded;
+      m_EvictionCount++;
+   }
+}
+
+const AssetLoader::Decoder* AssetLoader::decoderFor(PackBlobType type) const
+{
+   const auto index = static_cast<std::size_t>(type);
+   return index < m_Decoders.size() && m_Decoders[index] ? &m_Decoders[index] : nullptr;
+}
@@ -0,0 +1,138 @@
+// asset_registry.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+
+#include "korin/assets/asset_registry.h"
+#include "korin/assets/atlas_packer.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+AssetRegistry::AssetRegistry()
+   : m_Images(std::vector<Image>()), m_Sprites(std::vector<SpriteAsset>())
+   , m_IDsByHandle(std::unordered_map<StringID, AssetID>()), m_Pages(std::vector<AtlasPage>())
+{
+}
+
+AssetID AssetRegistry::addImage(const std::string& handle, std::uint32_t width, std::uint32_t height, const std::uint32_t* pixels)
+{
+   const StringID handleID = StringID::intern(handle);
+   AssetID assetID = find(handleID);
+   if (assetID == INVALID_ASSET_ID)
+   {
+      assetID = static_cast<AssetID>(m_Images.size());
+      m_IDsByHandle[handleID] = assetID;
+      m_Images.push_back(Image());
+      m_Sprites.push_back(SpriteAsset());
+   }
+
+   Image& image = m_Images[assetID];
+   image.handle = handleID;
+   image.width = width;
+   image.height = height;
+   image.pixels.assign(pixels, pixels + static_cast<std::size_t>(width) * height);
+   image.packed = false;
+   return assetID;
+}
+
+bool AssetRegistry::buildAtlas(std::uint32_t pageSize, std::uint32_t padding)
+{
+   std::vector<AtlasRect> rects;
+   rects.reserve(m_Images.size());
+   for (const Image& image : m_Images)
+   {
+      rects.push_back({image.width, image.height});
+   }
+
+   AtlasPacker packer(pageSize, pageSize, padding);
+   std::vector<AtlasPlacement> placements;
+   if (!packer.pack(rects, placements))
+   {
+      return false;
+   }
+
+   m_Pages.clear();
+   for (std::uint32_t page = 0; page < packer.pageCount(); page++)
+   {
+      m_Pages.push_back({ATLAS_TEXTURE_ID_BASE + page, pageSize, pageSize,
+         std::vector<std::uint32_t>(static_cast<std::size_t>(pageSize) * pageSize, 0)});
+   }
+
+   const float scale = 1.0f / static_cast<float>(pageSize);
+   for (std::size_t i = 0; i < m_Images.size(); i++)
+   {
+      Image& image = m_Images[i];
+      const AtlasPlacement& placement = placements[i];
+      blit(image, m_Pages[placement.page], placement.x, placement.y, padding);
+
+      m_Sprites[i] = {
+         ATLAS_TEXTURE_ID_BASE + placement.page,
+         static_cast<float>(placement.x) * scale, static_cast<float>(placement.y) * scale,
+         static_cast<float>(placement.x + image.width) * scale, static_cast<float>(placement.y + image.height) * scale,
+         image.width, image.height
+      };
+      image.packed = true;
+   }
+
+   KORIN_CORE_INFO("Packed " + std::to_string(m_Images.size()) + " images into " + std::to_string(m_Pages.size()) + " atlas pages.");
+   return true;
+}
+
+AssetID AssetRegistry::find(StringID handle) const
+{
+   const auto idIt = m_IDsByHandle.find(handle);
+   return idIt == m_IDsByHandle.end() ? INVALID_ASSET_ID : idIt->second;
+}
+
+const SpriteAsset* AssetRegistry::sprite(AssetID assetID) const
+{
+   if (assetID >= m_Images.size() || !m_Images[assetID].packed)
+   {
+      return nullptr;
+   }
+   return &m_Sprites[assetID];
+}
+
+StringID AssetRegistry::handle(AssetID assetID) const
+{
+   if (assetID >= m_Images.size())
+   {
+      KORIN_CORE_WARN("AssetID(" + std::to_string(assetID) + ") was never added to the AssetRegistry.");
+      return StringID();
+   }
+   return m_Images[assetID].handle;
+}
+
+void AssetRegistry::clear()
+{
+   m_Images.clear();
+   m_Sprites.clear();
+   m_IDsByHandle.clear();
+   m_Pages.clear();
+}
+
+void AssetRegistry::blit(const Image& image, AtlasPage& page, std::uint32_t x, std::uint32_t y, std::uint32_t padding) const
+{
+   if (image.width == 0 || image.height == 0)
+   {
+      return;
+   }
+
+   // Every padded pixel takes the nearest pixel of the image
+   const auto left = static_cast<std::int64_t>(x) - padding;
+   const auto top = static_cast<std::int64_t>(y) - padding;
+   for (std::uint32_t row = 0; row < image.height + 2 * padding; row++)
+   {
+      const std::int64_t sourceRow = std::min<std::int64_t>(std::max<std::int64_t>(static_cast<std::int64_t>(row) - padding, 0), image.height - 1);
+      std::uint32_t* out = page.pixels.data() + static_cast<std::size_t>(top + row) * page.width + left;
+      const std::uint32_t* in = image.pixels.data() + static_cast<std::size_t>(sourceRow) * image.width;
+      for (std::uint32_t column = 0; column < image.width + 2 * padding; column++)
+      {
+         const std::int64_t sourceColumn = std::min<std::int64_t>(std::max<std::int64_t>(static_cast<std::int64_t>(column) - padding, 0), image.width - 1);
+         out[column] = in[sourceColumn];
+      }
+   }
+}
@@ -0,0 +1,78 @@
+// atlas_packer.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <numeric>
+
+#include "korin/assets/atlas_packer.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+AtlasPacker::AtlasPacker(std::uint32_t pageWidth, std::uint32_t pageHeight, std::uint32_t padding)
+   : m_PageWidth(pageWidth), m_PageHeight(pageHeight), m_Padding(padding), m_PageCount(0)
+   , m_Shelves(std::vector<Shelf>())
+{
+}
+
+bool AtlasPacker::pack(const std::vector<AtlasRect>& rects, std::vector<AtlasPlacement>& placements)
+{
+   m_Shelves.clear();
+   m_PageCount = 0;
+   placements.assign(rects.size(), {0, 0, 0});
+
+   // Tallest first keeps the shelves from wasting height, widest first breaks ties
+   std::vector<std::uint32_t> order(rects.size());
+   std::iota(order.begin(), order.end(), 0);
+   std::sort(order.begin(), order.end(), [&rects](std::uint32_t a, std::uint32_t b)
+   {
+      if (rects[a].height != rects[b].height)
+      {
+         return rects[a].height > rects[b].height;
+      }
+      return rects[a].width != rects[b].width ? rects[a].width > rects[b].width : a < b;
+   });
+
+   for (const std::uint32_t index : order)
+   {
+      const std::uint32_t width = rects[index].width + 2 * m_Padding;
+      const std::uint32_t height = rects[index].height + 2 * m_Padding;
+      if (width > m_PageWidth || height > m_PageHeight)
+      {
+         KORIN_CORE_WARN("A " + std::to_string(rects[index].width) + "x" + std::to_string(rects[index].height)
+            + " image doesn't fit on a " + std::to_string(m_PageWidth) + "x" + std::to_string(m_PageHeight) + " atlas page.");
+         return false;
+      }
+
+      Shelf* shelf = nullptr;
+      for (Shelf& candidate : m_Shelves)
+      {
+         if (candidate.height >= height && m_PageWidth - candidate.used >= width)
+         {
+            shelf = &candidate;
+            break;
+         }
+      }
+
+      if (!shelf)
+      {
+         // Shelves fill a page top to bottom, so the newest shelf is the lowest
+         const Shelf* last = m_Shelves.empty() ? nullptr : &m_Shelves.back();
+         if (last && m_PageHeight - (last->y + last->height) >= height)
+         {
+            m_Shelves.push_back({last->page, last->y + last->height, height, 0});
+         }
+         else
+         {
+            m_Shelves.push_back({m_PageCount++, 0, height, 0});
+         }
+         shelf = &m_Shelves.back();
+      }
+
+      placements[index] = {shelf->page, shelf->used + m_Padding, shelf->y + m_Padding};
+      shelf->used += width;
+   }
+   return true;
+}
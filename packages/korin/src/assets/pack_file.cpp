@@ -0,0 +1,278 @@
+// pack_file.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <fstream>
+
+#include "korin/assets/pack_file.h"
+#include "korin/util/byte_stream.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+constexpr std::size_t HEADER_SIZE = 32;
+
+// Name hash, offset, size, name offset, name length and type of one blob
+constexpr std::size_t TABLE_ENTRY_SIZE = 32;
+
+std::uint64_t alignUp(std::uint64_t value)
+{
+   return (value + PACK_ALIGNMENT - 1) & ~static_cast<std::uint64_t>(PACK_ALIGNMENT - 1);
+}
+} // namespace
+
+PackFile::PackFile()
+   : m_Data(nullptr), m_Size(0), m_Entries(std::vector<PackEntry>()), m_File()
+{
+}
+
+PackFile::~PackFile()
+{
+   close();
+}
+
+bool PackFile::open(const std::string& path)
+{
+   close();
+   if (!m_File.open(path))
+   {
+      return false;
+   }
+
+   m_Data = m_File.data();
+   m_Size = m_File.size();
+   if (!readTableOfContents())
+   {
+      KORIN_CORE_WARN("Pack " + path + " is invalid.");
+      close();
+      return false;
+   }
+   return true;
+}
+
+void PackFile::close()
+{
+   m_File.close();
+   m_Data = nullptr;
+   m_Size = 0;
+   m_Entries.clear();
+}
+
+std::uint32_t PackFile::find(const std::string& name) const
+{
+   const std::uint64_t hash = hashName(name);
+   auto entryIt = std::lower_bound(m_Entries.begin(), m_Entries.end(), hash,
+      [](const PackEntry& entry, std::uint64_t value) { return entry.nameHash < value; });
+
+   // Names only have to be compared when hashes collide
+   for (; entryIt != m_Entries.end() && entryIt->nameHash == hash; ++entryIt)
+   {
+      if (entryIt->name == name)
+      {
+         return static_cast<std::uint32_t>(entryIt - m_Entries.begin());
+      }
+   }
+   return INVALID_PACK_ENTRY;
+}
+
+const std::uint8_t* PackFile::data(std::uint32_t entry) const
+{
+   if (entry >= m_Entries.size())
+   {
+      KORIN_CORE_WARN("Pack entry " + std::to_string(entry) + " is out of range.");
+      return nullptr;
+   }
+   return m_Data + m_Entries[entry].offset;
+}
+
+std::uint64_t PackFile::hashName(const std::string& name)
+{
+   std::uint64_t hash = 14695981039346656037ull;
+   for (const char character : name)
+   {
+      hash ^= static_cast<std::uint8_t>(character);
+      hash *= 1099511628211ull;
+   }
+   return hash;
+}
+
+bool PackFile::readTableOfContents()
+{
+   ByteReader header(m_Data, m_Size);
+   std::uint32_t magic = 0;
+   std::uint16_t version = 0;
+   std::uint16_t reserved = 0;
+   std::uint32_t entryCount = 0;
+   std::uint32_t namesSize = 0;
+   std::uint64_t tableOffset = 0;
+   std::uint64_t namesOffset = 0;
+   header.readU32(magic);
+   header.readU16(version);
+   header.readU16(reserved);
+   header.readU32(entryCount);
+   header.readU32(namesSize);
+   header.readU64(tableOffset);
+   header.readU64(namesOffset);
+   if (header.failed() || magic != PACK_MAGIC || version != PACK_VERSION
+      || tableOffset > m_Size || namesOffset > m_Size || namesSize > m_Size - namesOffset)
+   {
+      return false;
+   }
+
+   // A corrupt count could ask for billions of entries, so check the table holds them first
+   if (entryCount > (m_Size - tableOffset) / TABLE_ENTRY_SIZE)
+   {
+      return false;
+   }
+
+   const char* names = reinterpret_cast<const char*>(m_Data + namesOffset);
+   ByteReader table(m_Data + tableOffset, m_Size - tableOffset);
+   m_Entries.resize(entryCount);
+   for (std::size_t i = 0; i < m_Entries.size(); i++)
+   {
+      PackEntry& entry = m_Entries[i];
+      std::uint32_t nameOffset = 0;
+      std::uint16_t nameLength = 0;
+      std::uint16_t type = 0;
+      table.readU64(entry.nameHash);
+      table.readU64(entry.offset);
+      table.readU64(entry.size);
+      table.readU32(nameOffset);
+      table.readU16(nameLength);
+      table.readU16(type);
+      if (table.failed() || entry.offset > m_Size || entry.size > m_Size - entry.offset
+         || nameOffset > namesSize || nameLength > namesSize - nameOffset)
+      {
+         return false;
+      }
+
+      // find() binary searches the hashes
+      if (i > 0 && entry.nameHash < m_Entries[i - 1].nameHash)
+      {
+         return false;
+      }
+      entry.name.assign(names + nameOffset, nameLength);
+      entry.type = static_cast<PackBlobType>(type);
+   }
+   return true;
+}
+
+PackWriter::PackWriter()
+   : m_Blobs(std::vector<Blob>())
+{
+}
+
+void PackWriter::add(const std::string& name, PackBlobType type, const void* data, std::size_t size)
+{
+   const auto* bytes = static_cast<const std::uint8_t*>(data);
+   for (Blob& blob : m_Blobs)
+   {
+      if (blob.name == name)
+      {
+         blob.type = type;
+         blob.bytes.assign(bytes, bytes + size);
+         return;
+      }
+   }
+   m_Blobs.push_back({name, type, std::vector<std::uint8_t>(bytes, bytes + size)});
+}
+
+void PackWriter::addImage(const std::string& name, std::uint32_t width, std::uint32_t height, const std::uint32_t* pixels,
+   bool runLengthEncode)
+{
+   std::vector<std::uint8_t> bytes;
+   ByteWriter writer(bytes);
+   writer.writeU32(width);
+   writer.writeU32(height);
+
+   const std::size_t pixelCount = static_cast<std::size_t>(width) * height;
+   for (std::size_t i = 0; i < pixelCount;)
+   {
+      std::size_t run = 1;
+      while (runLengthEncode && i + run < pixelCount && pixels[i + run] == pixels[i])
+      {
+         run++;
+      }
+      if (runLengthEncode)
+      {
+         writer.writeVarint(run);
+      }
+      writer.writeU32(pixels[i]);
+      i += run;
+   }
+
+   add(name, runLengthEncode ? PackBlobType::RunLengthImage : PackBlobType::Image, bytes.data(), bytes.size());
+}
+
+bool PackWriter::write(const std::string& path) const
+{
+   std::vector<std::uint8_t> bytes;
+   ByteWriter writer(bytes);
+
+   // The header is filled in once the offsets are known
+   bytes.resize(HEADER_SIZE, 0);
+
+   std::vector<const Blob*> sorted;
+   for (const Blob& blob : m_Blobs)
+   {
+      sorted.push_back(&blob);
+   }
+   std::sort(sorted.begin(), sorted.end(), [](const Blob* a, const Blob* b)
+   {
+      const std::uint64_t hashA = PackFile::hashName(a->name);
+      const std::uint64_t hashB = PackFile::hashName(b->name);
+      return hashA != hashB ? hashA < hashB : a->name < b->name;
+   });
+
+   std::vector<std::uint64_t> offsets;
+   for (const Blob* blob : sorted)
+   {
+      bytes.resize(alignUp(bytes.size()), 0);
+      offsets.push_back(bytes.size());
+      writer.writeBytes(blob->bytes.data(), blob->bytes.size());
+   }
+
+   bytes.resize(alignUp(bytes.size()), 0);
+   const std::uint64_t tableOffset = bytes.size();
+   std::uint32_t nameOffset = 0;
+   for (std::size_t i = 0; i < sorted.size(); i++)
+   {
+      writer.writeU64(PackFile::hashName(sorted[i]->name));
+      writer.writeU64(offsets[i]);
+      writer.writeU64(sorted[i]->bytes.size());
+      writer.writeU32(nameOffset);
+      writer.writeU16(static_cast<std::uint16_t>(sorted[i]->name.size()));
+      writer.writeU16(static_cast<std::uint16_t>(sorted[i]->type));
+      nameOffset += static_cast<std::uint32_t>(sorted[i]->name.size());
+   }
+
+   const std::uint64_t namesOffset = bytes.size();
+   for (const Blob* blob : sorted)
+   {
+      writer.writeBytes(blob->name.data(), blob->name.size());
+   }
+
+   std::vector<std::uint8_t> header;
+   ByteWriter headerWriter(header);
+   headerWriter.writeU32(PACK_MAGIC);
+   headerWriter.writeU16(PACK_VERSION);
+   headerWriter.writeU16(0);
+   headerWriter.writeU32(static_cast<std::uint32_t>(sorted.size()));
+   headerWriter.writeU32(nameOffset);
+   headerWriter.writeU64(tableOffset);
+   headerWriter.writeU64(namesOffset);
+   std::copy(header.begin(), header.end(), bytes.begin());
+
+   std::ofstream file(path, std::ios::binary | std::ios::trunc);
+   file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+   if (!file)
+   {
+      KORIN_CORE_WARN("Could not write pack " + path + ".");
+      return false;
+   }
+   return true;
+}
@@ -9,4 +9,4 @@
 
 using namespace korin;
 
-ComponentTypeID Component::m_NextID = 0;
\ No newline at end of file
+std::atomic<ComponentTypeID> Component::m_NextID(0);
\ No newline at end of file
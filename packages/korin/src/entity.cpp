@@ -1,11 +0,0 @@
-// entity.cpp
-//
-// Copyright (c) Zachary Duncan - Duncandoit
-// 07/23/2024
-
-#include "korin/entity.h"
-
-namespace korin
-{
-EntityID Entity::m_NextID = 0;
-} // namespace korin
\ No newline at end of file
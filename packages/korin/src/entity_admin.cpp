@@ -3,41 +3,47 @@
 // Copyright (c) Zachary Duncan - Duncandoit
 // 2024-07-09
 
+#include <cstring>
+
 #include "korin/entity_admin.h"
 #include "korin/log.h"
 #include "korin/util/assert.h"
+#include "korin/serialization/prefab.h"
+#include "korin/serialization/component_registry.h"
 #include "korin/systems/movement_system.h"
 #include "korin/systems/game_input_system.h"
 #include "korin/systems/render_system.h"
+#include "korin/systems/spatial_query_system.h"
+#include "korin/systems/physics_system.h"
+#include "korin/systems/collision_system.h"
+#include "korin/systems/camera_system.h"
 
 using namespace korin;
 
 EntityAdmin::EntityAdmin()
    : m_Entities(std::unordered_map<EntityID, EntityPtr>()), 
-   m_Systems(std::vector<SystemPtr>()),
+   m_Schedule(SystemSchedule()),
    m_ComponentsByType(std::unordered_map<ComponentTypeID, std::vector<ComponentPtr>>()),
    m_ComponentsByEntity(std::unordered_map<EntityID, std::vector<ComponentPtr>>()),
    m_AvailableEntityIDs(std::queue<EntityID>()), 
-   m_LivingEntityCount(0)
+   m_LivingEntityCount(0),
+   m_NextEntityID(0)
 {
-   initSystems();
 }
 
 EntityAdmin::~EntityAdmin()
 {
    m_Entities.clear();
-   m_Systems.clear();
+   m_Schedule.clear();
    m_ComponentsByType.clear();
    m_ComponentsByEntity.clear();
    m_AvailableEntityIDs = std::queue<EntityID>();
    m_LivingEntityCount = 0;
 }
 
-EntityPtr EntityAdmin::createEntity(const std::string& resourceHandle)
+EntityPtr EntityAdmin::createEntity(StringID resourceHandle)
 {
-   KORIN_CORE_INFO("Creating Entity with resource handle: " + resourceHandle);
-
-   EntityPtr entity = std::make_shared<Entity>(resourceHandle);
+   EntityPtr entity = std::make_shared<Entity>(m_NextEntityID, resourceHandle);
    if (!entity) 
    { 
       KORIN_CORE_WARN("Cannot add a null Entity.");
@@ -52,13 +58,105 @@ EntityPtr EntityAdmin::createEntity(const std::string& resourceHandle)
 
    KORIN_CORE_INFO("Adding EntityID(" + std::to_string(entity->entityID()) + ") to admin.");
 
-   m_Entities[entity->entityID()] = entity;
-   m_ComponentsByEntity[entity->entityID()] = std::vector<ComponentPtr>();
-   m_LivingEntityCount++;
+   insertEntity(entity);
+   return entity;
+}
+
+EntityPtr EntityAdmin::restoreEntity(EntityID entityID, StringID resourceHandle)
+{
+   if (entityID == INVALID_ENTITY_ID || m_Entities.find(entityID) != m_Entities.end())
+   {
+      KORIN_CORE_WARN("Cannot restore EntityID(" + std::to_string(entityID) + "). The ID is invalid or in use.");
+      return EntityPtr();
+   }
+
+   if (m_LivingEntityCount >= MAX_ENTITIES) 
+   { 
+      KORIN_CORE_WARN("Cannot restore EntityID(" + std::to_string(entityID) + "). Maximum entities reached.");
+      return EntityPtr();
+   }
 
+   EntityPtr entity = std::make_shared<Entity>(entityID, resourceHandle);
+   insertEntity(entity);
    return entity;
 }
 
+EntityID EntityAdmin::instantiate(const Prefab& prefab, std::uint32_t count)
+{
+   if (count == 0 || prefab.empty())
+   {
+      KORIN_CORE_WARN("Cannot instantiate an empty prefab.");
+      return INVALID_ENTITY_ID;
+   }
+
+   if (count > MAX_ENTITIES - m_LivingEntityCount)
+   {
+      KORIN_CORE_WARN("Cannot instantiate " + std::to_string(count) + " entities. Maximum entities reached.");
+      return INVALID_ENTITY_ID;
+   }
+
+   const EntityID firstEntityID = m_NextEntityID;
+   const std::size_t componentCount = prefab.m_Components.size();
+   m_Entities.reserve(m_Entities.size() + count);
+   m_ComponentsByEntity.reserve(m_ComponentsByEntity.size() + count);
+   for (std::uint32_t i = 0; i < count; i++)
+   {
+      insertEntity(std::make_shared<Entity>(firstEntityID + i, prefab.handle()));
+   }
+
+   // Components are grouped by type, so those of entity i are at created[type * count + i]
+   const std::vector<ComponentType>& types = ComponentRegistry::instance().types();
+   std::vector<ComponentPtr> created(componentCount * count);
+   std::vector<ComponentTypeID> typeIDs(componentCount);
+   std::vector<std::vector<ComponentPtr>*> componentsOfTypes(componentCount);
+   std::vector<Component*> targets(count);
+   std::vector<std::uint8_t> rows;
+   for (std::size_t type = 0; type < componentCount; type++)
+   {
+      const ComponentType& componentType = types[prefab.m_Components[type].typeIndex];
+      const std::vector<std::uint8_t>& row = prefab.m_Components[type].row;
+      ComponentPtr* block = created.data() + type * count;
+      componentType.createBlock(count, block);
+
+      rows.resize(row.size() * count);
+      for (std::uint32_t i = 0; i < count; i++)
+      {
+         std::memcpy(rows.data() + i * row.size(), row.data(), row.size());
+         targets[i] = block[i].get();
+      }
+      componentType.unpack(targets.data(), count, rows.data());
+
+      typeIDs[type] = componentType.typeID;
+      componentsOfTypes[type] = &m_ComponentsByType[componentType.typeID];
+      componentsOfTypes[type]->reserve(componentsOfTypes[type]->size() + count);
+   }
+
+   // Every entity has the same component types, so siblings are wired without checking
+   for (std::uint32_t i = 0; i < count; i++)
+   {
+      std::vector<ComponentPtr>& entityComponents = m_ComponentsByEntity[firstEntityID + i];
+      entityComponents.reserve(componentCount);
+      for (std::size_t type = 0; type < componentCount; type++)
+      {
+         const ComponentPtr& component = created[type * count + i];
+         component->m_EntityID = firstEntityID + i;
+         component->m_Siblings.reserve(componentCount - 1);
+         for (std::size_t sibling = 0; sibling < componentCount; sibling++)
+         {
+            if (sibling != type)
+            {
+               component->m_Siblings[typeIDs[sibling]] = created[sibling * count + i];
+            }
+         }
+         component->m_SiblingsVersion++;
+         entityComponents.push_back(component);
+         componentsOfTypes[type]->push_back(component);
+      }
+   }
+
+   return firstEntityID;
+}
+
 void EntityAdmin::removeEntity(EntityPtr entity)
 {
    const auto entityComponentTypesIt = m_ComponentsByEntity.find(entity->entityID());
@@ -69,6 +167,13 @@ void EntityAdmin::removeEntity(EntityPtr entity)
    }
 
    // Remove all components associated with entity. This maybe should be done async.
+   for (const auto& component : entityComponentTypesIt->second)
+   {
+      auto& componentsOfType = m_ComponentsByType[component->typeID()];
+      componentsOfType.erase(
+         std::remove(componentsOfType.begin(), componentsOfType.end(), component), componentsOfType.end()
+      );
+   }
    m_ComponentsByEntity.erase(entityComponentTypesIt); 
  
    m_Entities.erase(entity->entityID());
@@ -104,56 +209,51 @@ bool EntityAdmin::addComponent(EntityID entityID, ComponentPtr component)
       }
    }
 
-   // Add siblings
-   for (auto& sibling : entityComponentTypes)
-   {
-      component->addSibling(sibling);
-      sibling->addSibling(component);
-   }
-
-   entityComponentTypes.emplace_back(component);
-   m_ComponentsByType[component->typeID()].emplace_back(component);
+   attachComponent(entityID, component);
    return true;
 }
 
 void EntityAdmin::removeComponent(EntityID entityID, ComponentTypeID componentTypeID)
 {
-   const auto& entityComponentTypes = m_ComponentsByEntity[entityID];
-   if (entityComponentTypes.empty())
+   const auto entityComponentsIt = m_ComponentsByEntity.find(entityID);
+   if (entityComponentsIt == m_ComponentsByEntity.end())
    {
       KORIN_CORE_WARN("Entity(" + std::to_string(entityID) + ") does not exist for removing component.");
+      return;
    }
 
-   const auto& existingComponent = entityComponentTypes[componentTypeID];
-   if (existingComponent)
+   auto& entityComponents = entityComponentsIt->second;
+   const auto componentIt = std::find_if(entityComponents.begin(), entityComponents.end(), 
+      [componentTypeID](const ComponentPtr& component) { return component->typeID() == componentTypeID; });
+   if (componentIt == entityComponents.end())
    {
       KORIN_CORE_WARN("ComponentType(" + std::to_string(componentTypeID) + ") type does not exist for removal.");
+      return;
    }
-   
-   for (auto& sibling : m_ComponentsByEntity[entityID])
-   {
-      if (sibling->typeID() != componentTypeID)
-      {
-         break;
-      }
 
-      m_ComponentsByEntity[entityID].erase(
-         std::remove(m_ComponentsByEntity[entityID].begin(), m_ComponentsByEntity[entityID].end(), sibling), 
-         m_ComponentsByEntity[entityID].end()
-      );
+   auto& componentsOfType = m_ComponentsByType[componentTypeID];
+   componentsOfType.erase(
+      std::remove(componentsOfType.begin(), componentsOfType.end(), *componentIt), componentsOfType.end()
+   );
+   entityComponents.erase(componentIt);
+
+   // Siblings let go of it so a component of the same type can be added again
+   for (const auto& sibling : entityComponents)
+   {
+      sibling->removeSibling(componentTypeID);
    }
 }
 
 ComponentPtr EntityAdmin::getComponent(EntityID entityID, ComponentTypeID componentTypeID)
 {
-   const auto& entityComponentTypes = m_ComponentsByEntity[entityID];
-   if (entityComponentTypes.empty())
+   const auto entityComponentsIt = m_ComponentsByEntity.find(entityID);
+   if (entityComponentsIt == m_ComponentsByEntity.end())
    {
       KORIN_CORE_WARN("EntityID(" + std::to_string(entityID) + ") does not exist for getting component.");
       return nullptr;
    }
 
-   const auto& component = entityComponentTypes[componentTypeID];
+   ComponentPtr component = findComponent(entityID, componentTypeID);
    if (!component)
    {
       KORIN_CORE_WARN("ComponentType(" + std::to_string(componentTypeID) + ") does not exist on entity for retrieval.");
@@ -163,7 +263,46 @@ ComponentPtr EntityAdmin::getComponent(EntityID entityID, ComponentTypeID compon
    return component;
 }
 
-bool EntityAdmin::addSystem(const SystemPtr& system)
+ComponentPtr EntityAdmin::findComponent(EntityID entityID, ComponentTypeID componentTypeID) const
+{
+   const auto entityComponentsIt = m_ComponentsByEntity.find(entityID);
+   if (entityComponentsIt == m_ComponentsByEntity.end())
+   {
+      return nullptr;
+   }
+
+   for (const auto& component : entityComponentsIt->second)
+   {
+      if (component->typeID() == componentTypeID)
+      {
+         return component;
+      }
+   }
+   return nullptr;
+}
+
+void EntityAdmin::clear()
+{
+   m_Entities.clear();
+   m_ComponentsByEntity.clear();
+   m_AvailableEntityIDs = std::queue<EntityID>();
+   m_LivingEntityCount = 0;
+
+   // The type lists are emptied rather than erased so systems keep finding them
+   for (auto& componentsOfType : m_ComponentsByType)
+   {
+      componentsOfType.second.clear();
+   }
+}
+
+const std::vector<ComponentPtr>& EntityAdmin::components(EntityID entityID) const
+{
+   static const std::vector<ComponentPtr> noComponents;
+   const auto entityComponentsIt = m_ComponentsByEntity.find(entityID);
+   return entityComponentsIt == m_ComponentsByEntity.end() ? noComponents : entityComponentsIt->second;
+}
+
+bool EntityAdmin::addSystem(const SystemPtr& system, const SystemDesc& desc)
 {
    if (!system) 
    { 
@@ -172,16 +311,9 @@ bool EntityAdmin::addSystem(const SystemPtr& system)
       return false; 
    }
 
-   if (std::find(m_Systems.begin(), m_Systems.end(), system) != m_Systems.end()) 
-   { 
-      KORIN_CORE_WARN("System already exists in admin.");
-      return false;
-   }
-
-   KORIN_CORE_INFO("Adding System to admin.");
+   KORIN_CORE_INFO("Adding System " + desc.name + " to admin.");
    
-   m_Systems.push_back(system);
-   return true;
+   return m_Schedule.add(system, desc);
 }
 
 void EntityAdmin::removeSystem(SystemPtr system)
@@ -192,25 +324,20 @@ void EntityAdmin::removeSystem(SystemPtr system)
       return; 
    }
 
-   auto systemIt = std::find(m_Systems.begin(), m_Systems.end(), system);
-   if (systemIt == m_Systems.end()) 
+   if (!m_Schedule.remove(system)) 
    { 
       KORIN_CORE_WARN("System does not exist in admin.");
-      return;
    }
-
-   m_Systems.erase(
-      std::remove(m_Systems.begin(), m_Systems.end(), system), m_Systems.end()
-   );
 }
 
-void EntityAdmin::updateInputSystem()
+void EntityAdmin::updatePhase(SystemPhase phase, float timeStep)
 {
-}
+   if (!m_Schedule.phaseEnabled(phase))
+   {
+      return;
+   }
 
-void EntityAdmin::updateSystems(float timeStep)
-{
-   for (auto& system : m_Systems)
+   for (const auto& system : m_Schedule.phase(phase))
    {
       const auto componentTypeID = system->primaryComponentTypeID();
       const auto& componentItr = m_ComponentsByType.find(componentTypeID);
@@ -220,24 +347,111 @@ void EntityAdmin::updateSystems(float timeStep)
          continue;
       }
 
-      // All components of the same type are updated by the system.
-      for (auto& component : componentItr->second)
+      // All components of the same type are updated by the system. Any other component 
+      // that the system needs should be searched for in the siblings to each component.
+      system->updateBatch(timeStep, componentItr->second);
+   }
+}
+
+void EntityAdmin::notifyWorldRestored()
+{
+   for (std::size_t phase = 0; phase < SYSTEM_PHASE_COUNT; phase++)
+   {
+      for (const auto& system : m_Schedule.phase(static_cast<SystemPhase>(phase)))
       {
-         // Any other component that the system needs should be searched 
-         // for in the siblings to this component.
-         system->update(timeStep, component);
+         system->onWorldRestored();
       }
    }
 }
 
-void EntityAdmin::updateRenderSystem()
+void EntityAdmin::setResimulating(bool resimulating)
 {
+   for (std::size_t phase = 0; phase < SYSTEM_PHASE_COUNT; phase++)
+   {
+      for (const auto& system : m_Schedule.phase(static_cast<SystemPhase>(phase)))
+      {
+         system->setResimulating(resimulating);
+      }
+   }
 }
 
-void EntityAdmin::initSystems()
+void EntityAdmin::saveSystemStates(std::vector<std::vector<std::uint8_t>>& states)
 {
-   auto gameInput = std::make_shared<GameInputSystem>();
-   addSystem(gameInput);
+   states.resize(m_Schedule.size());
+   std::size_t index = 0;
+   for (std::size_t phase = 0; phase < SYSTEM_PHASE_COUNT; phase++)
+   {
+      for (const auto& system : m_Schedule.phase(static_cast<SystemPhase>(phase)))
+      {
+         states[index].clear();
+         system->saveState(states[index++]);
+      }
+   }
+}
+
+void EntityAdmin::loadSystemStates(const std::vector<std::vector<std::uint8_t>>& states)
+{
+   if (states.size() != m_Schedule.size())
+   {
+      KORIN_CORE_WARN("System states were saved with different systems and can't be loaded.");
+      return;
+   }
+
+   std::size_t index = 0;
+   for (std::size_t phase = 0; phase < SYSTEM_PHASE_COUNT; phase++)
+   {
+      for (const auto& system : m_Schedule.phase(static_cast<SystemPhase>(phase)))
+      {
+         system->loadState(states[index++]);
+      }
+   }
+}
+
+void EntityAdmin::updateSystems(float timeStep)
+{
+   updatePhase(SystemPhase::Input, timeStep);
+   updatePhase(SystemPhase::Simulation, timeStep);
+}
+
+void EntityAdmin::updateFrame(float deltaTime)
+{
+   updatePhase(SystemPhase::LateUpdate, deltaTime);
+   updatePhase(SystemPhase::Render, deltaTime);
+}
+
+void EntityAdmin::insertEntity(const EntityPtr& entity)
+{
+   m_Entities[entity->entityID()] = entity;
+   m_ComponentsByEntity[entity->entityID()] = std::vector<ComponentPtr>();
+   m_LivingEntityCount++;
+
+   // IDs handed out later must not collide with restored ones
+   if (entity->entityID() >= m_NextEntityID)
+   {
+      m_NextEntityID = entity->entityID() + 1;
+   }
+}
+
+void EntityAdmin::attachComponent(EntityID entityID, const ComponentPtr& component)
+{
+   auto& entityComponentTypes = m_ComponentsByEntity[entityID];
+
+   // Add siblings
+   for (auto& sibling : entityComponentTypes)
+   {
+      component->addSibling(sibling);
+      sibling->addSibling(component);
+   }
+
+   component->m_EntityID = entityID;
+   entityComponentTypes.emplace_back(component);
+   m_ComponentsByType[component->typeID()].emplace_back(component);
+}
+
+void EntityAdmin::addDefaultSystems(bool headless)
+{
+   auto gameInput = headless ? std::make_shared<GameInputSystem>(nullptr) : std::make_shared<GameInputSystem>();
+   addSystem(gameInput, {"GameInput", SystemPhase::Input});
 
    // Observer
    // Fixed update
@@ -257,7 +471,10 @@ void EntityAdmin::initSystems()
    // AI movement
 
    auto movementState = std::make_shared<MovementSystem>();
-   addSystem(movementState);
+   addSystem(movementState, {"Movement", SystemPhase::Simulation});
+
+   auto physics = std::make_shared<PhysicsSystem>();
+   addSystem(physics, {"Physics", SystemPhase::Simulation, {"Movement"}});
 
    // Simple movement
    // Unsynchronized movement
@@ -276,8 +493,14 @@ void EntityAdmin::initSystems()
    // Seen by
    // Idle animation 
    // Mover effect
-   // Spacial query
-   // Camera
+
+   auto spatialQuery = std::make_shared<SpatialQuerySystem>();
+   addSystem(spatialQuery, {"SpatialQuery", SystemPhase::Simulation, {"Physics"}});
+
+   auto renderSystem = std::make_shared<RenderSystem>();
+   auto camera = std::make_shared<CameraSystem>(renderSystem);
+   addSystem(camera, {"Camera", SystemPhase::LateUpdate});
+
    // POV
    // Map
    // Sound
@@ -285,14 +508,17 @@ void EntityAdmin::initSystems()
    // Hero full body effects
    // Update scene view flags
    // Resolve contact
+
+   auto collision = std::make_shared<CollisionSystem>();
+   addSystem(collision, {"Collision", SystemPhase::Simulation, {"SpatialQuery"}});
+
    // Interpolate movement state
    // Spacial query
    // World 
    // Game moderator
    // Game UX
 
-   auto renderSystem = std::make_shared<RenderSystem>();
-   addSystem(renderSystem);
+   addSystem(renderSystem, {"Render", SystemPhase::Render});
 
 
 
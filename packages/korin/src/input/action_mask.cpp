@@ -0,0 +1,57 @@
+// action_mask.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/input/action_mask.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+   #include <emmintrin.h>
+   #define KORIN_ACTION_MASK_SSE2
+#elif defined(__ARM_NEON)
+   #include <arm_neon.h>
+   #define KORIN_ACTION_MASK_NEON
+#endif
+
+using namespace korin;
+
+void korin::computeActionEdges(std::size_t count,
+   const ActionMask* previous, const ActionMask* current,
+   const ActionMask* pressed, const ActionMask* released,
+   ActionMask* begun, ActionMask* ended)
+{
+   std::size_t i = 0;
+
+#if defined(KORIN_ACTION_MASK_SSE2)
+   for (; i + 2 <= count; i += 2)
+   {
+      const __m128i before = _mm_loadu_si128(reinterpret_cast<const __m128i*>(previous + i));
+      const __m128i now = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current + i));
+      const __m128i down = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pressed + i));
+      const __m128i up = _mm_loadu_si128(reinterpret_cast<const __m128i*>(released + i));
+
+      // andnot(a, b) is ~a & b
+      const __m128i begunNow = _mm_or_si128(_mm_andnot_si128(before, now), down);
+      const __m128i endedNow = _mm_andnot_si128(now, _mm_or_si128(before, up));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(begun + i), begunNow);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(ended + i), endedNow);
+   }
+
+#elif defined(KORIN_ACTION_MASK_NEON)
+   for (; i + 2 <= count; i += 2)
+   {
+      const uint64x2_t before = vld1q_u64(previous + i);
+      const uint64x2_t now = vld1q_u64(current + i);
+
+      // bic(a, b) is a & ~b
+      vst1q_u64(begun + i, vorrq_u64(vbicq_u64(now, before), vld1q_u64(pressed + i)));
+      vst1q_u64(ended + i, vbicq_u64(vorrq_u64(before, vld1q_u64(released + i)), now));
+   }
+#endif
+
+   for (; i < count; i++)
+   {
+      begun[i] = (current[i] & ~previous[i]) | pressed[i];
+      ended[i] = (previous[i] | released[i]) & ~current[i];
+   }
+}
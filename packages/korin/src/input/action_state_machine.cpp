@@ -0,0 +1,197 @@
+// action_state_machine.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+
+#include "korin/input/action_state_machine.h"
+#include "korin/util/bit_util.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+using ActionCounter = std::array<ActionMask, ACTION_COUNTER_BITS>;
+
+constexpr std::uint32_t MAX_COUNT = (1u << ACTION_COUNTER_BITS) - 1;
+
+// Counters stop at MAX_COUNT, so they only pass through values below it exactly once
+constexpr std::uint32_t MAX_TICKS = MAX_COUNT - 1;
+
+// Adds one to the counters of the lanes, holding counters that are already at the maximum
+void incrementLanes(ActionCounter& counter, ActionMask lanes)
+{
+   ActionMask saturated = ~0ULL;
+   for (const ActionMask plane : counter)
+   {
+      saturated &= plane;
+   }
+
+   // Ripple carry across the bit planes
+   ActionMask carry = lanes & ~saturated;
+   for (ActionMask& plane : counter)
+   {
+      const ActionMask nextCarry = plane & carry;
+      plane ^= carry;
+      carry = nextCarry;
+   }
+}
+
+void clearLanes(ActionCounter& counter, ActionMask lanes)
+{
+   for (ActionMask& plane : counter)
+   {
+      plane &= ~lanes;
+   }
+}
+
+// Lanes whose counter equals the value
+ActionMask lanesEqual(const ActionCounter& counter, std::uint32_t value)
+{
+   ActionMask equal = ~0ULL;
+   for (std::size_t bit = 0; bit < ACTION_COUNTER_BITS; bit++)
+   {
+      const ActionMask expected = 0ULL - ((value >> bit) & 1u);
+      equal &= ~(counter[bit] ^ expected);
+   }
+   return equal;
+}
+} // namespace
+
+ActionStateMachine::ActionStateMachine()
+   : holdTicks(30), doubleTapTicks(15), comboGapTicks(20)
+   , m_ComboStarts(0), m_ComboEnds(0), m_StepsByAction(), m_ComboOfStep(), m_StepCount(0), m_ComboCount(0)
+{
+}
+
+std::int32_t ActionStateMachine::addCombo(std::initializer_list<GameAction> steps)
+{
+   if (steps.size() < 2 || m_StepCount + steps.size() > MAX_COMBO_STEPS || m_ComboCount >= MAX_COMBOS)
+   {
+      KORIN_CORE_WARN("Combo of " + std::to_string(steps.size()) + " steps doesn't fit in the ActionStateMachine.");
+      return -1;
+   }
+
+   for (const GameAction step : steps)
+   {
+      const ActionMask bits = toMask(step);
+      if (popCount(bits) != 1)
+      {
+         KORIN_CORE_WARN("Combo steps must be single GameActions.");
+         return -1;
+      }
+   }
+
+   if (comboGapTicks > MAX_TICKS)
+   {
+      KORIN_CORE_WARN("comboGapTicks of " + std::to_string(comboGapTicks) + " is above " 
+         + std::to_string(MAX_TICKS) + " and would never drop a combo. Clamping it.");
+      comboGapTicks = MAX_TICKS;
+   }
+
+   const std::uint32_t combo = m_ComboCount++;
+   m_ComboStarts |= 1ULL << m_StepCount;
+   for (const GameAction step : steps)
+   {
+      const int actionBit = countTrailingZeros(toMask(step));
+      m_StepsByAction[actionBit] |= 1ULL << m_StepCount;
+      m_ComboOfStep[m_StepCount] = static_cast<std::uint8_t>(combo);
+      m_StepCount++;
+   }
+   m_ComboEnds |= 1ULL << (m_StepCount - 1);
+
+   return static_cast<std::int32_t>(combo);
+}
+
+void ActionStateMachine::clearCombos()
+{
+   m_ComboStarts = 0;
+   m_ComboEnds = 0;
+   m_StepsByAction.fill(0);
+   m_StepCount = 0;
+   m_ComboCount = 0;
+}
+
+void ActionStateMachine::evaluate(InputStreamComponent& inputStream) const
+{
+   const ActionMask current = inputStream.currentActionStates;
+   const ActionMask begun = inputStream.actionsBegun;
+
+   // Holds count up while an action stays down and start over when it is released or pressed again
+   clearLanes(inputStream.holdCounter, ~current | begun);
+   incrementLanes(inputStream.holdCounter, current);
+   const ActionMask reached = lanesEqual(inputStream.holdCounter, std::min(std::max(holdTicks, 1u), MAX_TICKS)) & current;
+   inputStream.actionsHoldBegun = reached;
+   inputStream.actionsHeld = ((inputStream.actionsHeld & ~begun) | reached) & current;
+
+   // A press opens a window for its action. A press inside an open window is a double tap
+   // and closes it, so a triple tap doesn't double tap twice. The tap counter holds the
+   // ticks since the window opened, and the window closes once that passes doubleTapTicks.
+   const ActionMask doubleTapped = begun & inputStream.tapArmed;
+   inputStream.actionsDoubleTapped = doubleTapped;
+   inputStream.tapArmed = (inputStream.tapArmed & ~begun) | (begun & ~doubleTapped);
+   clearLanes(inputStream.tapCounter, begun);
+   incrementLanes(inputStream.tapCounter, inputStream.tapArmed);
+   inputStream.tapArmed &= ~lanesEqual(inputStream.tapCounter, std::min(doubleTapTicks, MAX_TICKS) + 1);
+
+   // Each press moves every partial match one step along if the press is that step's action
+   std::uint32_t completed = 0;
+   if (begun == 0)
+   {
+      inputStream.comboIdleTicks = std::min(inputStream.comboIdleTicks + 1, MAX_COUNT);
+      if (inputStream.comboIdleTicks > std::min(comboGapTicks, MAX_TICKS))
+      {
+         inputStream.comboState = 0;
+      }
+   }
+   else if (m_StepCount > 0)
+   {
+      inputStream.comboIdleTicks = 0;
+
+      // Actions pressed on the same tick count as steps in the order of their bits
+      ActionMask pressed = begun;
+      std::uint64_t state = inputStream.comboState;
+      while (pressed)
+      {
+         state = ((state << 1) | m_ComboStarts) & m_StepsByAction[countTrailingZeros(pressed)];
+         std::uint64_t finished = state & m_ComboEnds;
+         while (finished)
+         {
+            completed |= 1u << m_ComboOfStep[countTrailingZeros(finished)];
+            finished &= finished - 1;
+         }
+         pressed &= pressed - 1;
+      }
+      inputStream.comboState = state;
+   }
+   inputStream.combosCompleted = completed;
+}
+
+void ActionStateMachine::evaluateBatch(const std::vector<ComponentPtr>& inputStreams) const
+{
+   for (const auto& component : inputStreams)
+   {
+      KORIN_ASSERT(component->typeID() == Component::typeID<InputStreamComponent>());
+      evaluate(*static_cast<InputStreamComponent*>(component.get()));
+   }
+}
+
+std::uint32_t ActionStateMachine::heldTicks(const InputStreamComponent& inputStream, GameAction action)
+{
+   const ActionMask bits = toMask(action);
+   if (popCount(bits) != 1)
+   {
+      return 0;
+   }
+
+   const int lane = countTrailingZeros(bits);
+   std::uint32_t ticks = 0;
+   for (std::size_t bit = 0; bit < ACTION_COUNTER_BITS; bit++)
+   {
+      ticks |= static_cast<std::uint32_t>((inputStream.holdCounter[bit] >> lane) & 1u) << bit;
+   }
+   return ticks;
+}
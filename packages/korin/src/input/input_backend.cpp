@@ -0,0 +1,33 @@
+// input_backend.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <chrono>
+
+#include "korin/input/input_backend.h"
+
+#if defined(KORIN_PLATFORM_MACOSX)
+#include "korin/input/mac_input_backend.h"
+#elif defined(KORIN_PLATFORM_LINUX)
+#include "korin/input/linux_input_backend.h"
+#endif
+
+using namespace korin;
+
+std::unique_ptr<InputBackend> InputBackend::createPlatformBackend()
+{
+   #if defined(KORIN_PLATFORM_MACOSX)
+      return std::make_unique<MacInputBackend>();
+   #elif defined(KORIN_PLATFORM_LINUX)
+      return std::make_unique<LinuxInputBackend>();
+   #else
+      return nullptr;
+   #endif
+}
+
+std::uint64_t InputBackend::now()
+{
+   const auto sinceEpoch = std::chrono::steady_clock::now().time_since_epoch();
+   return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(sinceEpoch).count());
+}
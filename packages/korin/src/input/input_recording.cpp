@@ -0,0 +1,231 @@
+// input_recording.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <fstream>
+#include <iterator>
+
+#include "korin/input/input_recording.h"
+#include "korin/components/input_stream_component.h"
+#include "korin/util/byte_stream.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+constexpr std::size_t HEADER_SIZE = 12;
+constexpr std::size_t TICK_COUNT_OFFSET = 8;
+constexpr std::uint32_t NO_BLOCK = UINT32_MAX;
+} // namespace
+
+InputRecorder::InputRecorder()
+   : m_Data(std::vector<std::uint8_t>()), m_TickCount(0), m_LastWrittenTick(0)
+   , m_LastStates(std::vector<ActionMask>()), m_Entries(std::vector<Entry>())
+{
+   begin();
+}
+
+void InputRecorder::begin()
+{
+   m_Data.clear();
+   m_TickCount = 0;
+   m_LastWrittenTick = 0;
+   m_LastStates.clear();
+
+   ByteWriter writer(m_Data);
+   writer.writeU32(INPUT_RECORDING_MAGIC);
+   writer.writeU16(INPUT_RECORDING_VERSION);
+   writer.writeU16(0);
+   writer.writeU32(0);
+}
+
+void InputRecorder::recordTick(const std::vector<ComponentPtr>& inputStreams)
+{
+   m_Entries.clear();
+   for (const auto& component : inputStreams)
+   {
+      KORIN_ASSERT(component->typeID() == Component::typeID<InputStreamComponent>());
+      const auto* inputStream = static_cast<const InputStreamComponent*>(component.get());
+      const EntityID entityID = inputStream->entityID();
+
+      // Streams that aren't on an entity can't be matched up on replay
+      if (entityID == INVALID_ENTITY_ID)
+      {
+         continue;
+      }
+
+      if (entityID >= m_LastStates.size())
+      {
+         m_LastStates.resize(entityID + 1, 0);
+      }
+
+      const ActionMask changes = inputStream->currentActionStates ^ m_LastStates[entityID];
+      if (changes == 0 && inputStream->actionsBegun == 0 && inputStream->actionsEnded == 0)
+      {
+         continue;
+      }
+
+      m_LastStates[entityID] = inputStream->currentActionStates;
+      m_Entries.push_back({entityID, changes, inputStream->actionsBegun, inputStream->actionsEnded});
+   }
+
+   if (!m_Entries.empty())
+   {
+      ByteWriter writer(m_Data);
+      writer.writeVarint(m_TickCount - m_LastWrittenTick);
+      writer.writeVarint(m_Entries.size());
+      for (const Entry& entry : m_Entries)
+      {
+         writer.writeVarint(entry.entityID);
+         writer.writeVarint(entry.changes);
+         writer.writeVarint(entry.begun);
+         writer.writeVarint(entry.ended);
+      }
+      m_LastWrittenTick = m_TickCount;
+   }
+
+   m_TickCount++;
+   ByteWriter(m_Data).patchU32(TICK_COUNT_OFFSET, m_TickCount);
+}
+
+bool InputRecorder::saveToFile(const std::string& path) const
+{
+   std::ofstream file(path, std::ios::binary | std::ios::trunc);
+   if (!file)
+   {
+      KORIN_CORE_WARN("Could not open " + path + " to save the input recording.");
+      return false;
+   }
+
+   file.write(reinterpret_cast<const char*>(m_Data.data()), static_cast<std::streamsize>(m_Data.size()));
+   return static_cast<bool>(file);
+}
+
+InputPlayer::InputPlayer()
+   : m_Data(std::vector<std::uint8_t>()), m_Position(0), m_TickCount(0), m_Tick(0)
+   , m_NextBlockTick(NO_BLOCK), m_NextBlockEntries(0)
+   , m_States(std::vector<State>()), m_Touched(std::vector<EntityID>())
+{
+}
+
+bool InputPlayer::load(std::vector<std::uint8_t> data)
+{
+   ByteReader reader(data);
+   std::uint32_t magic = 0, tickCount = 0;
+   std::uint16_t version = 0, reserved = 0;
+   if (!reader.readU32(magic) || !reader.readU16(version) || !reader.readU16(reserved) || !reader.readU32(tickCount) 
+      || magic != INPUT_RECORDING_MAGIC)
+   {
+      KORIN_CORE_WARN("Input recording header is invalid.");
+      return false;
+   }
+
+   if (version != INPUT_RECORDING_VERSION)
+   {
+      KORIN_CORE_WARN("Input recording version(" + std::to_string(version) + ") is not supported.");
+      return false;
+   }
+
+   m_Data = std::move(data);
+   m_Position = HEADER_SIZE;
+   m_TickCount = tickCount;
+   m_Tick = 0;
+   m_States.clear();
+   m_Touched.clear();
+   m_NextBlockTick = 0;
+   readBlockHeader();
+   return true;
+}
+
+bool InputPlayer::loadFromFile(const std::string& path)
+{
+   std::ifstream file(path, std::ios::binary);
+   if (!file)
+   {
+      KORIN_CORE_WARN("Could not open input recording " + path);
+      return false;
+   }
+
+   return load(std::vector<std::uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+}
+
+bool InputPlayer::playTick(const std::vector<ComponentPtr>& inputStreams)
+{
+   if (finished())
+   {
+      return false;
+   }
+
+   // Taps only last for the tick they were recorded on
+   for (const EntityID entityID : m_Touched)
+   {
+      m_States[entityID].begun = 0;
+      m_States[entityID].ended = 0;
+   }
+   m_Touched.clear();
+
+   if (m_Tick == m_NextBlockTick)
+   {
+      ByteReader reader(m_Data.data() + m_Position, m_Data.size() - m_Position);
+      for (std::uint32_t i = 0; i < m_NextBlockEntries; i++)
+      {
+         std::uint32_t entityID = 0;
+         ActionMask changes = 0, begun = 0, ended = 0;
+         if (!reader.readVarint(entityID) || !reader.readVarint(changes) || !reader.readVarint(begun) || !reader.readVarint(ended))
+         {
+            KORIN_CORE_WARN("Input recording is truncated at tick " + std::to_string(m_Tick));
+            m_TickCount = m_Tick;
+            return false;
+         }
+
+         if (entityID >= m_States.size())
+         {
+            m_States.resize(entityID + 1, {0, 0, 0});
+         }
+         State& state = m_States[entityID];
+         state.current ^= changes;
+         state.begun = begun;
+         state.ended = ended;
+         m_Touched.push_back(entityID);
+      }
+
+      m_Position += reader.position();
+      readBlockHeader();
+   }
+
+   for (const auto& component : inputStreams)
+   {
+      KORIN_ASSERT(component->typeID() == Component::typeID<InputStreamComponent>());
+      auto* inputStream = static_cast<InputStreamComponent*>(component.get());
+      const EntityID entityID = inputStream->entityID();
+      const State state = entityID < m_States.size() ? m_States[entityID] : State{0, 0, 0};
+
+      inputStream->previousActionStates = inputStream->currentActionStates;
+      inputStream->currentActionStates = state.current;
+      inputStream->actionsBegun = state.begun;
+      inputStream->actionsEnded = state.ended;
+   }
+
+   m_Tick++;
+   return true;
+}
+
+void InputPlayer::readBlockHeader()
+{
+   ByteReader reader(m_Data.data() + m_Position, m_Data.size() - m_Position);
+   std::uint32_t tickDelta = 0, entries = 0;
+   if (reader.atEnd() || !reader.readVarint(tickDelta) || !reader.readVarint(entries))
+   {
+      m_NextBlockTick = NO_BLOCK;
+      m_NextBlockEntries = 0;
+      return;
+   }
+
+   // Blocks count their tick from the block before them, the first one from tick 0
+   m_NextBlockTick = m_Tick + tickDelta;
+   m_NextBlockEntries = entries;
+   m_Position += reader.position();
+}
@@ -0,0 +1,346 @@
+// linux_input_backend.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#ifdef KORIN_PLATFORM_LINUX
+
+#include <algorithm>
+#include <cerrno>
+#include <ctime>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <linux/input.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include "korin/input/linux_input_backend.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+constexpr std::size_t READ_BATCH = 64;
+
+// Absolute axes reported on input axes 2 to 5
+constexpr std::array<std::uint16_t, 4> ABSOLUTE_AXIS_CODES = {ABS_X, ABS_Y, ABS_RX, ABS_RY};
+constexpr std::size_t ABSOLUTE_AXIS_BASE = 2;
+constexpr std::size_t ABSOLUTE_AXIS_COUNT = ABSOLUTE_AXIS_CODES.size();
+
+bool testBit(const std::uint8_t* bits, std::size_t bit)
+{
+   return (bits[bit / 8] >> (bit % 8)) & 1;
+}
+
+std::uint64_t toMicroseconds(const timeval& time)
+{
+   return static_cast<std::uint64_t>(time.tv_sec) * 1000000ULL + static_cast<std::uint64_t>(time.tv_usec);
+}
+} // namespace
+
+LinuxInputBackend::LinuxInputBackend()
+   : LinuxInputBackend(std::vector<std::string>())
+{
+}
+
+LinuxInputBackend::LinuxInputBackend(std::vector<std::string> devicePaths)
+   : m_DevicePaths(std::move(devicePaths)), m_Devices(std::vector<Device>()), m_WakeFileDescriptor(-1)
+{
+}
+
+LinuxInputBackend::~LinuxInputBackend()
+{
+   stop();
+}
+
+bool LinuxInputBackend::start()
+{
+   if (m_Thread.joinable())
+   {
+      return true;
+   }
+
+   if (m_DevicePaths.empty())
+   {
+      if (DIR* directory = opendir("/dev/input"))
+      {
+         while (dirent* entry = readdir(directory))
+         {
+            const std::string name = entry->d_name;
+            if (name.rfind("event", 0) == 0)
+            {
+               openDevice("/dev/input/" + name);
+            }
+         }
+         closedir(directory);
+      }
+   }
+   else
+   {
+      for (const auto& path : m_DevicePaths)
+      {
+         openDevice(path);
+      }
+   }
+
+   if (m_Devices.empty())
+   {
+      KORIN_CORE_WARN("No readable evdev input devices. Is the user in the input group?");
+      return false;
+   }
+
+   m_WakeFileDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+   if (m_WakeFileDescriptor < 0)
+   {
+      KORIN_CORE_WARN("Could not create the input wake eventfd.");
+      closeDevices();
+      return false;
+   }
+
+   m_Thread = std::thread(&LinuxInputBackend::readLoop, this);
+   return true;
+}
+
+void LinuxInputBackend::stop()
+{
+   if (m_Thread.joinable())
+   {
+      const std::uint64_t wake = 1;
+      if (write(m_WakeFileDescriptor, &wake, sizeof(wake)) < 0)
+      {
+         KORIN_CORE_WARN("Could not wake the input thread.");
+      }
+      m_Thread.join();
+   }
+
+   if (m_WakeFileDescriptor >= 0)
+   {
+      close(m_WakeFileDescriptor);
+      m_WakeFileDescriptor = -1;
+   }
+
+   closeDevices();
+}
+
+bool LinuxInputBackend::openDevice(const std::string& path)
+{
+   const int fileDescriptor = open(path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+   if (fileDescriptor < 0)
+   {
+      return false;
+   }
+
+   // Only devices with keys, buttons or relative motion are worth reading
+   std::uint8_t eventTypes[(EV_MAX + 7) / 8] = {};
+   if (ioctl(fileDescriptor, EVIOCGBIT(0, sizeof(eventTypes)), eventTypes) < 0 
+      || (!testBit(eventTypes, EV_KEY) && !testBit(eventTypes, EV_REL)))
+   {
+      close(fileDescriptor);
+      return false;
+   }
+
+   Device device;
+   device.fileDescriptor = fileDescriptor;
+   device.path = path;
+   device.dropping = false;
+
+   int clock = CLOCK_MONOTONIC;
+   device.monotonicTimestamps = ioctl(fileDescriptor, EVIOCSCLOCKID, &clock) == 0;
+
+   for (std::size_t axis = 0; axis < ABSOLUTE_AXIS_COUNT; axis++)
+   {
+      input_absinfo info = {};
+      const bool hasAxis = testBit(eventTypes, EV_ABS) 
+         && ioctl(fileDescriptor, EVIOCGABS(ABSOLUTE_AXIS_CODES[axis]), &info) == 0 && info.maximum > info.minimum;
+      device.absoluteAxes[axis] = hasAxis ? AbsoluteAxis{info.minimum, info.maximum} : AbsoluteAxis{0, 0};
+   }
+
+   KORIN_CORE_INFO("Reading input from " + path);
+   m_Devices.push_back(device);
+
+   // Keys already held when we start are reported as pressed
+   resynchronize(m_Devices.back());
+   return true;
+}
+
+void LinuxInputBackend::closeDevices()
+{
+   for (const auto& device : m_Devices)
+   {
+      close(device.fileDescriptor);
+   }
+   m_Devices.clear();
+}
+
+void LinuxInputBackend::readLoop()
+{
+   std::vector<pollfd> pollDescriptors;
+   pollDescriptors.push_back({m_WakeFileDescriptor, POLLIN, 0});
+   for (const auto& device : m_Devices)
+   {
+      pollDescriptors.push_back({device.fileDescriptor, POLLIN, 0});
+   }
+
+   while (true)
+   {
+      if (::poll(pollDescriptors.data(), pollDescriptors.size(), -1) < 0)
+      {
+         if (errno == EINTR)
+         {
+            continue;
+         }
+         KORIN_CORE_WARN("Polling input devices failed.");
+         return;
+      }
+
+      if (pollDescriptors[0].revents & POLLIN)
+      {
+         return;
+      }
+
+      for (std::size_t i = 1; i < pollDescriptors.size(); i++)
+      {
+         if (pollDescriptors[i].revents & POLLIN)
+         {
+            readDevice(m_Devices[i - 1]);
+         }
+
+         if (pollDescriptors[i].revents & (POLLERR | POLLHUP | POLLNVAL))
+         {
+            // Unplugged devices stop being polled, the kernel won't send anything else,
+            // so whatever was held through them is let go now
+            KORIN_CORE_WARN("Input device " + m_Devices[i - 1].path + " went away.");
+            releaseKeys(m_Devices[i - 1]);
+            pollDescriptors[i].fd = -1;
+         }
+      }
+   }
+}
+
+void LinuxInputBackend::readDevice(Device& device)
+{
+   input_event events[READ_BATCH];
+   while (true)
+   {
+      const ssize_t bytesRead = read(device.fileDescriptor, events, sizeof(events));
+      if (bytesRead <= 0)
+      {
+         return;
+      }
+
+      const std::size_t count = static_cast<std::size_t>(bytesRead) / sizeof(input_event);
+      for (std::size_t i = 0; i < count; i++)
+      {
+         const input_event& event = events[i];
+         const std::uint64_t timestamp = device.monotonicTimestamps ? toMicroseconds(event.time) : now();
+
+         // After the kernel's buffer overflows everything up to the next report is unreliable
+         if (event.type == EV_SYN)
+         {
+            if (event.code == SYN_DROPPED)
+            {
+               device.dropping = true;
+            }
+            else if (event.code == SYN_REPORT && device.dropping)
+            {
+               device.dropping = false;
+               resynchronize(device);
+            }
+            continue;
+         }
+
+         if (device.dropping)
+         {
+            continue;
+         }
+
+         switch (event.type)
+         {
+            case EV_KEY:
+               // Value 2 is a key repeat, which isn't a new press
+               if (event.value != 2 && event.code < BUTTON_INPUT_CODE_BASE)
+               {
+                  pushKey(device, event.code, event.value == 1, timestamp);
+               }
+               break;
+
+            case EV_REL:
+               if (event.code == REL_X || event.code == REL_Y)
+               {
+                  pushEvent({timestamp, InputEventType::Axis, static_cast<std::uint16_t>(event.code == REL_X ? 0 : 1), 
+                     static_cast<float>(event.value)});
+               }
+               break;
+
+            case EV_ABS:
+               for (std::size_t axis = 0; axis < ABSOLUTE_AXIS_COUNT; axis++)
+               {
+                  const AbsoluteAxis& range = device.absoluteAxes[axis];
+                  if (event.code == ABSOLUTE_AXIS_CODES[axis] && range.maximum > range.minimum)
+                  {
+                     const float normalized = static_cast<float>(event.value - range.minimum) / static_cast<float>(range.maximum - range.minimum);
+                     pushEvent({timestamp, InputEventType::Axis, static_cast<std::uint16_t>(ABSOLUTE_AXIS_BASE + axis), 
+                        normalized * 2.0f - 1.0f});
+                  }
+               }
+               break;
+
+            default:
+               break;
+         }
+      }
+   }
+}
+
+void LinuxInputBackend::resynchronize(Device& device)
+{
+   std::uint8_t keys[(KEY_MAX + 7) / 8] = {};
+   if (ioctl(device.fileDescriptor, EVIOCGKEY(sizeof(keys)), keys) < 0)
+   {
+      return;
+   }
+
+   const std::uint64_t timestamp = now();
+   for (std::uint16_t code = 0; code < BUTTON_INPUT_CODE_BASE; code++)
+   {
+      const bool down = testBit(keys, code);
+      if (down != device.keysDown.test(code))
+      {
+         pushKey(device, code, down, timestamp);
+      }
+   }
+}
+
+void LinuxInputBackend::releaseKeys(Device& device)
+{
+   const std::uint64_t timestamp = now();
+   for (std::uint16_t code = 0; code < BUTTON_INPUT_CODE_BASE; code++)
+   {
+      if (device.keysDown.test(code))
+      {
+         pushKey(device, code, false, timestamp);
+      }
+   }
+   device.keysDown.reset();
+}
+
+void LinuxInputBackend::pushKey(Device& device, std::uint16_t code, bool down, std::uint64_t timestamp)
+{
+   device.keysDown.set(code, down);
+
+   // Mouse buttons line up with the button numbers of the other platforms
+   if (code >= BTN_LEFT && code <= BTN_MIDDLE)
+   {
+      pushEvent({timestamp, down ? InputEventType::ButtonDown : InputEventType::ButtonUp, 
+         static_cast<std::uint16_t>(code - BTN_LEFT), 0.0f});
+      return;
+   }
+
+   pushEvent({timestamp, down ? InputEventType::KeyDown : InputEventType::KeyUp, code, 0.0f});
+}
+
+#endif // KORIN_PLATFORM_LINUX
@@ -0,0 +1,174 @@
+// mac_input_backend.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#ifdef KORIN_PLATFORM_MACOSX
+
+#include <ApplicationServices/ApplicationServices.h>
+
+#include "korin/input/mac_input_backend.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+CGEventRef eventTapCallback(CGEventTapProxy proxy, CGEventType type, CGEventRef event, void* userInfo)
+{
+   MacInputBackend::tapCallback(proxy, type, event, userInfo);
+   return event;
+}
+} // namespace
+
+MacInputBackend::MacInputBackend()
+   : m_EventTap(nullptr), m_RunLoop(nullptr)
+{
+}
+
+MacInputBackend::~MacInputBackend()
+{
+   stop();
+}
+
+bool MacInputBackend::start()
+{
+   if (m_Thread.joinable())
+   {
+      return true;
+   }
+
+   CGRequestListenEventAccess();
+
+   const CGEventMask mask = CGEventMaskBit(kCGEventKeyDown) | CGEventMaskBit(kCGEventKeyUp)
+      | CGEventMaskBit(kCGEventFlagsChanged) | CGEventMaskBit(kCGEventMouseMoved)
+      | CGEventMaskBit(kCGEventLeftMouseDown) | CGEventMaskBit(kCGEventLeftMouseUp)
+      | CGEventMaskBit(kCGEventRightMouseDown) | CGEventMaskBit(kCGEventRightMouseUp)
+      | CGEventMaskBit(kCGEventOtherMouseDown) | CGEventMaskBit(kCGEventOtherMouseUp);
+
+   CFMachPortRef eventTap = CGEventTapCreate(kCGSessionEventTap, kCGHeadInsertEventTap, 
+      kCGEventTapOptionListenOnly, mask, eventTapCallback, this);
+   if (!eventTap)
+   {
+      KORIN_CORE_WARN("Input event tap could not be created. Input monitoring access may be missing.");
+      return false;
+   }
+
+   m_EventTap = eventTap;
+   m_Thread = std::thread(&MacInputBackend::runLoop, this);
+   return true;
+}
+
+void MacInputBackend::stop()
+{
+   if (!m_Thread.joinable())
+   {
+      return;
+   }
+
+   // The run loop is published by the thread once it is ready to be stopped
+   void* runLoop = nullptr;
+   while (!(runLoop = m_RunLoop.load(std::memory_order_acquire)))
+   {
+      std::this_thread::yield();
+   }
+
+   CFRunLoopStop(static_cast<CFRunLoopRef>(runLoop));
+   m_Thread.join();
+   m_RunLoop.store(nullptr, std::memory_order_relaxed);
+
+   CFRelease(static_cast<CFMachPortRef>(m_EventTap));
+   m_EventTap = nullptr;
+}
+
+void MacInputBackend::runLoop()
+{
+   CFMachPortRef eventTap = static_cast<CFMachPortRef>(m_EventTap);
+   CFRunLoopSourceRef source = CFMachPortCreateRunLoopSource(kCFAllocatorDefault, eventTap, 0);
+   CFRunLoopRef runLoop = CFRunLoopGetCurrent();
+   CFRunLoopAddSource(runLoop, source, kCFRunLoopCommonModes);
+   CGEventTapEnable(eventTap, true);
+
+   m_RunLoop.store(runLoop, std::memory_order_release);
+   CFRunLoopRun();
+
+   CGEventTapEnable(eventTap, false);
+   CFRunLoopRemoveSource(runLoop, source, kCFRunLoopCommonModes);
+   CFRelease(source);
+}
+
+void* MacInputBackend::tapCallback(void* proxy, std::uint32_t type, void* event, void* userInfo)
+{
+   static_cast<MacInputBackend*>(userInfo)->handleEvent(type, event);
+   return event;
+}
+
+void MacInputBackend::handleEvent(std::uint32_t type, void* eventRef)
+{
+   CGEventRef event = static_cast<CGEventRef>(eventRef);
+   InputEvent inputEvent = {now(), InputEventType::KeyDown, 0, 0.0f};
+
+   switch (static_cast<CGEventType>(type))
+   {
+      case kCGEventTapDisabledByTimeout:
+      case kCGEventTapDisabledByUserInput:
+         // The system turns slow taps off, turn it back on
+         CGEventTapEnable(static_cast<CFMachPortRef>(m_EventTap), true);
+         return;
+
+      case kCGEventKeyDown:
+      case kCGEventKeyUp:
+         // Key repeats aren't new presses
+         if (CGEventGetIntegerValueField(event, kCGKeyboardEventAutorepeat))
+         {
+            return;
+         }
+         inputEvent.type = type == kCGEventKeyDown ? InputEventType::KeyDown : InputEventType::KeyUp;
+         inputEvent.code = static_cast<std::uint16_t>(CGEventGetIntegerValueField(event, kCGKeyboardEventKeycode));
+         break;
+
+      case kCGEventFlagsChanged:
+      {
+         const std::uint16_t keyCode = static_cast<std::uint16_t>(CGEventGetIntegerValueField(event, kCGKeyboardEventKeycode));
+         if (keyCode >= m_ModifiersDown.size())
+         {
+            return;
+         }
+         m_ModifiersDown.flip(keyCode);
+         inputEvent.type = m_ModifiersDown.test(keyCode) ? InputEventType::KeyDown : InputEventType::KeyUp;
+         inputEvent.code = keyCode;
+         break;
+      }
+
+      case kCGEventLeftMouseDown:
+      case kCGEventRightMouseDown:
+      case kCGEventOtherMouseDown:
+         inputEvent.type = InputEventType::ButtonDown;
+         inputEvent.code = static_cast<std::uint16_t>(CGEventGetIntegerValueField(event, kCGMouseEventButtonNumber));
+         break;
+
+      case kCGEventLeftMouseUp:
+      case kCGEventRightMouseUp:
+      case kCGEventOtherMouseUp:
+         inputEvent.type = InputEventType::ButtonUp;
+         inputEvent.code = static_cast<std::uint16_t>(CGEventGetIntegerValueField(event, kCGMouseEventButtonNumber));
+         break;
+
+      case kCGEventMouseMoved:
+         // Mouse deltas go out on axes 0 and 1
+         inputEvent.type = InputEventType::Axis;
+         inputEvent.code = 0;
+         inputEvent.value = static_cast<float>(CGEventGetIntegerValueField(event, kCGMouseEventDeltaX));
+         pushEvent(inputEvent);
+         inputEvent.code = 1;
+         inputEvent.value = static_cast<float>(CGEventGetIntegerValueField(event, kCGMouseEventDeltaY));
+         break;
+
+      default:
+         return;
+   }
+
+   pushEvent(inputEvent);
+}
+
+#endif // KORIN_PLATFORM_MACOSX
@@ -0,0 +1,182 @@
+// scripted_input_backend.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "korin/input/scripted_input_backend.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+ScriptedInputBackend::ScriptedInputBackend()
+   : m_Events(std::vector<ScriptedEvent>()), m_Sorted(true), m_NextEvent(0), m_Frame(0)
+   , m_Length(0), m_Looping(false)
+{
+}
+
+void ScriptedInputBackend::poll()
+{
+   if (!m_Sorted)
+   {
+      // Stable so events on the same frame keep the order they were scheduled in
+      std::stable_sort(m_Events.begin(), m_Events.end(), 
+         [](const ScriptedEvent& a, const ScriptedEvent& b) { return a.frame < b.frame; });
+      m_Sorted = true;
+      m_NextEvent = static_cast<std::size_t>(std::lower_bound(m_Events.begin(), m_Events.end(), m_Frame, 
+         [](const ScriptedEvent& event, std::uint32_t frame) { return event.frame < frame; }) - m_Events.begin());
+   }
+
+   if (m_Looping && length() > 0 && m_Frame >= length())
+   {
+      rewind();
+   }
+
+   const std::uint64_t timestamp = now();
+   while (m_NextEvent < m_Events.size() && m_Events[m_NextEvent].frame == m_Frame)
+   {
+      const ScriptedEvent& event = m_Events[m_NextEvent++];
+      pushEvent({timestamp, event.type, event.code, event.value});
+   }
+
+   m_Frame++;
+}
+
+void ScriptedInputBackend::schedule(std::uint32_t frame, InputEventType type, std::uint16_t code, float value)
+{
+   // Events for a frame that already passed are sorted behind the current frame, 
+   // otherwise they'd wait at the front and hold back every event after them
+   m_Sorted = m_Sorted && frame >= m_Frame && (m_Events.empty() || m_Events.back().frame <= frame);
+   m_Events.push_back({frame, type, code, value});
+}
+
+void ScriptedInputBackend::tap(std::uint32_t frame, std::uint16_t keyCode)
+{
+   schedule(frame, InputEventType::KeyDown, keyCode);
+   schedule(frame, InputEventType::KeyUp, keyCode);
+}
+
+bool ScriptedInputBackend::loadScript(const std::string& script)
+{
+   std::vector<ScriptedEvent> events;
+   std::uint32_t length = m_Length;
+   std::istringstream lines(script);
+   std::string line;
+   std::uint32_t lineNumber = 0;
+
+   while (std::getline(lines, line))
+   {
+      lineNumber++;
+      line = line.substr(0, line.find('#'));
+
+      std::istringstream words(line);
+      std::uint32_t frame = 0;
+      std::string command;
+      if (!(words >> frame))
+      {
+         // Blank and comment only lines have nothing to read
+         if (line.find_first_not_of(" \t\r") == std::string::npos)
+         {
+            continue;
+         }
+         KORIN_CORE_WARN("Input script line " + std::to_string(lineNumber) + " doesn't start with a frame.");
+         return false;
+      }
+
+      if (!(words >> command))
+      {
+         KORIN_CORE_WARN("Input script line " + std::to_string(lineNumber) + " has no command.");
+         return false;
+      }
+
+      if (command == "end")
+      {
+         length = frame;
+         continue;
+      }
+
+      // Keys and buttons have to land inside the input code space once the button base is added
+      std::uint32_t code = 0;
+      float value = 0.0f;
+      const bool hasCode = static_cast<bool>(words >> code);
+      const bool isKey = hasCode && code < BUTTON_INPUT_CODE_BASE;
+      const bool isButton = hasCode && code < INPUT_CODE_COUNT - BUTTON_INPUT_CODE_BASE;
+      if (command == "down" && isKey)
+      {
+         events.push_back({frame, InputEventType::KeyDown, static_cast<std::uint16_t>(code), 0.0f});
+      }
+      else if (command == "up" && isKey)
+      {
+         events.push_back({frame, InputEventType::KeyUp, static_cast<std::uint16_t>(code), 0.0f});
+      }
+      else if (command == "tap" && isKey)
+      {
+         events.push_back({frame, InputEventType::KeyDown, static_cast<std::uint16_t>(code), 0.0f});
+         events.push_back({frame, InputEventType::KeyUp, static_cast<std::uint16_t>(code), 0.0f});
+      }
+      else if (command == "button_down" && isButton)
+      {
+         events.push_back({frame, InputEventType::ButtonDown, static_cast<std::uint16_t>(code), 0.0f});
+      }
+      else if (command == "button_up" && isButton)
+      {
+         events.push_back({frame, InputEventType::ButtonUp, static_cast<std::uint16_t>(code), 0.0f});
+      }
+      else if (command == "axis" && hasCode && code < INPUT_AXIS_COUNT && (words >> value))
+      {
+         events.push_back({frame, InputEventType::Axis, static_cast<std::uint16_t>(code), value});
+      }
+      else
+      {
+         KORIN_CORE_WARN("Input script line " + std::to_string(lineNumber) + " can't be read: " + line);
+         return false;
+      }
+   }
+
+   for (const ScriptedEvent& event : events)
+   {
+      schedule(event.frame, event.type, event.code, event.value);
+   }
+   m_Length = length;
+   return true;
+}
+
+bool ScriptedInputBackend::loadScriptFile(const std::string& path)
+{
+   std::ifstream file(path);
+   if (!file)
+   {
+      KORIN_CORE_WARN("Could not open input script " + path);
+      return false;
+   }
+
+   std::stringstream script;
+   script << file.rdbuf();
+   return loadScript(script.str());
+}
+
+void ScriptedInputBackend::clear()
+{
+   m_Events.clear();
+   m_Sorted = true;
+   m_Length = 0;
+   rewind();
+}
+
+std::uint32_t ScriptedInputBackend::length() const
+{
+   if (m_Length > 0)
+   {
+      return m_Length;
+   }
+
+   std::uint32_t lastFrame = 0;
+   for (const ScriptedEvent& event : m_Events)
+   {
+      lastFrame = std::max(lastFrame, event.frame + 1);
+   }
+   return lastFrame;
+}
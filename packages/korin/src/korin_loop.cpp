@@ -5,12 +5,13 @@
 
 #include "korin/korin_loop.h"
 #include "korin/entity_admin.h"
+#include "korin/netcode/rollback_session.h"
 
 using namespace korin;
 
 void KorinLoop::run()
 {
-   while(true)
+   while(running)
    {
       tickFixed();
    }
@@ -19,34 +20,52 @@ void KorinLoop::run()
 void KorinLoop::tickFixed()
 {
    // Get the current time in seconds
-   const auto currentTime = std::chrono::high_resolution_clock::now();
+   const auto currentTime = std::chrono::steady_clock::now();
    const std::chrono::duration<float> deltaTime = currentTime - lastTime;
    
    lastTime = currentTime;
    fixedTickLag += deltaTime.count();
 
-   // Process input
-   EntityAdmin::instance().updateInputSystem();
-
-   // Update game state only if the game is behind the real world
+   // Update game state only if the game is behind the real world. Input is sampled 
+   // by the Input phase of each fixed tick.
    while (fixedTickLag >= KorinLoop::FRAME_TIME)
    {
-      EntityAdmin::instance().updateSystems(KorinLoop::FRAME_TIME);
+      simulateFixedTick();
       fixedTickLag -= KorinLoop::FRAME_TIME;
    }
 
    // Render the game state only after the game state has caught up to the real world
-   EntityAdmin::instance().updateRenderSystem();
+   world.updateFrame(deltaTime.count());
+}
+
+void KorinLoop::runFixedTicks(std::uint32_t tickCount)
+{
+   for (std::uint32_t tick = 0; tick < tickCount; tick++)
+   {
+      simulateFixedTick();
+   }
+
+   world.updateFrame(KorinLoop::FRAME_TIME * static_cast<float>(tickCount));
+}
+
+void KorinLoop::simulateFixedTick()
+{
+   if (rollbackSession)
+   {
+      rollbackSession->advance(KorinLoop::FRAME_TIME);
+      return;
+   }
+
+   world.updateSystems(KorinLoop::FRAME_TIME);
 }
 
 void KorinLoop::tickVariable()
 {
-   EntityAdmin::instance().updateInputSystem();
-   EntityAdmin::instance().updateSystems(variableTickDeltaTime);
-   EntityAdmin::instance().updateRenderSystem();
+   world.updateSystems(variableTickDeltaTime);
+   world.updateFrame(variableTickDeltaTime);
 
    // Get the current time in seconds
-   const auto currentTime = std::chrono::high_resolution_clock::now();
+   const auto currentTime = std::chrono::steady_clock::now();
    variableTickDeltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
 
    if (variableTickDeltaTime > 1.0f)
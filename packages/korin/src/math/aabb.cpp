@@ -41,11 +41,21 @@ float AABB::size() const
    return width() * height();
 }
 
+float AABB::perimeter() const 
+{
+   return 2.0f * (width() + height());
+}
+
 bool AABB::contains(const Vector2D& point) const 
 {
    return point.x >= minX && point.x <= maxX && point.y >= minY && point.y <= maxY;
 }
 
+bool AABB::contains(const AABB& other) const 
+{
+   return minX <= other.minX && minY <= other.minY && maxX >= other.maxX && maxY >= other.maxY;
+}
+
 bool AABB::intersects(const AABB& other) const 
 {
    return minX <= other.maxX && maxX >= other.minX && minY <= other.maxY && maxY >= other.minY;
@@ -67,4 +77,17 @@ void AABB::expandToInclude(const Vector2D& point)
    minY = std::min(minY, point.y);
    maxX = std::max(maxX, point.x);
    maxY = std::max(maxY, point.y);
+}
+
+AABB AABB::expanded(float margin) const 
+{
+   return {minX - margin, minY - margin, maxX + margin, maxY + margin};
+}
+
+AABB AABB::combine(const AABB& a, const AABB& b) 
+{
+   return {
+      std::min(a.minX, b.minX), std::min(a.minY, b.minY), 
+      std::max(a.maxX, b.maxX), std::max(a.maxY, b.maxY)
+   };
 }
\ No newline at end of file
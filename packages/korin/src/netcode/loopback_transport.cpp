@@ -0,0 +1,62 @@
+// loopback_transport.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/netcode/loopback_transport.h"
+
+using namespace korin;
+
+LoopbackTransport::LoopbackTransport(std::shared_ptr<Channel> incoming, std::shared_ptr<Channel> outgoing, std::uint32_t latencySteps)
+   : m_Incoming(std::move(incoming)), m_Outgoing(std::move(outgoing)), m_LatencySteps(latencySteps)
+   , m_DropEvery(0), m_PacketsSent(0), m_BytesSent(0)
+{
+}
+
+std::pair<std::unique_ptr<LoopbackTransport>, std::unique_ptr<LoopbackTransport>> LoopbackTransport::createPair(std::uint32_t latencySteps)
+{
+   auto aToB = std::make_shared<Channel>();
+   auto bToA = std::make_shared<Channel>();
+   return {
+      std::unique_ptr<LoopbackTransport>(new LoopbackTransport(bToA, aToB, latencySteps)),
+      std::unique_ptr<LoopbackTransport>(new LoopbackTransport(aToB, bToA, latencySteps))
+   };
+}
+
+void LoopbackTransport::send(const std::vector<std::uint8_t>& packet)
+{
+   m_PacketsSent++;
+   m_BytesSent += packet.size();
+   if (m_DropEvery > 0 && m_PacketsSent % m_DropEvery == 0)
+   {
+      return;
+   }
+
+   m_Outgoing->push_back({m_LatencySteps, packet});
+}
+
+bool LoopbackTransport::receive(std::vector<std::uint8_t>& packet)
+{
+   // Packets sent with a lower latency may overtake earlier ones, like on a real network
+   for (auto packetIt = m_Incoming->begin(); packetIt != m_Incoming->end(); ++packetIt)
+   {
+      if (packetIt->stepsLeft == 0)
+      {
+         packet = std::move(packetIt->data);
+         m_Incoming->erase(packetIt);
+         return true;
+      }
+   }
+   return false;
+}
+
+void LoopbackTransport::step()
+{
+   for (Packet& packet : *m_Incoming)
+   {
+      if (packet.stepsLeft > 0)
+      {
+         packet.stepsLeft--;
+      }
+   }
+}
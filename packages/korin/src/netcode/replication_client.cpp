@@ -0,0 +1,384 @@
+// replication_client.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cstring>
+
+#include "korin/netcode/replication_client.h"
+#include "korin/netcode/replication_server.h"
+#include "korin/netcode/transport.h"
+#include "korin/serialization/component_registry.h"
+#include "korin/entity_admin.h"
+#include "korin/util/bit_stream.h"
+#include "korin/util/bit_util.h"
+#include "korin/util/byte_stream.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+constexpr std::uint32_t NO_TICK = UINT32_MAX;
+constexpr std::uint32_t NO_INDEX = UINT32_MAX;
+
+bool readRawField(BitReader& reader, std::uint8_t* field, std::size_t size)
+{
+   for (std::size_t offset = 0; offset < size; offset += 8)
+   {
+      const std::size_t chunk = std::min<std::size_t>(size - offset, 8);
+      std::uint64_t bits = 0;
+      if (!reader.readBits(bits, static_cast<std::uint32_t>(chunk * 8)))
+      {
+         return false;
+      }
+      std::memcpy(field + offset, &bits, chunk);
+   }
+   return true;
+}
+
+void removeReplicatedEntity(EntityAdmin& admin, EntityID entityID)
+{
+   const auto entityIt = admin.entities().find(entityID);
+   if (entityIt != admin.entities().end())
+   {
+      admin.removeEntity(entityIt->second);
+   }
+}
+} // namespace
+
+ReplicationClient::ReplicationClient(const ReplicationSchema& schema, std::uint32_t historyTicks)
+   : m_Schema(schema), m_SchemaHash(schema.hash()), m_Transport(nullptr)
+   , m_History(std::vector<ReplicatedState>(std::max(historyTicks, 1u))), m_LatestTick(NO_TICK), m_DroppedPackets(0)
+   , m_ResourceHandles(std::unordered_map<EntityID, StringID>())
+   , m_AppliedIDs(std::vector<EntityID>()), m_AppliedMasks(std::vector<std::uint32_t>())
+   , m_Packet(std::vector<std::uint8_t>()), m_Decoded(), m_Removed(std::vector<EntityID>())
+   , m_BaselineCursor(0), m_RemovedCursor(0), m_ZeroRow(std::vector<std::uint8_t>())
+{
+   for (ReplicatedState& state : m_History)
+   {
+      state.tick = NO_TICK;
+   }
+
+   for (const ReplicatedType& type : m_Schema.types())
+   {
+      m_ZeroRow.resize(std::max<std::size_t>(m_ZeroRow.size(), type.rowSize), 0);
+   }
+}
+
+bool ReplicationClient::receive()
+{
+   if (!m_Transport)
+   {
+      return false;
+   }
+
+   bool received = false;
+   while (m_Transport->receive(m_Packet))
+   {
+      if (!readDelta())
+      {
+         m_DroppedPackets++;
+         continue;
+      }
+
+      const std::uint32_t tick = m_Decoded.tick;
+      std::swap(m_History[tick % m_History.size()], m_Decoded);
+      m_LatestTick = tick;
+      received = true;
+
+      m_Packet.clear();
+      ByteWriter writer(m_Packet);
+      writer.writeU8(REPLICATION_ACK_MESSAGE);
+      writer.writeVarint(tick);
+      m_Transport->send(m_Packet);
+   }
+   return received;
+}
+
+void ReplicationClient::apply(EntityAdmin& admin)
+{
+   const ReplicatedState* state = latestState();
+   if (!state)
+   {
+      return;
+   }
+
+   const std::vector<ReplicatedType>& types = m_Schema.types();
+   const std::vector<ComponentType>& registered = ComponentRegistry::instance().types();
+
+   std::size_t applied = 0;
+   for (std::size_t index = 0; index < state->entityCount(); index++)
+   {
+      const EntityID entityID = state->entityIDs[index];
+      while (applied < m_AppliedIDs.size() && m_AppliedIDs[applied] < entityID)
+      {
+         removeReplicatedEntity(admin, m_AppliedIDs[applied]);
+         m_ResourceHandles.erase(m_AppliedIDs[applied++]);
+      }
+
+      std::uint32_t appliedMask = 0;
+      if (applied < m_AppliedIDs.size() && m_AppliedIDs[applied] == entityID)
+      {
+         appliedMask = m_AppliedMasks[applied++];
+      }
+
+      if (admin.entities().find(entityID) == admin.entities().end()
+         && !admin.restoreEntity(entityID, m_ResourceHandles[entityID]))
+      {
+         continue;
+      }
+
+      // Components the server removed since the last apply
+      const std::uint32_t mask = state->typeMasks[index];
+      for (std::uint32_t removed = appliedMask & ~mask; removed != 0; removed &= removed - 1)
+      {
+         const ComponentTypeID typeID = types[static_cast<std::size_t>(countTrailingZeros(removed))].typeID;
+         if (admin.findComponent(entityID, typeID))
+         {
+            admin.removeComponent(entityID, typeID);
+         }
+      }
+
+      const std::uint8_t* row = state->rows.data() + state->rowOffsets[index];
+      for (std::uint32_t remaining = mask; remaining != 0; remaining &= remaining - 1)
+      {
+         const auto typeIndex = static_cast<std::size_t>(countTrailingZeros(remaining));
+         ComponentPtr component = admin.findComponent(entityID, types[typeIndex].typeID);
+         if (!component)
+         {
+            component = registered[types[typeIndex].registryIndex].create();
+            admin.addComponent(entityID, component);
+         }
+
+         m_Schema.unpackRow(typeIndex, row, *component);
+         row += types[typeIndex].rowSize;
+      }
+   }
+
+   while (applied < m_AppliedIDs.size())
+   {
+      removeReplicatedEntity(admin, m_AppliedIDs[applied]);
+      m_ResourceHandles.erase(m_AppliedIDs[applied++]);
+   }
+
+   m_AppliedIDs = state->entityIDs;
+   m_AppliedMasks = state->typeMasks;
+}
+
+const ReplicatedState* ReplicationClient::latestState() const
+{
+   return m_LatestTick == NO_TICK ? nullptr : stateAt(m_LatestTick);
+}
+
+const ReplicatedState* ReplicationClient::stateAt(std::uint32_t tick) const
+{
+   const ReplicatedState& state = m_History[tick % m_History.size()];
+   return state.tick == tick ? &state : nullptr;
+}
+
+bool ReplicationClient::readDelta()
+{
+   if (m_Packet.empty() || m_Packet[0] != REPLICATION_STATE_MESSAGE)
+   {
+      KORIN_CORE_WARN("Dropped a malformed replication packet.");
+      return false;
+   }
+
+   BitReader reader(m_Packet.data() + 1, m_Packet.size() - 1);
+   std::uint64_t schemaHash = 0, tick = 0, baselineTick = NO_TICK, removedCount = 0, changedCount = 0;
+   bool hasBaseline = false;
+   if (!reader.readBits(schemaHash, 32) || !reader.readBits(tick, 32) || !reader.readBool(hasBaseline)
+      || (hasBaseline && !reader.readBits(baselineTick, 32))
+      || !reader.readBits(removedCount, 16) || !reader.readBits(changedCount, 16))
+   {
+      KORIN_CORE_WARN("Dropped a malformed replication packet.");
+      return false;
+   }
+
+   if (schemaHash != m_SchemaHash)
+   {
+      KORIN_CORE_WARN("Dropped a replication packet written with a different schema.");
+      return false;
+   }
+
+   // Late packets are older than what the world already shows
+   if (m_LatestTick != NO_TICK && tick <= m_LatestTick)
+   {
+      return false;
+   }
+
+   const ReplicatedState* baseline = hasBaseline ? stateAt(static_cast<std::uint32_t>(baselineTick)) : nullptr;
+   if (hasBaseline && !baseline)
+   {
+      KORIN_CORE_WARN("Dropped a replication packet against tick " + std::to_string(baselineTick) + " which is no longer kept.");
+      return false;
+   }
+
+   m_Removed.clear();
+   EntityID previousID = 0;
+   for (std::uint64_t i = 0; i < removedCount; i++)
+   {
+      std::uint64_t delta = 0;
+      if (!reader.readVarBits(delta))
+      {
+         return false;
+      }
+      previousID += static_cast<EntityID>(delta);
+      m_Removed.push_back(previousID);
+   }
+
+   m_Decoded.clear();
+   m_Decoded.tick = static_cast<std::uint32_t>(tick);
+   m_BaselineCursor = 0;
+   m_RemovedCursor = 0;
+
+   previousID = 0;
+   for (std::uint64_t i = 0; i < changedCount; i++)
+   {
+      std::uint64_t delta = 0;
+      if (!reader.readVarBits(delta) || (i > 0 && delta == 0))
+      {
+         KORIN_CORE_WARN("Dropped a malformed replication packet.");
+         return false;
+      }
+      const EntityID entityID = previousID + static_cast<EntityID>(delta);
+      previousID = entityID;
+
+      std::uint32_t baselineIndex = NO_INDEX;
+      if (baseline)
+      {
+         copyBaseline(*baseline, entityID);
+         if (m_BaselineCursor < baseline->entityCount() && baseline->entityIDs[m_BaselineCursor] == entityID)
+         {
+            baselineIndex = static_cast<std::uint32_t>(m_BaselineCursor++);
+         }
+      }
+
+      if (!readEntity(reader, baseline, baselineIndex, entityID))
+      {
+         KORIN_CORE_WARN("Dropped a malformed replication packet.");
+         return false;
+      }
+   }
+
+   if (baseline)
+   {
+      copyBaseline(*baseline, INVALID_ENTITY_ID);
+   }
+   m_Decoded.rowOffsets.push_back(static_cast<std::uint32_t>(m_Decoded.rows.size()));
+   return true;
+}
+
+bool ReplicationClient::readEntity(BitReader& reader, const ReplicatedState* baseline, std::uint32_t baselineIndex, EntityID entityID)
+{
+   const std::vector<ReplicatedType>& types = m_Schema.types();
+
+   bool isNew = false;
+   if (!reader.readBool(isNew))
+   {
+      return false;
+   }
+
+   bool maskChanged = isNew;
+   if (isNew)
+   {
+      std::uint64_t handle = 0;
+      if (!reader.readBits(handle, 32))
+      {
+         return false;
+      }
+      m_ResourceHandles[entityID] = StringID::fromValue(static_cast<std::uint32_t>(handle));
+
+      // An ID that was reused for a new entity starts over from nothing
+      baselineIndex = NO_INDEX;
+   }
+   else if (!reader.readBool(maskChanged))
+   {
+      return false;
+   }
+
+   const std::uint32_t baselineMask = baselineIndex == NO_INDEX ? 0 : baseline->typeMasks[baselineIndex];
+   std::uint32_t mask = baselineMask;
+   if (maskChanged)
+   {
+      std::uint64_t bits = 0;
+      if (!reader.readBits(bits, static_cast<std::uint32_t>(types.size())))
+      {
+         return false;
+      }
+      mask = static_cast<std::uint32_t>(bits);
+   }
+
+   m_Decoded.entityIDs.push_back(entityID);
+   m_Decoded.typeMasks.push_back(mask);
+   m_Decoded.rowOffsets.push_back(static_cast<std::uint32_t>(m_Decoded.rows.size()));
+
+   for (std::uint32_t remaining = mask; remaining != 0; remaining &= remaining - 1)
+   {
+      const auto typeIndex = static_cast<std::size_t>(countTrailingZeros(remaining));
+      const ReplicatedType& type = types[typeIndex];
+      const std::uint8_t* baselineRow = (baselineMask & (1u << typeIndex)) != 0
+         ? baseline->rows.data() + m_Schema.rowOffset(*baseline, baselineIndex, typeIndex)
+         : m_ZeroRow.data();
+
+      const std::size_t rowOffset = m_Decoded.rows.size();
+      m_Decoded.rows.insert(m_Decoded.rows.end(), baselineRow, baselineRow + type.rowSize);
+      std::uint8_t* row = m_Decoded.rows.data() + rowOffset;
+
+      for (const ReplicatedField& field : type.fields)
+      {
+         bool fieldChanged = false;
+         if (!reader.readBool(fieldChanged))
+         {
+            return false;
+         }
+         if (!fieldChanged)
+         {
+            continue;
+         }
+
+         if (field.quantized)
+         {
+            std::int64_t delta = 0;
+            if (!reader.readSignedVarBits(delta))
+            {
+               return false;
+            }
+            std::int32_t quantized = 0;
+            std::memcpy(&quantized, row + field.offset, sizeof(quantized));
+            quantized = static_cast<std::int32_t>(quantized + delta);
+            std::memcpy(row + field.offset, &quantized, sizeof(quantized));
+         }
+         else if (!readRawField(reader, row + field.offset, field.size))
+         {
+            return false;
+         }
+      }
+   }
+   return true;
+}
+
+void ReplicationClient::copyBaseline(const ReplicatedState& baseline, EntityID beforeID)
+{
+   while (m_BaselineCursor < baseline.entityCount() && baseline.entityIDs[m_BaselineCursor] < beforeID)
+   {
+      const std::size_t index = m_BaselineCursor++;
+      const EntityID entityID = baseline.entityIDs[index];
+      while (m_RemovedCursor < m_Removed.size() && m_Removed[m_RemovedCursor] < entityID)
+      {
+         m_RemovedCursor++;
+      }
+      if (m_RemovedCursor < m_Removed.size() && m_Removed[m_RemovedCursor] == entityID)
+      {
+         continue;
+      }
+
+      m_Decoded.entityIDs.push_back(entityID);
+      m_Decoded.typeMasks.push_back(baseline.typeMasks[index]);
+      m_Decoded.rowOffsets.push_back(static_cast<std::uint32_t>(m_Decoded.rows.size()));
+      m_Decoded.rows.insert(m_Decoded.rows.end(),
+         baseline.rows.begin() + baseline.rowOffsets[index], baseline.rows.begin() + baseline.rowOffsets[index + 1]);
+   }
+}
@@ -0,0 +1,234 @@
+// replication_schema.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "korin/netcode/replication_schema.h"
+#include "korin/serialization/component_registry.h"
+#include "korin/entity_admin.h"
+#include "korin/components/transform_component.h"
+#include "korin/components/physics_component.h"
+#include "korin/components/bounds_component.h"
+#include "korin/components/collider_component.h"
+#include "korin/util/bit_util.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+constexpr std::uint32_t TRANSFORM_FIELD_COUNT = 5;
+constexpr float ROTATION_STEPS = 65536.0f;
+
+std::int32_t quantize(float value, float step)
+{
+   const double steps = std::round(static_cast<double>(value) / static_cast<double>(step));
+   return static_cast<std::int32_t>(std::max<double>(std::min<double>(steps, INT32_MAX), INT32_MIN));
+}
+
+// Rotations wrap, so only the angle within one turn is kept
+std::int32_t quantizeRotation(float degrees)
+{
+   const double turns = static_cast<double>(degrees) / 360.0;
+   const double fraction = turns - std::floor(turns);
+   return static_cast<std::int32_t>(std::lround(fraction * ROTATION_STEPS)) & 0xFFFF;
+}
+
+void hashBytes(std::uint32_t& hash, const void* data, std::size_t size)
+{
+   const auto* bytes = static_cast<const std::uint8_t*>(data);
+   for (std::size_t i = 0; i < size; i++)
+   {
+      hash ^= bytes[i];
+      hash *= 16777619u;
+   }
+}
+} // namespace
+
+ReplicationSchema::ReplicationSchema()
+   : positionStep(1.0f / 256.0f), scaleStep(1.0f / 1024.0f)
+   , m_Types(std::vector<ReplicatedType>()), m_IndexByTypeID(std::vector<std::int32_t>())
+{
+   addType(Component::typeID<TransformComponent>());
+   addType(Component::typeID<PhysicsComponent>());
+   addType(Component::typeID<BoundsComponent>());
+   addType(Component::typeID<ColliderComponent>());
+}
+
+bool ReplicationSchema::addType(ComponentTypeID typeID)
+{
+   const ComponentRegistry& registry = ComponentRegistry::instance();
+   const ComponentType* registered = registry.find(typeID);
+   if (!registered)
+   {
+      KORIN_CORE_WARN("ComponentType(" + std::to_string(typeID) + ") isn't registered and can't be replicated.");
+      return false;
+   }
+
+   if (typeID < m_IndexByTypeID.size() && m_IndexByTypeID[typeID] >= 0)
+   {
+      return true;
+   }
+
+   if (m_Types.size() >= MAX_TYPES)
+   {
+      KORIN_CORE_WARN("Cannot replicate " + registered->name + ". The schema is full.");
+      return false;
+   }
+
+   ReplicatedType type;
+   type.typeID = typeID;
+   type.registryIndex = static_cast<std::uint32_t>(registered - registry.types().data());
+   type.quantizedTransform = typeID == Component::typeID<TransformComponent>();
+   type.rowSize = 0;
+
+   if (type.quantizedTransform)
+   {
+      for (std::uint32_t i = 0; i < TRANSFORM_FIELD_COUNT; i++)
+      {
+         type.fields.push_back({static_cast<std::uint16_t>(i * sizeof(std::int32_t)), sizeof(std::int32_t), true});
+      }
+      type.rowSize = TRANSFORM_FIELD_COUNT * sizeof(std::int32_t);
+   }
+   else
+   {
+      for (const std::uint16_t fieldSize : registered->fieldSizes)
+      {
+         type.fields.push_back({static_cast<std::uint16_t>(type.rowSize), fieldSize, false});
+         type.rowSize += fieldSize;
+      }
+   }
+
+   if (typeID >= m_IndexByTypeID.size())
+   {
+      m_IndexByTypeID.resize(typeID + 1, -1);
+   }
+   m_IndexByTypeID[typeID] = static_cast<std::int32_t>(m_Types.size());
+   m_Types.push_back(std::move(type));
+   return true;
+}
+
+std::uint32_t ReplicationSchema::hash() const
+{
+   const std::vector<ComponentType>& registered = ComponentRegistry::instance().types();
+
+   std::uint32_t hash = 2166136261u;
+   hashBytes(hash, &positionStep, sizeof(positionStep));
+   hashBytes(hash, &scaleStep, sizeof(scaleStep));
+   for (const ReplicatedType& type : m_Types)
+   {
+      const ComponentType& component = registered[type.registryIndex];
+      hashBytes(hash, &component.stableID, sizeof(component.stableID));
+      hashBytes(hash, &component.schemaVersion, sizeof(component.schemaVersion));
+      hashBytes(hash, &type.quantizedTransform, sizeof(type.quantizedTransform));
+   }
+   return hash;
+}
+
+void ReplicationSchema::capture(const EntityAdmin& admin, std::uint32_t tick, ReplicatedState& state) const
+{
+   state.clear();
+   state.tick = tick;
+
+   for (const auto& entity : admin.entities())
+   {
+      state.entityIDs.push_back(entity.first);
+   }
+   std::sort(state.entityIDs.begin(), state.entityIDs.end());
+
+   // Entities without replicated components are dropped as the list is walked
+   std::size_t kept = 0;
+   Component* byType[MAX_TYPES] = {};
+   for (std::size_t i = 0; i < state.entityIDs.size(); i++)
+   {
+      const EntityID entityID = state.entityIDs[i];
+
+      std::uint32_t mask = 0;
+      for (const ComponentPtr& component : admin.components(entityID))
+      {
+         const ComponentTypeID typeID = component->typeID();
+         if (typeID < m_IndexByTypeID.size() && m_IndexByTypeID[typeID] >= 0)
+         {
+            mask |= 1u << m_IndexByTypeID[typeID];
+            byType[m_IndexByTypeID[typeID]] = component.get();
+         }
+      }
+
+      if (mask == 0)
+      {
+         continue;
+      }
+
+      state.entityIDs[kept++] = entityID;
+      state.typeMasks.push_back(mask);
+      state.rowOffsets.push_back(static_cast<std::uint32_t>(state.rows.size()));
+
+      for (std::uint32_t remaining = mask; remaining != 0; remaining &= remaining - 1)
+      {
+         const auto typeIndex = static_cast<std::size_t>(countTrailingZeros(remaining));
+         const std::size_t rowOffset = state.rows.size();
+         state.rows.resize(rowOffset + m_Types[typeIndex].rowSize);
+         packRow(typeIndex, *byType[typeIndex], state.rows.data() + rowOffset);
+      }
+   }
+
+   state.entityIDs.resize(kept);
+   state.rowOffsets.push_back(static_cast<std::uint32_t>(state.rows.size()));
+}
+
+void ReplicationSchema::packRow(std::size_t typeIndex, Component& component, std::uint8_t* row) const
+{
+   const ReplicatedType& type = m_Types[typeIndex];
+   if (type.quantizedTransform)
+   {
+      const auto& transform = static_cast<const TransformComponent&>(component);
+      const std::int32_t values[TRANSFORM_FIELD_COUNT] = {
+         quantize(transform.x, positionStep),
+         quantize(transform.y, positionStep),
+         quantizeRotation(transform.rotation),
+         quantize(transform.scaleX, scaleStep),
+         quantize(transform.scaleY, scaleStep)
+      };
+      std::memcpy(row, values, sizeof(values));
+      return;
+   }
+
+   Component* components[1] = {&component};
+   ComponentRegistry::instance().types()[type.registryIndex].pack(components, 1, row);
+}
+
+void ReplicationSchema::unpackRow(std::size_t typeIndex, const std::uint8_t* row, Component& component) const
+{
+   const ReplicatedType& type = m_Types[typeIndex];
+   if (type.quantizedTransform)
+   {
+      std::int32_t values[TRANSFORM_FIELD_COUNT];
+      std::memcpy(values, row, sizeof(values));
+
+      auto& transform = static_cast<TransformComponent&>(component);
+      transform.x = static_cast<float>(values[0]) * positionStep;
+      transform.y = static_cast<float>(values[1]) * positionStep;
+      transform.rotation = static_cast<float>(values[2]) * (360.0f / ROTATION_STEPS);
+      transform.scaleX = static_cast<float>(values[3]) * scaleStep;
+      transform.scaleY = static_cast<float>(values[4]) * scaleStep;
+      return;
+   }
+
+   Component* components[1] = {&component};
+   ComponentRegistry::instance().types()[type.registryIndex].unpack(components, 1, row);
+}
+
+std::uint32_t ReplicationSchema::rowOffset(const ReplicatedState& state, std::size_t entityIndex, std::size_t typeIndex) const
+{
+   std::uint32_t offset = state.rowOffsets[entityIndex];
+   const std::uint32_t typesBefore = state.typeMasks[entityIndex] & ((1u << typeIndex) - 1);
+   for (std::uint32_t remaining = typesBefore; remaining != 0; remaining &= remaining - 1)
+   {
+      offset += m_Types[static_cast<std::size_t>(countTrailingZeros(remaining))].rowSize;
+   }
+   return offset;
+}
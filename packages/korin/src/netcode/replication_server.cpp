@@ -0,0 +1,269 @@
+// replication_server.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cstring>
+
+#include "korin/netcode/replication_server.h"
+#include "korin/netcode/transport.h"
+#include "korin/entity_admin.h"
+#include "korin/util/bit_stream.h"
+#include "korin/util/bit_util.h"
+#include "korin/util/byte_stream.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+constexpr std::uint32_t NO_TICK = UINT32_MAX;
+constexpr std::uint32_t NO_INDEX = UINT32_MAX;
+
+void writeRawField(BitWriter& writer, const std::uint8_t* field, std::size_t size)
+{
+   for (std::size_t offset = 0; offset < size; offset += 8)
+   {
+      const std::size_t chunk = std::min<std::size_t>(size - offset, 8);
+      std::uint64_t bits = 0;
+      std::memcpy(&bits, field + offset, chunk);
+      writer.writeBits(bits, static_cast<std::uint32_t>(chunk * 8));
+   }
+}
+} // namespace
+
+ReplicationServer::ReplicationServer(const EntityAdmin& admin, const ReplicationSchema& schema, std::uint32_t historyTicks)
+   : m_Admin(admin), m_Schema(schema), m_SchemaHash(schema.hash()), m_CurrentTick(0)
+   , m_History(std::vector<ReplicatedState>(std::max(historyTicks, 1u))), m_Clients(std::vector<Client>())
+   , m_Stats(), m_Packet(std::vector<std::uint8_t>()), m_Removed(std::vector<EntityID>())
+   , m_Changed(std::vector<ChangedEntity>()), m_ZeroRow(std::vector<std::uint8_t>())
+{
+   for (ReplicatedState& state : m_History)
+   {
+      state.tick = NO_TICK;
+   }
+
+   for (const ReplicatedType& type : m_Schema.types())
+   {
+      m_ZeroRow.resize(std::max<std::size_t>(m_ZeroRow.size(), type.rowSize), 0);
+   }
+}
+
+std::uint32_t ReplicationServer::addClient(Transport* transport)
+{
+   KORIN_ASSERT(transport);
+   m_Clients.push_back({transport, NO_TICK});
+   return static_cast<std::uint32_t>(m_Clients.size() - 1);
+}
+
+void ReplicationServer::removeClient(std::uint32_t client)
+{
+   if (client >= m_Clients.size())
+   {
+      KORIN_CORE_WARN("Replication client " + std::to_string(client) + " does not exist for removal.");
+      return;
+   }
+
+   // Indices of the other clients stay the same
+   m_Clients[client] = {nullptr, NO_TICK};
+}
+
+std::uint32_t ReplicationServer::acknowledgedTick(std::uint32_t client) const
+{
+   return client < m_Clients.size() ? m_Clients[client].acknowledgedTick : NO_TICK;
+}
+
+void ReplicationServer::update()
+{
+   ReplicatedState& current = m_History[m_CurrentTick % m_History.size()];
+   m_Schema.capture(m_Admin, m_CurrentTick, current);
+   m_CurrentTick++;
+
+   m_Stats.lastChangedEntities = 0;
+   m_Stats.lastBytesSent = 0;
+
+   for (Client& client : m_Clients)
+   {
+      if (!client.transport)
+      {
+         continue;
+      }
+
+      receiveAcknowledgements(client);
+
+      const ReplicatedState* baseline = client.acknowledgedTick == NO_TICK ? nullptr : stateAt(client.acknowledgedTick);
+      if (!baseline)
+      {
+         m_Stats.fullUpdates++;
+      }
+
+      writeDelta(baseline, current);
+      client.transport->send(m_Packet);
+
+      m_Stats.packetsSent++;
+      m_Stats.bytesSent += m_Packet.size();
+      m_Stats.lastBytesSent += static_cast<std::uint32_t>(m_Packet.size());
+   }
+}
+
+const ReplicatedState* ReplicationServer::stateAt(std::uint32_t tick) const
+{
+   const ReplicatedState& state = m_History[tick % m_History.size()];
+   return state.tick == tick ? &state : nullptr;
+}
+
+void ReplicationServer::receiveAcknowledgements(Client& client)
+{
+   while (client.transport->receive(m_Packet))
+   {
+      ByteReader reader(m_Packet);
+      std::uint8_t type = 0;
+      std::uint32_t tick = 0;
+      if (!reader.readU8(type) || type != REPLICATION_ACK_MESSAGE || !reader.readVarint(tick) || tick >= m_CurrentTick)
+      {
+         KORIN_CORE_WARN("Dropped a malformed replication acknowledgement.");
+         continue;
+      }
+
+      // Acknowledgements can arrive out of order, and only the newest one matters
+      if (client.acknowledgedTick == NO_TICK || tick > client.acknowledgedTick)
+      {
+         client.acknowledgedTick = tick;
+      }
+   }
+}
+
+void ReplicationServer::writeDelta(const ReplicatedState* baseline, const ReplicatedState& current)
+{
+   m_Removed.clear();
+   m_Changed.clear();
+
+   // Both entity lists are sorted, so one merge finds what was removed, added and changed
+   const std::size_t baselineCount = baseline ? baseline->entityCount() : 0;
+   std::size_t baselineIndex = 0;
+   for (std::size_t index = 0; index < current.entityCount(); index++)
+   {
+      const EntityID entityID = current.entityIDs[index];
+      while (baselineIndex < baselineCount && baseline->entityIDs[baselineIndex] < entityID)
+      {
+         m_Removed.push_back(baseline->entityIDs[baselineIndex++]);
+      }
+
+      if (baselineIndex < baselineCount && baseline->entityIDs[baselineIndex] == entityID)
+      {
+         const std::uint32_t rowsStart = current.rowOffsets[index];
+         const std::uint32_t rowsSize = current.rowOffsets[index + 1] - rowsStart;
+         const bool unchanged = current.typeMasks[index] == baseline->typeMasks[baselineIndex]
+            && std::memcmp(current.rows.data() + rowsStart, baseline->rows.data() + baseline->rowOffsets[baselineIndex], rowsSize) == 0;
+         if (!unchanged)
+         {
+            m_Changed.push_back({static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(baselineIndex)});
+         }
+         baselineIndex++;
+      }
+      else
+      {
+         m_Changed.push_back({static_cast<std::uint32_t>(index), NO_INDEX});
+      }
+   }
+   while (baselineIndex < baselineCount)
+   {
+      m_Removed.push_back(baseline->entityIDs[baselineIndex++]);
+   }
+
+   m_Packet.clear();
+   m_Packet.push_back(REPLICATION_STATE_MESSAGE);
+   BitWriter writer(m_Packet);
+   writer.writeBits(m_SchemaHash, 32);
+   writer.writeBits(current.tick, 32);
+   writer.writeBool(baseline != nullptr);
+   if (baseline)
+   {
+      writer.writeBits(baseline->tick, 32);
+   }
+
+   KORIN_ASSERT(m_Removed.size() <= UINT16_MAX && m_Changed.size() <= UINT16_MAX);
+   writer.writeBits(m_Removed.size(), 16);
+   writer.writeBits(m_Changed.size(), 16);
+
+   EntityID previousID = 0;
+   for (const EntityID entityID : m_Removed)
+   {
+      writer.writeVarBits(entityID - previousID);
+      previousID = entityID;
+   }
+
+   previousID = 0;
+   for (const ChangedEntity& changed : m_Changed)
+   {
+      const EntityID entityID = current.entityIDs[changed.index];
+      writer.writeVarBits(entityID - previousID);
+      previousID = entityID;
+      writeEntity(writer, baseline, current, changed);
+   }
+
+   writer.flush();
+   m_Stats.lastChangedEntities += static_cast<std::uint32_t>(m_Changed.size());
+}
+
+void ReplicationServer::writeEntity(BitWriter& writer, const ReplicatedState* baseline, const ReplicatedState& current,
+   const ChangedEntity& changed)
+{
+   const std::vector<ReplicatedType>& types = m_Schema.types();
+   const bool isNew = changed.baselineIndex == NO_INDEX;
+   const std::uint32_t mask = current.typeMasks[changed.index];
+   const std::uint32_t baselineMask = isNew ? 0 : baseline->typeMasks[changed.baselineIndex];
+
+   writer.writeBool(isNew);
+   if (isNew)
+   {
+      const auto entityIt = m_Admin.entities().find(current.entityIDs[changed.index]);
+      const StringID handle = entityIt == m_Admin.entities().end() ? StringID() : entityIt->second->getResourceHandle();
+      writer.writeBits(handle.value(), 32);
+   }
+   else
+   {
+      writer.writeBool(mask != baselineMask);
+   }
+
+   if (isNew || mask != baselineMask)
+   {
+      writer.writeBits(mask, static_cast<std::uint32_t>(types.size()));
+   }
+
+   const std::uint8_t* row = current.rows.data() + current.rowOffsets[changed.index];
+   for (std::uint32_t remaining = mask; remaining != 0; remaining &= remaining - 1)
+   {
+      const auto typeIndex = static_cast<std::size_t>(countTrailingZeros(remaining));
+      const std::uint8_t* baselineRow = (baselineMask & (1u << typeIndex)) != 0
+         ? baseline->rows.data() + m_Schema.rowOffset(*baseline, changed.baselineIndex, typeIndex)
+         : m_ZeroRow.data();
+
+      for (const ReplicatedField& field : types[typeIndex].fields)
+      {
+         const std::uint8_t* value = row + field.offset;
+         const std::uint8_t* baselineValue = baselineRow + field.offset;
+         const bool fieldChanged = std::memcmp(value, baselineValue, field.size) != 0;
+         writer.writeBool(fieldChanged);
+         if (!fieldChanged)
+         {
+            continue;
+         }
+
+         if (field.quantized)
+         {
+            std::int32_t quantized = 0, baselineQuantized = 0;
+            std::memcpy(&quantized, value, sizeof(quantized));
+            std::memcpy(&baselineQuantized, baselineValue, sizeof(baselineQuantized));
+            writer.writeSignedVarBits(static_cast<std::int64_t>(quantized) - baselineQuantized);
+         }
+         else
+         {
+            writeRawField(writer, value, field.size);
+         }
+      }
+      row += types[typeIndex].rowSize;
+   }
+}
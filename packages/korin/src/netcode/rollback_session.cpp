@@ -0,0 +1,323 @@
+// rollback_session.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <chrono>
+
+#include "korin/netcode/rollback_session.h"
+#include "korin/netcode/transport.h"
+#include "korin/entity_admin.h"
+#include "korin/components/input_stream_component.h"
+#include "korin/util/byte_stream.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+constexpr std::uint32_t NO_ROLLBACK = UINT32_MAX;
+} // namespace
+
+RollbackSession::RollbackSession(EntityAdmin& admin, std::uint32_t maxRollbackTicks)
+   : inputRedundancy(4), m_Admin(admin), m_Transport(nullptr)
+   , m_MaxRollbackTicks(std::max(maxRollbackTicks, 1u)), m_CurrentTick(0), m_RollbackTick(NO_ROLLBACK)
+   , m_Players(std::vector<Player>()), m_Frames(std::vector<Frame>()), m_Stats()
+   , m_Packet(std::vector<std::uint8_t>())
+{
+   m_Frames.resize(m_MaxRollbackTicks);
+   for (Frame& frame : m_Frames)
+   {
+      frame.tick = NO_ROLLBACK;
+   }
+}
+
+bool RollbackSession::addPlayer(std::uint8_t player, EntityID entityID, bool local)
+{
+   if (findPlayer(player))
+   {
+      KORIN_CORE_WARN("Rollback player " + std::to_string(player) + " was already added.");
+      return false;
+   }
+
+   auto inputStream = std::static_pointer_cast<InputStreamComponent>(
+      m_Admin.findComponent(entityID, Component::typeID<InputStreamComponent>()));
+   if (!inputStream)
+   {
+      KORIN_CORE_WARN("EntityID(" + std::to_string(entityID) + ") has no InputStreamComponent for a rollback player.");
+      return false;
+   }
+   inputStream->source = InputSource::External;
+
+   // Inputs are kept for every tick that can be rolled back to and as far ahead as a remote peer can get
+   Player added = {player, entityID, local, std::vector<InputSlot>(m_MaxRollbackTicks * 2 + 1), m_CurrentTick, 0};
+   for (std::size_t i = 0; i < added.inputs.size(); i++)
+   {
+      added.inputs[i].tick = NO_ROLLBACK;
+   }
+   m_Players.push_back(std::move(added));
+   return true;
+}
+
+void RollbackSession::setLocalInput(std::uint8_t player, ActionMask actions)
+{
+   Player* localPlayer = findPlayer(player);
+   if (!localPlayer || !localPlayer->local)
+   {
+      KORIN_CORE_WARN("Rollback player " + std::to_string(player) + " isn't a local player.");
+      return;
+   }
+
+   storeInput(*localPlayer, m_CurrentTick, actions);
+}
+
+bool RollbackSession::addRemoteInput(std::uint8_t player, std::uint32_t tick, ActionMask actions)
+{
+   Player* remotePlayer = findPlayer(player);
+   if (!remotePlayer || remotePlayer->local)
+   {
+      return false;
+   }
+
+   // Repeats of input that already arrived
+   if (tick < remotePlayer->knownThrough)
+   {
+      return true;
+   }
+
+   if (tick + m_MaxRollbackTicks < m_CurrentTick || tick >= m_CurrentTick + m_MaxRollbackTicks)
+   {
+      m_Stats.droppedInputs++;
+      return false;
+   }
+
+   if (storeInput(*remotePlayer, tick, actions))
+   {
+      m_RollbackTick = std::min(m_RollbackTick, tick);
+   }
+   return true;
+}
+
+void RollbackSession::advance(float timeStep)
+{
+   receivePackets();
+
+   if (m_RollbackTick != NO_ROLLBACK)
+   {
+      rollback(timeStep);
+   }
+
+   simulateTick(timeStep);
+   sendLocalInputs();
+}
+
+std::uint32_t RollbackSession::confirmedTick() const
+{
+   std::uint32_t confirmed = m_CurrentTick;
+   for (const Player& player : m_Players)
+   {
+      confirmed = std::min(confirmed, player.knownThrough);
+   }
+   return confirmed;
+}
+
+void RollbackSession::writeInputMessage(std::vector<std::uint8_t>& packet, std::uint8_t player,
+   std::uint32_t firstTick, const ActionMask* inputs, std::uint8_t count)
+{
+   ByteWriter writer(packet);
+   writer.writeU8(ROLLBACK_INPUT_MESSAGE);
+   writer.writeU8(player);
+   writer.writeVarint(firstTick);
+   writer.writeU8(count);
+   for (std::uint8_t i = 0; i < count; i++)
+   {
+      writer.writeVarint(inputs[i]);
+   }
+}
+
+RollbackSession::Player* RollbackSession::findPlayer(std::uint8_t player)
+{
+   for (Player& existing : m_Players)
+   {
+      if (existing.index == player)
+      {
+         return &existing;
+      }
+   }
+   return nullptr;
+}
+
+RollbackSession::InputSlot& RollbackSession::slot(Player& player, std::uint32_t tick)
+{
+   InputSlot& inputSlot = player.inputs[tick % player.inputs.size()];
+   if (inputSlot.tick != tick)
+   {
+      inputSlot = {tick, 0, false, false, 0};
+   }
+   return inputSlot;
+}
+
+ActionMask RollbackSession::inputFor(Player& player, std::uint32_t tick)
+{
+   const InputSlot& inputSlot = slot(player, tick);
+   return inputSlot.known ? inputSlot.actions : player.lastKnown;
+}
+
+bool RollbackSession::storeInput(Player& player, std::uint32_t tick, ActionMask actions)
+{
+   InputSlot& inputSlot = slot(player, tick);
+   if (inputSlot.known)
+   {
+      return false;
+   }
+
+   inputSlot.known = true;
+   inputSlot.actions = actions;
+
+   // Input may arrive out of order, so the known run only grows once the gaps are filled
+   while (player.knownThrough < m_CurrentTick + m_MaxRollbackTicks)
+   {
+      const InputSlot& next = slot(player, player.knownThrough);
+      if (!next.known)
+      {
+         break;
+      }
+      player.lastKnown = next.actions;
+      player.knownThrough++;
+   }
+
+   return inputSlot.simulated && inputSlot.used != actions;
+}
+
+void RollbackSession::simulateTick(float timeStep)
+{
+   Frame& frame = m_Frames[m_CurrentTick % m_Frames.size()];
+   frame.tick = m_CurrentTick;
+   frame.snapshot.capture(m_Admin);
+   m_Admin.saveSystemStates(frame.systemStates);
+
+   for (Player& player : m_Players)
+   {
+      // Local players that gave no input this tick keep doing what they did last tick
+      const ActionMask actions = inputFor(player, m_CurrentTick);
+      if (player.local)
+      {
+         storeInput(player, m_CurrentTick, actions);
+      }
+
+      InputSlot& inputSlot = slot(player, m_CurrentTick);
+      inputSlot.simulated = true;
+      inputSlot.used = actions;
+
+      auto inputStream = std::static_pointer_cast<InputStreamComponent>(
+         m_Admin.findComponent(player.entityID, Component::typeID<InputStreamComponent>()));
+      if (inputStream)
+      {
+         inputStream->externalActionStates = actions;
+      }
+   }
+
+   m_Admin.updateSystems(timeStep);
+   m_CurrentTick++;
+}
+
+void RollbackSession::rollback(float timeStep)
+{
+   const auto start = std::chrono::steady_clock::now();
+   const std::uint32_t rollbackTick = m_RollbackTick;
+   const std::uint32_t targetTick = m_CurrentTick;
+   m_RollbackTick = NO_ROLLBACK;
+
+   const Frame& frame = m_Frames[rollbackTick % m_Frames.size()];
+   KORIN_ASSERT(frame.tick == rollbackTick);
+   if (frame.tick != rollbackTick || !frame.snapshot.restore(m_Admin))
+   {
+      KORIN_CORE_WARN("No snapshot of tick " + std::to_string(rollbackTick) + " to roll back to.");
+      return;
+   }
+   m_Admin.loadSystemStates(frame.systemStates);
+
+   m_CurrentTick = rollbackTick;
+   m_Admin.setResimulating(true);
+   while (m_CurrentTick < targetTick)
+   {
+      simulateTick(timeStep);
+   }
+   m_Admin.setResimulating(false);
+
+   const float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+   m_Stats.rollbacks++;
+   m_Stats.resimulatedTicks += targetTick - rollbackTick;
+   m_Stats.lastResimulatedTicks = targetTick - rollbackTick;
+   m_Stats.lastResimulationSeconds = seconds;
+   m_Stats.maxResimulationSeconds = std::max(m_Stats.maxResimulationSeconds, seconds);
+}
+
+void RollbackSession::receivePackets()
+{
+   if (!m_Transport)
+   {
+      return;
+   }
+
+   while (m_Transport->receive(m_Packet))
+   {
+      ByteReader reader(m_Packet);
+      while (!reader.atEnd())
+      {
+         std::uint8_t type = 0, player = 0, count = 0;
+         std::uint32_t firstTick = 0;
+         if (!reader.readU8(type) || type != ROLLBACK_INPUT_MESSAGE
+            || !reader.readU8(player) || !reader.readVarint(firstTick) || !reader.readU8(count))
+         {
+            KORIN_CORE_WARN("Dropped a malformed rollback packet.");
+            break;
+         }
+
+         for (std::uint8_t i = 0; i < count; i++)
+         {
+            ActionMask actions = 0;
+            if (!reader.readVarint(actions))
+            {
+               break;
+            }
+            addRemoteInput(player, firstTick + i, actions);
+         }
+      }
+   }
+}
+
+void RollbackSession::sendLocalInputs()
+{
+   if (!m_Transport)
+   {
+      return;
+   }
+
+   m_Packet.clear();
+   const std::uint32_t redundancy = std::min<std::uint32_t>(std::max<std::uint8_t>(inputRedundancy, 1), m_MaxRollbackTicks);
+   const std::uint32_t firstTick = m_CurrentTick > redundancy ? m_CurrentTick - redundancy : 0;
+   const auto count = static_cast<std::uint8_t>(m_CurrentTick - firstTick);
+
+   std::vector<ActionMask> inputs(count);
+   for (Player& player : m_Players)
+   {
+      if (!player.local)
+      {
+         continue;
+      }
+
+      for (std::uint8_t i = 0; i < count; i++)
+      {
+         inputs[i] = inputFor(player, firstTick + i);
+      }
+      writeInputMessage(m_Packet, player.index, firstTick, inputs.data(), count);
+   }
+
+   if (!m_Packet.empty())
+   {
+      m_Transport->send(m_Packet);
+   }
+}
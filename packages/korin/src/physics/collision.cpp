@@ -0,0 +1,183 @@
+// collision.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "korin/physics/collision.h"
+
+using namespace korin;
+
+namespace
+{
+// Shapes closer than this are treated as concentric when picking a normal
+constexpr float NORMAL_EPSILON = 1.0e-6f;
+} // namespace
+
+bool korin::collideAABBs(const AABB& a, const AABB& b, Manifold& manifold)
+{
+   const float overlapMinX = std::max(a.minX, b.minX);
+   const float overlapMaxX = std::min(a.maxX, b.maxX);
+   const float overlapMinY = std::max(a.minY, b.minY);
+   const float overlapMaxY = std::min(a.maxY, b.maxY);
+   const float overlapX = overlapMaxX - overlapMinX;
+   const float overlapY = overlapMaxY - overlapMinY;
+
+   // Touching boxes still produce a contact so resting bodies stay supported
+   if (overlapX < 0.0f || overlapY < 0.0f)
+   {
+      return false;
+   }
+
+   const Vector2D offset = b.center() - a.center();
+   manifold.pointCount = 2;
+
+   if (overlapX < overlapY)
+   {
+      manifold.normal = Vector2D(offset.x < 0.0f ? -1.0f : 1.0f, 0.0f);
+      const float x = (overlapMinX + overlapMaxX) * 0.5f;
+      manifold.points[0] = {Vector2D(x, overlapMinY), overlapX};
+      manifold.points[1] = {Vector2D(x, overlapMaxY), overlapX};
+   }
+   else
+   {
+      manifold.normal = Vector2D(0.0f, offset.y < 0.0f ? -1.0f : 1.0f);
+      const float y = (overlapMinY + overlapMaxY) * 0.5f;
+      manifold.points[0] = {Vector2D(overlapMinX, y), overlapY};
+      manifold.points[1] = {Vector2D(overlapMaxX, y), overlapY};
+   }
+
+   return true;
+}
+
+bool korin::collideCircles(const Circle& a, const Circle& b, Manifold& manifold)
+{
+   const Vector2D offset = b.center - a.center;
+   const float radii = a.radius + b.radius;
+   const float distanceSquared = Vector2D::dot(offset, offset);
+   if (distanceSquared > radii * radii)
+   {
+      return false;
+   }
+
+   const float distance = std::sqrt(distanceSquared);
+   manifold.normal = distance > NORMAL_EPSILON ? offset / distance : Vector2D(0.0f, 1.0f);
+
+   const float penetration = radii - distance;
+   manifold.pointCount = 1;
+   manifold.points[0] = {a.center + manifold.normal * (a.radius - penetration * 0.5f), penetration};
+   return true;
+}
+
+bool korin::collideCircleAABB(const Circle& a, const AABB& b, Manifold& manifold)
+{
+   const Vector2D closest(
+      std::clamp(a.center.x, b.minX, b.maxX),
+      std::clamp(a.center.y, b.minY, b.maxY)
+   );
+
+   manifold.pointCount = 1;
+
+   // Center outside the box: push out along the line to the closest point
+   if (closest != a.center)
+   {
+      const Vector2D offset = closest - a.center;
+      const float distanceSquared = Vector2D::dot(offset, offset);
+      if (distanceSquared > a.radius * a.radius)
+      {
+         return false;
+      }
+
+      const float distance = std::sqrt(distanceSquared);
+      manifold.normal = offset / distance;
+      manifold.points[0] = {closest, a.radius - distance};
+      return true;
+   }
+
+   // Center inside the box: push out through the nearest face
+   const float toLeft = a.center.x - b.minX;
+   const float toRight = b.maxX - a.center.x;
+   const float toBottom = a.center.y - b.minY;
+   const float toTop = b.maxY - a.center.y;
+   const float nearest = std::min(std::min(toLeft, toRight), std::min(toBottom, toTop));
+
+   if (nearest == toLeft)
+   {
+      manifold.normal = Vector2D(1.0f, 0.0f);
+   }
+   else if (nearest == toRight)
+   {
+      manifold.normal = Vector2D(-1.0f, 0.0f);
+   }
+   else if (nearest == toBottom)
+   {
+      manifold.normal = Vector2D(0.0f, 1.0f);
+   }
+   else
+   {
+      manifold.normal = Vector2D(0.0f, -1.0f);
+   }
+
+   manifold.points[0] = {a.center, a.radius + nearest};
+   return true;
+}
+
+bool korin::sweepAABBs(const AABB& moving, const Vector2D& displacement, const AABB& target,
+   float& timeOfImpact, Vector2D& normal)
+{
+   // Shrink the moving box to a point by growing the target by its half extents
+   const float halfWidth = moving.width() * 0.5f;
+   const float halfHeight = moving.height() * 0.5f;
+   const AABB expanded(target.minX - halfWidth, target.minY - halfHeight, target.maxX + halfWidth, target.maxY + halfHeight);
+   const Vector2D start = moving.center();
+
+   const float infinity = std::numeric_limits<float>::infinity();
+   float entryX = -infinity, exitX = infinity;
+   float entryY = -infinity, exitY = infinity;
+
+   if (displacement.x != 0.0f)
+   {
+      const float nearX = (expanded.minX - start.x) / displacement.x;
+      const float farX = (expanded.maxX - start.x) / displacement.x;
+      entryX = std::min(nearX, farX);
+      exitX = std::max(nearX, farX);
+   }
+   else if (start.x < expanded.minX || start.x > expanded.maxX)
+   {
+      return false;
+   }
+
+   if (displacement.y != 0.0f)
+   {
+      const float nearY = (expanded.minY - start.y) / displacement.y;
+      const float farY = (expanded.maxY - start.y) / displacement.y;
+      entryY = std::min(nearY, farY);
+      exitY = std::max(nearY, farY);
+   }
+   else if (start.y < expanded.minY || start.y > expanded.maxY)
+   {
+      return false;
+   }
+
+   const float entry = std::max(entryX, entryY);
+   const float exit = std::min(exitX, exitY);
+   if (entry > exit || entry < 0.0f || entry > 1.0f)
+   {
+      return false;
+   }
+
+   timeOfImpact = entry;
+   if (entryX > entryY)
+   {
+      normal = Vector2D(displacement.x > 0.0f ? -1.0f : 1.0f, 0.0f);
+   }
+   else
+   {
+      normal = Vector2D(0.0f, displacement.y > 0.0f ? -1.0f : 1.0f);
+   }
+
+   return true;
+}
@@ -0,0 +1,296 @@
+// contact_solver.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+
+#include "korin/physics/contact_solver.h"
+#include "korin/util/thread_pool.h"
+#include "korin/util/byte_stream.h"
+
+using namespace korin;
+
+namespace
+{
+constexpr std::uint32_t NO_ISLAND = UINT32_MAX;
+} // namespace
+
+ContactSolver::ContactSolver()
+   : velocityIterations(8), positionIterations(3)
+   , baumgarte(0.2f), linearSlop(0.005f), maxCorrection(0.2f), restitutionThreshold(1.0f)
+   , warmStarting(true), parallelThreshold(256)
+   , m_ImpulseCache(std::unordered_map<std::uint64_t, CachedImpulse>())
+{
+}
+
+ContactSolver::~ContactSolver() = default;
+
+void ContactSolver::solve(std::vector<SolverBody>& bodies, std::vector<ContactConstraint>& contacts)
+{
+   // Prepare each contact and pick up last tick's impulses for pairs still touching
+   for (auto& contact : contacts)
+   {
+      const SolverBody& a = bodies[contact.bodyA];
+      const SolverBody& b = bodies[contact.bodyB];
+      const float inverseMassSum = a.inverseMass + b.inverseMass;
+      contact.normalMass = inverseMassSum > 0.0f ? 1.0f / inverseMassSum : 0.0f;
+
+      const float closingSpeed = Vector2D::dot(b.velocity - a.velocity, contact.manifold.normal);
+      contact.velocityBias = closingSpeed < -restitutionThreshold ? -contact.restitution * closingSpeed : 0.0f;
+
+      contact.normalImpulse = 0.0f;
+      contact.tangentImpulse = 0.0f;
+      if (warmStarting)
+      {
+         const auto cachedIt = m_ImpulseCache.find(contact.key);
+         if (cachedIt != m_ImpulseCache.end())
+         {
+            contact.normalImpulse = cachedIt->second.normal;
+            contact.tangentImpulse = cachedIt->second.tangent;
+         }
+      }
+   }
+
+   buildIslands(bodies, contacts);
+
+   const std::size_t islands = islandCount();
+   if (contacts.size() >= parallelThreshold && islands > 1)
+   {
+      if (!m_ThreadPool)
+      {
+         m_ThreadPool = std::make_unique<ThreadPool>();
+      }
+
+      m_ThreadPool->parallelFor(islands, [&](std::size_t begin, std::size_t end)
+      {
+         for (std::size_t island = begin; island < end; island++)
+         {
+            solveIsland(island, bodies, contacts);
+         }
+      });
+   }
+   else
+   {
+      for (std::size_t island = 0; island < islands; island++)
+      {
+         solveIsland(island, bodies, contacts);
+      }
+   }
+
+   for (const auto& contact : contacts)
+   {
+      m_ImpulseCache[contact.key] = {contact.normalImpulse, contact.tangentImpulse};
+   }
+}
+
+void ContactSolver::forget(std::uint64_t key)
+{
+   m_ImpulseCache.erase(key);
+}
+
+void ContactSolver::clearCache()
+{
+   m_ImpulseCache.clear();
+}
+
+void ContactSolver::writeCache(ByteWriter& writer) const
+{
+   std::vector<std::uint64_t> keys;
+   keys.reserve(m_ImpulseCache.size());
+   for (const auto& cached : m_ImpulseCache)
+   {
+      keys.push_back(cached.first);
+   }
+   std::sort(keys.begin(), keys.end());
+
+   writer.writeU32(static_cast<std::uint32_t>(keys.size()));
+   for (const std::uint64_t key : keys)
+   {
+      const CachedImpulse& impulse = m_ImpulseCache.at(key);
+      writer.writeU64(key);
+      writer.writeF32(impulse.normal);
+      writer.writeF32(impulse.tangent);
+   }
+}
+
+bool ContactSolver::readCache(ByteReader& reader)
+{
+   m_ImpulseCache.clear();
+   std::uint32_t count = 0;
+   if (!reader.readU32(count))
+   {
+      return false;
+   }
+
+   for (std::uint32_t i = 0; i < count; i++)
+   {
+      std::uint64_t key = 0;
+      CachedImpulse impulse = {};
+      if (!reader.readU64(key) || !reader.readF32(impulse.normal) || !reader.readF32(impulse.tangent))
+      {
+         m_ImpulseCache.clear();
+         return false;
+      }
+      m_ImpulseCache[key] = impulse;
+   }
+   return true;
+}
+
+void ContactSolver::buildIslands(const std::vector<SolverBody>& bodies, const std::vector<ContactConstraint>& contacts)
+{
+   m_Parents.resize(bodies.size());
+   for (std::uint32_t body = 0; body < bodies.size(); body++)
+   {
+      m_Parents[body] = body;
+   }
+
+   // Static bodies never join islands, otherwise everything
+   // standing on the same floor would become one island
+   for (const auto& contact : contacts)
+   {
+      if (bodies[contact.bodyA].inverseMass > 0.0f && bodies[contact.bodyB].inverseMass > 0.0f)
+      {
+         const std::uint32_t rootA = findRoot(contact.bodyA);
+         const std::uint32_t rootB = findRoot(contact.bodyB);
+         if (rootA != rootB)
+         {
+            m_Parents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+         }
+      }
+   }
+
+   // Number the islands in order of first appearance so the grouping is deterministic
+   m_RootIslands.assign(bodies.size(), NO_ISLAND);
+   m_ContactIslands.resize(contacts.size());
+   m_IslandOffsets.clear();
+   m_IslandOffsets.push_back(0);
+
+   std::uint32_t islands = 0;
+   for (std::size_t i = 0; i < contacts.size(); i++)
+   {
+      const auto& contact = contacts[i];
+      const std::uint32_t dynamicBody = bodies[contact.bodyA].inverseMass > 0.0f ? contact.bodyA : contact.bodyB;
+      if (bodies[dynamicBody].inverseMass <= 0.0f)
+      {
+         m_ContactIslands[i] = NO_ISLAND;
+         continue;
+      }
+
+      const std::uint32_t root = findRoot(dynamicBody);
+      if (m_RootIslands[root] == NO_ISLAND)
+      {
+         m_RootIslands[root] = islands++;
+         m_IslandOffsets.push_back(0);
+      }
+      m_ContactIslands[i] = m_RootIslands[root];
+      m_IslandOffsets[m_ContactIslands[i] + 1]++;
+   }
+
+   // Counting sort of the contacts by island keeps their original order within each island
+   for (std::uint32_t island = 0; island < islands; island++)
+   {
+      m_IslandOffsets[island + 1] += m_IslandOffsets[island];
+   }
+
+   m_IslandContacts.resize(m_IslandOffsets.back());
+   m_RootIslands.assign(islands, 0);
+   for (std::uint32_t i = 0; i < contacts.size(); i++)
+   {
+      const std::uint32_t island = m_ContactIslands[i];
+      if (island != NO_ISLAND)
+      {
+         m_IslandContacts[m_IslandOffsets[island] + m_RootIslands[island]++] = i;
+      }
+   }
+}
+
+void ContactSolver::solveIsland(std::size_t island, std::vector<SolverBody>& bodies, std::vector<ContactConstraint>& contacts) const
+{
+   const std::uint32_t* begin = m_IslandContacts.data() + m_IslandOffsets[island];
+   const std::uint32_t* end = m_IslandContacts.data() + m_IslandOffsets[island + 1];
+
+   // Applies an impulse to both bodies. Static bodies are shared between
+   // islands so they are never written to.
+   auto applyImpulse = [](SolverBody& a, SolverBody& b, const Vector2D& impulse)
+   {
+      if (a.inverseMass > 0.0f)
+      {
+         a.velocity = a.velocity - impulse * a.inverseMass;
+      }
+      if (b.inverseMass > 0.0f)
+      {
+         b.velocity = b.velocity + impulse * b.inverseMass;
+      }
+   };
+
+   for (const std::uint32_t* it = begin; it != end; ++it)
+   {
+      ContactConstraint& contact = contacts[*it];
+      const Vector2D& normal = contact.manifold.normal;
+      const Vector2D tangent(-normal.y, normal.x);
+      applyImpulse(bodies[contact.bodyA], bodies[contact.bodyB],
+         normal * contact.normalImpulse + tangent * contact.tangentImpulse);
+   }
+
+   for (std::int32_t iteration = 0; iteration < velocityIterations; iteration++)
+   {
+      for (const std::uint32_t* it = begin; it != end; ++it)
+      {
+         ContactConstraint& contact = contacts[*it];
+         SolverBody& a = bodies[contact.bodyA];
+         SolverBody& b = bodies[contact.bodyB];
+         const Vector2D& normal = contact.manifold.normal;
+         const Vector2D tangent(-normal.y, normal.x);
+
+         // Friction is bounded by the normal impulse so it is solved first
+         // against the normal impulse from the last iteration
+         const float tangentSpeed = Vector2D::dot(b.velocity - a.velocity, tangent);
+         const float maxFriction = contact.friction * contact.normalImpulse;
+         const float newTangentImpulse = std::clamp(contact.tangentImpulse - contact.normalMass * tangentSpeed, -maxFriction, maxFriction);
+         applyImpulse(a, b, tangent * (newTangentImpulse - contact.tangentImpulse));
+         contact.tangentImpulse = newTangentImpulse;
+
+         // Contacts can only push so the accumulated normal impulse is never negative
+         const float normalSpeed = Vector2D::dot(b.velocity - a.velocity, normal);
+         const float newNormalImpulse = std::max(contact.normalImpulse - contact.normalMass * (normalSpeed - contact.velocityBias), 0.0f);
+         applyImpulse(a, b, normal * (newNormalImpulse - contact.normalImpulse));
+         contact.normalImpulse = newNormalImpulse;
+      }
+   }
+
+   for (std::int32_t iteration = 0; iteration < positionIterations; iteration++)
+   {
+      for (const std::uint32_t* it = begin; it != end; ++it)
+      {
+         const ContactConstraint& contact = contacts[*it];
+         SolverBody& a = bodies[contact.bodyA];
+         SolverBody& b = bodies[contact.bodyB];
+         const Vector2D& normal = contact.manifold.normal;
+
+         const float separation = Vector2D::dot(b.positionCorrection - a.positionCorrection, normal) - contact.manifold.penetration();
+         const float correction = std::clamp(baumgarte * (separation + linearSlop), -maxCorrection, 0.0f);
+         const Vector2D impulse = normal * (-correction * contact.normalMass);
+
+         if (a.inverseMass > 0.0f)
+         {
+            a.positionCorrection = a.positionCorrection - impulse * a.inverseMass;
+         }
+         if (b.inverseMass > 0.0f)
+         {
+            b.positionCorrection = b.positionCorrection + impulse * b.inverseMass;
+         }
+      }
+   }
+}
+
+std::uint32_t ContactSolver::findRoot(std::uint32_t body)
+{
+   while (m_Parents[body] != body)
+   {
+      // Path halving keeps the trees flat
+      m_Parents[body] = m_Parents[m_Parents[body]];
+      body = m_Parents[body];
+   }
+   return body;
+}
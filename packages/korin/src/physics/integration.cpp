@@ -0,0 +1,57 @@
+// integration.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/physics/integration.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+   #include <emmintrin.h>
+   #define KORIN_INTEGRATE_SSE2
+#elif defined(__ARM_NEON)
+   #include <arm_neon.h>
+   #define KORIN_INTEGRATE_NEON
+#endif
+
+using namespace korin;
+
+void korin::integrateSemiImplicitEuler(std::size_t count, float timeStep,
+   float* positionX, float* positionY,
+   float* velocityX, float* velocityY,
+   const float* accelerationX, const float* accelerationY)
+{
+   std::size_t i = 0;
+
+#if defined(KORIN_INTEGRATE_SSE2)
+   const __m128 dt = _mm_set1_ps(timeStep);
+   for (; i + 4 <= count; i += 4)
+   {
+      const __m128 vx = _mm_add_ps(_mm_loadu_ps(velocityX + i), _mm_mul_ps(_mm_loadu_ps(accelerationX + i), dt));
+      const __m128 vy = _mm_add_ps(_mm_loadu_ps(velocityY + i), _mm_mul_ps(_mm_loadu_ps(accelerationY + i), dt));
+      _mm_storeu_ps(velocityX + i, vx);
+      _mm_storeu_ps(velocityY + i, vy);
+      _mm_storeu_ps(positionX + i, _mm_add_ps(_mm_loadu_ps(positionX + i), _mm_mul_ps(vx, dt)));
+      _mm_storeu_ps(positionY + i, _mm_add_ps(_mm_loadu_ps(positionY + i), _mm_mul_ps(vy, dt)));
+   }
+
+#elif defined(KORIN_INTEGRATE_NEON)
+   const float32x4_t dt = vdupq_n_f32(timeStep);
+   for (; i + 4 <= count; i += 4)
+   {
+      const float32x4_t vx = vmlaq_f32(vld1q_f32(velocityX + i), vld1q_f32(accelerationX + i), dt);
+      const float32x4_t vy = vmlaq_f32(vld1q_f32(velocityY + i), vld1q_f32(accelerationY + i), dt);
+      vst1q_f32(velocityX + i, vx);
+      vst1q_f32(velocityY + i, vy);
+      vst1q_f32(positionX + i, vmlaq_f32(vld1q_f32(positionX + i), vx, dt));
+      vst1q_f32(positionY + i, vmlaq_f32(vld1q_f32(positionY + i), vy, dt));
+   }
+#endif
+
+   for (; i < count; i++)
+   {
+      velocityX[i] += accelerationX[i] * timeStep;
+      velocityY[i] += accelerationY[i] * timeStep;
+      positionX[i] += velocityX[i] * timeStep;
+      positionY[i] += velocityY[i] * timeStep;
+   }
+}
@@ -0,0 +1,117 @@
+// hot_reloader.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/reload/hot_reloader.h"
+#include "korin/reload/system_module.h"
+#include "korin/serialization/prefab.h"
+#include "korin/serialization/scene_file.h"
+#include "korin/assets/pack_file.h"
+#include "korin/entity_admin.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+HotReloader::HotReloader(EntityAdmin& admin)
+   : m_Admin(admin), m_Watcher(FileWatcher()), m_SystemModule(nullptr), m_ReloadCount(0)
+{
+}
+
+HotReloader::~HotReloader()
+{
+}
+
+void HotReloader::watchPrefabs(const std::string& packPath, PrefabLibrary& library)
+{
+   m_Watcher.watch(packPath, [this, &library](const std::string& path)
+   {
+      m_ReloadCount += reloadPrefabs(path, library) ? 1 : 0;
+   });
+}
+
+void HotReloader::watchScene(const std::string& scenePath)
+{
+   m_Watcher.watch(scenePath, [this](const std::string& path)
+   {
+      m_ReloadCount += reloadScene(path) ? 1 : 0;
+   });
+}
+
+bool HotReloader::watchSystemModule(const std::string& libraryPath)
+{
+   if (!m_SystemModule)
+   {
+      m_SystemModule = std::make_unique<SystemModule>(m_Admin);
+   }
+
+   if (!m_SystemModule->load(libraryPath))
+   {
+      return false;
+   }
+
+   m_Watcher.watch(libraryPath, [this](const std::string& path)
+   {
+      m_ReloadCount += m_SystemModule->reload() ? 1 : 0;
+   });
+   return true;
+}
+
+std::size_t HotReloader::update()
+{
+   return m_Watcher.poll();
+}
+
+bool HotReloader::reloadPrefabs(const std::string& packPath, PrefabLibrary& library)
+{
+   PackFile pack;
+   if (!pack.open(packPath))
+   {
+      return false;
+   }
+
+   // Every prefab is read before any is applied, so a bad pack changes nothing
+   std::vector<Prefab> prefabs;
+   for (std::uint32_t entry = 0; entry < pack.entries().size(); entry++)
+   {
+      const PackEntry& packEntry = pack.entries()[entry];
+      if (packEntry.type != PackBlobType::Prefab)
+      {
+         continue;
+      }
+
+      prefabs.emplace_back(StringID::intern(packEntry.name));
+      if (!prefabs.back().deserialize(pack.data(entry), static_cast<std::size_t>(packEntry.size)))
+      {
+         KORIN_CORE_WARN("Prefabs of " + packPath + " were not reloaded.");
+         return false;
+      }
+   }
+
+   std::uint32_t updatedEntities = 0;
+   for (Prefab& prefab : prefabs)
+   {
+      const Prefab* previous = library.find(prefab.handle());
+      if (previous)
+      {
+         updatedEntities += prefab.applyChanges(m_Admin, *previous);
+      }
+      library.add(std::move(prefab));
+   }
+
+   KORIN_CORE_INFO("Reloaded " + std::to_string(prefabs.size()) + " prefabs from " + packPath + " and updated "
+      + std::to_string(updatedEntities) + " entities.");
+   return true;
+}
+
+bool HotReloader::reloadScene(const std::string& scenePath)
+{
+   SceneFile scene;
+   if (!scene.open(scenePath) || !scene.load(m_Admin))
+   {
+      return false;
+   }
+
+   KORIN_CORE_INFO("Reloaded scene " + scenePath + ".");
+   return true;
+}
@@ -0,0 +1,138 @@
+// system_module.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <filesystem>
+
+#if defined(KORIN_PLATFORM_WINDOWS)
+   #include <windows.h>
+#else
+   #include <dlfcn.h>
+#endif
+
+#include "korin/reload/system_module.h"
+#include "korin/entity_admin.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+SystemModule::SystemModule(EntityAdmin& admin)
+   : m_Admin(admin), m_Path(std::string()), m_Library(nullptr), m_LoadedPath(std::string())
+   , m_Systems(std::vector<SystemPtr>()), m_LoadCount(0)
+{
+}
+
+SystemModule::~SystemModule()
+{
+   unload();
+}
+
+bool SystemModule::load(const std::string& path)
+{
+   // Each load gets a copy with its own name, so the loader doesn't hand back the library already open.
+   // The path is absolute because the loader searches the library paths for a bare file name.
+   std::error_code error;
+   const std::string loadedPath = std::filesystem::absolute(path, error).string() + "." + std::to_string(m_LoadCount) + ".live";
+   std::filesystem::copy_file(path, loadedPath, std::filesystem::copy_options::overwrite_existing, error);
+   if (error)
+   {
+      KORIN_CORE_WARN("Could not copy system module " + path + ". " + error.message());
+      return false;
+   }
+
+   void* library = openLibrary(loadedPath);
+   auto createSystems = library ? reinterpret_cast<CreateSystemsFunction>(findSymbol(library, SYSTEM_MODULE_ENTRY_POINT)) : nullptr;
+   if (!createSystems)
+   {
+      KORIN_CORE_WARN("System module " + path + " could not be loaded or has no " + SYSTEM_MODULE_ENTRY_POINT + ".");
+      if (library)
+      {
+         closeLibrary(library);
+      }
+      std::filesystem::remove(loadedPath, error);
+      return false;
+   }
+
+   std::vector<ModuleSystem> created;
+   createSystems(created);
+
+   // The old systems have to be gone before the code they run is unloaded
+   unload();
+   for (const ModuleSystem& moduleSystem : created)
+   {
+      if (moduleSystem.system && m_Admin.addSystem(moduleSystem.system, moduleSystem.desc))
+      {
+         m_Systems.push_back(moduleSystem.system);
+      }
+   }
+   created.clear();
+
+   m_Path = path;
+   m_Library = library;
+   m_LoadedPath = loadedPath;
+   m_LoadCount++;
+   KORIN_CORE_INFO("Loaded " + std::to_string(m_Systems.size()) + " systems from " + path + ".");
+   return true;
+}
+
+bool SystemModule::reload()
+{
+   if (m_Path.empty())
+   {
+      KORIN_CORE_WARN("Cannot reload a system module that was never loaded.");
+      return false;
+   }
+   return load(m_Path);
+}
+
+void SystemModule::unload()
+{
+   for (const SystemPtr& system : m_Systems)
+   {
+      m_Admin.removeSystem(system);
+   }
+   m_Systems.clear();
+
+   if (m_Library)
+   {
+      closeLibrary(m_Library);
+      m_Library = nullptr;
+
+      std::error_code error;
+      std::filesystem::remove(m_LoadedPath, error);
+      m_LoadedPath.clear();
+   }
+}
+
+void* SystemModule::openLibrary(const std::string& path)
+{
+#if defined(KORIN_PLATFORM_WINDOWS)
+   return LoadLibraryA(path.c_str());
+#else
+   void* library = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+   if (!library)
+   {
+      KORIN_CORE_WARN(std::string(dlerror()));
+   }
+   return library;
+#endif
+}
+
+void* SystemModule::findSymbol(void* library, const char* name)
+{
+#if defined(KORIN_PLATFORM_WINDOWS)
+   return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(library), name));
+#else
+   return dlsym(library, name);
+#endif
+}
+
+void SystemModule::closeLibrary(void* library)
+{
+#if defined(KORIN_PLATFORM_WINDOWS)
+   FreeLibrary(static_cast<HMODULE>(library));
+#else
+   dlclose(library);
+#endif
+}
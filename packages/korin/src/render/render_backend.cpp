@@ -0,0 +1,20 @@
+// render_backend.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/render/render_backend.h"
+#include "korin/render/software_render_backend.h"
+
+using namespace korin;
+
+namespace
+{
+constexpr std::uint32_t DEFAULT_WIDTH = 320;
+constexpr std::uint32_t DEFAULT_HEIGHT = 180;
+} // namespace
+
+std::unique_ptr<RenderBackend> RenderBackend::createPlatformBackend()
+{
+   return std::make_unique<SoftwareRenderBackend>(DEFAULT_WIDTH, DEFAULT_HEIGHT);
+}
@@ -0,0 +1,53 @@
+// render_command_buffer.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/render/render_command_buffer.h"
+
+using namespace korin;
+
+RenderCommandBuffer::RenderCommandBuffer(std::uint32_t width, std::uint32_t height)
+   : m_Width(width), m_Height(height), m_View({0.0f, 0.0f, 1.0f})
+   , m_Commands(std::vector<RenderCommand>()), m_Instances(std::vector<SpriteInstance>())
+{
+}
+
+void RenderCommandBuffer::beginFrame(const RenderView& view)
+{
+   m_View = view;
+   m_Commands.clear();
+   m_Instances.clear();
+   m_Commands.push_back({RenderCommandType::BeginFrame, 0, 0, 0});
+}
+
+void RenderCommandBuffer::drawInstances(TextureID textureID, const SpriteInstance* instances, std::size_t count)
+{
+   m_Commands.push_back({RenderCommandType::DrawInstances, textureID,
+      static_cast<std::uint32_t>(m_Instances.size()), static_cast<std::uint32_t>(count)});
+   m_Instances.insert(m_Instances.end(), instances, instances + count);
+}
+
+void RenderCommandBuffer::endFrame()
+{
+   m_Commands.push_back({RenderCommandType::EndFrame, 0, 0, 0});
+}
+
+void RenderCommandBuffer::execute(RenderBackend& backend) const
+{
+   for (const RenderCommand& command : m_Commands)
+   {
+      switch (command.type)
+      {
+         case RenderCommandType::BeginFrame:
+            backend.beginFrame(m_View);
+            break;
+         case RenderCommandType::DrawInstances:
+            backend.drawInstances(command.textureID, m_Instances.data() + command.firstInstance, command.instanceCount);
+            break;
+         case RenderCommandType::EndFrame:
+            backend.endFrame();
+            break;
+      }
+   }
+}
@@ -0,0 +1,131 @@
+// render_thread.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <chrono>
+
+#include "korin/render/render_thread.h"
+#include "korin/log.h"
+#include "korin/util/assert.h"
+
+using namespace korin;
+
+namespace
+{
+// Longest the render thread sleeps before looking for a frame it wasn't woken for
+constexpr std::chrono::milliseconds WAKE_TIMEOUT(2);
+} // namespace
+
+RenderThread::RenderThread(std::unique_ptr<RenderBackend> backend)
+   : m_Backend(std::move(backend)), m_Frames(), m_Submitted(), m_Free(), m_Thread(), m_Stopping(false)
+   , m_FramesRendered(0), m_FramesSkipped(0), m_FramesDropped(0)
+{
+   KORIN_ASSERT(m_Backend);
+   for (std::uint32_t i = 0; i < FRAME_COUNT; i++)
+   {
+      m_Frames[i] = std::make_unique<RenderCommandBuffer>(m_Backend->width(), m_Backend->height());
+      m_Free.tryPush(i);
+   }
+}
+
+RenderThread::~RenderThread()
+{
+   stop();
+}
+
+bool RenderThread::start()
+{
+   if (m_Thread.joinable())
+   {
+      KORIN_CORE_WARN("RenderThread is already running.");
+      return false;
+   }
+
+   m_Stopping = false;
+   m_Thread = std::thread(&RenderThread::renderLoop, this);
+   return true;
+}
+
+void RenderThread::stop()
+{
+   if (!m_Thread.joinable())
+   {
+      return;
+   }
+
+   m_Stopping = true;
+   m_Wake.notify_one();
+   m_Thread.join();
+}
+
+RenderCommandBuffer* RenderThread::acquireFrame()
+{
+   std::uint32_t index = 0;
+   if (!m_Free.tryPop(index))
+   {
+      m_FramesDropped.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+   }
+   return m_Frames[index].get();
+}
+
+void RenderThread::submitFrame(RenderCommandBuffer* frame)
+{
+   for (std::uint32_t i = 0; i < FRAME_COUNT; i++)
+   {
+      if (m_Frames[i].get() == frame)
+      {
+         // There are more queue slots than buffers so this can't fail
+         m_Submitted.tryPush(i);
+         m_Wake.notify_one();
+         return;
+      }
+   }
+   KORIN_CORE_WARN("Submitted a frame that wasn't acquired from this RenderThread.");
+}
+
+bool RenderThread::renderPending()
+{
+   std::uint32_t newest = 0;
+   if (!m_Submitted.tryPop(newest))
+   {
+      return false;
+   }
+
+   // Only the newest frame is worth drawing
+   std::uint32_t next = 0;
+   while (m_Submitted.tryPop(next))
+   {
+      m_Free.tryPush(newest);
+      m_FramesSkipped.fetch_add(1, std::memory_order_relaxed);
+      newest = next;
+   }
+
+   m_Frames[newest]->execute(*m_Backend);
+   m_Free.tryPush(newest);
+   m_FramesRendered.fetch_add(1, std::memory_order_relaxed);
+   return true;
+}
+
+std::unique_ptr<RenderBackend> RenderThread::releaseBackend()
+{
+   stop();
+   return std::move(m_Backend);
+}
+
+void RenderThread::renderLoop()
+{
+   while (!m_Stopping.load())
+   {
+      if (renderPending())
+      {
+         continue;
+      }
+
+      std::unique_lock<std::mutex> lock(m_WakeMutex);
+      m_Wake.wait_for(lock, WAKE_TIMEOUT, [this]() { return m_Stopping.load() || !m_Submitted.empty(); });
+   }
+
+   renderPending();
+}
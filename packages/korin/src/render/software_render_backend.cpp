@@ -0,0 +1,160 @@
+// software_render_backend.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cmath>
+
+#include "korin/render/software_render_backend.h"
+
+using namespace korin;
+
+namespace
+{
+std::uint32_t channel(std::uint32_t color, std::uint32_t shift)
+{
+   return (color >> shift) & 0xFF;
+}
+
+// Multiplies two colors channel by channel
+std::uint32_t modulate(std::uint32_t a, std::uint32_t b)
+{
+   std::uint32_t result = 0;
+   for (std::uint32_t shift = 0; shift < 32; shift += 8)
+   {
+      result |= ((channel(a, shift) * channel(b, shift) + 127) / 255) << shift;
+   }
+   return result;
+}
+
+// Source over destination, leaving the destination opaque
+std::uint32_t blend(std::uint32_t source, std::uint32_t destination)
+{
+   const std::uint32_t alpha = channel(source, 24);
+   std::uint32_t result = 0xFF000000u;
+   for (std::uint32_t shift = 0; shift < 24; shift += 8)
+   {
+      const std::uint32_t value = (channel(source, shift) * alpha + channel(destination, shift) * (255 - alpha) + 127) / 255;
+      result |= value << shift;
+   }
+   return result;
+}
+} // namespace
+
+SoftwareRenderBackend::SoftwareRenderBackend(std::uint32_t width, std::uint32_t height)
+   : clearColor(rgba(0, 0, 0)), m_Width(width), m_Height(height)
+   , m_Pixels(std::vector<std::uint32_t>(static_cast<std::size_t>(width) * height, clearColor))
+   , m_Textures(std::unordered_map<TextureID, Texture>()), m_View({0.0f, 0.0f, 1.0f})
+   , m_DrawCalls(0), m_InstancesDrawn(0)
+{
+}
+
+void SoftwareRenderBackend::setTexture(TextureID textureID, std::uint32_t width, std::uint32_t height, const std::uint32_t* pixels)
+{
+   m_Textures[textureID] = {width, height, std::vector<std::uint32_t>(pixels, pixels + static_cast<std::size_t>(width) * height)};
+}
+
+void SoftwareRenderBackend::beginFrame(const RenderView& view)
+{
+   m_View = view;
+   m_DrawCalls = 0;
+   m_InstancesDrawn = 0;
+   std::fill(m_Pixels.begin(), m_Pixels.end(), clearColor);
+}
+
+void SoftwareRenderBackend::drawInstances(TextureID textureID, const SpriteInstance* instances, std::size_t count)
+{
+   const auto textureIt = m_Textures.find(textureID);
+   const Texture* texture = textureIt == m_Textures.end() || textureIt->second.pixels.empty() ? nullptr : &textureIt->second;
+
+   for (std::size_t i = 0; i < count; i++)
+   {
+      drawInstance(instances[i], texture);
+   }
+
+   m_DrawCalls++;
+   m_InstancesDrawn += static_cast<std::uint32_t>(count);
+}
+
+void SoftwareRenderBackend::drawInstance(const SpriteInstance& instance, const Texture* texture)
+{
+   const float pixelHalfWidth = instance.halfWidth * m_View.pixelsPerUnit;
+   const float pixelHalfHeight = instance.halfHeight * m_View.pixelsPerUnit;
+   if (pixelHalfWidth <= 0.0f || pixelHalfHeight <= 0.0f)
+   {
+      return;
+   }
+
+   // Screen y grows downward while world y grows upward
+   const float centerX = (instance.x - m_View.centerX) * m_View.pixelsPerUnit + 0.5f * static_cast<float>(m_Width);
+   const float centerY = 0.5f * static_cast<float>(m_Height) - (instance.y - m_View.centerY) * m_View.pixelsPerUnit;
+   const float cosine = instance.cosRotation;
+   const float sine = instance.sinRotation;
+
+   const float extentX = std::fabs(cosine) * pixelHalfWidth + std::fabs(sine) * pixelHalfHeight;
+   const float extentY = std::fabs(sine) * pixelHalfWidth + std::fabs(cosine) * pixelHalfHeight;
+   const int minX = std::max(0, static_cast<int>(std::floor(centerX - extentX)));
+   const int maxX = std::min(static_cast<int>(m_Width) - 1, static_cast<int>(std::ceil(centerX + extentX)));
+   const int minY = std::max(0, static_cast<int>(std::floor(centerY - extentY)));
+   const int maxY = std::min(static_cast<int>(m_Height) - 1, static_cast<int>(std::ceil(centerY + extentY)));
+   if (minX > maxX || minY > maxY)
+   {
+      return;
+   }
+
+   // Sprite space runs from -1 to 1 on both axes with t pointing up, and is linear in
+   // screen space so it's stepped per pixel instead of transformed
+   const float stepSX = cosine / pixelHalfWidth;
+   const float stepTX = -sine / pixelHalfHeight;
+   const float stepSY = -sine / pixelHalfWidth;
+   const float stepTY = -cosine / pixelHalfHeight;
+
+   const float startX = static_cast<float>(minX) + 0.5f - centerX;
+   const float startY = static_cast<float>(minY) + 0.5f - centerY;
+   float rowS = startX * stepSX + startY * stepSY;
+   float rowT = startX * stepTX + startY * stepTY;
+
+   const float uScale = 0.5f * (instance.u1 - instance.u0);
+   const float vScale = 0.5f * (instance.v1 - instance.v0);
+   const bool tinted = instance.color != WHITE;
+
+   for (int y = minY; y <= maxY; y++)
+   {
+      float s = rowS;
+      float t = rowT;
+      std::uint32_t* row = m_Pixels.data() + static_cast<std::size_t>(y) * m_Width;
+
+      for (int x = minX; x <= maxX; x++, s += stepSX, t += stepTX)
+      {
+         if (s < -1.0f || s > 1.0f || t < -1.0f || t > 1.0f)
+         {
+            continue;
+         }
+
+         std::uint32_t color = instance.color;
+         if (texture)
+         {
+            const float u = instance.u0 + (s + 1.0f) * uScale;
+            const float v = instance.v0 + (1.0f - t) * vScale;
+            const auto texelX = std::min(static_cast<std::uint32_t>(std::max(u, 0.0f) * static_cast<float>(texture->width)), texture->width - 1);
+            const auto texelY = std::min(static_cast<std::uint32_t>(std::max(v, 0.0f) * static_cast<float>(texture->height)), texture->height - 1);
+            const std::uint32_t texel = texture->pixels[texelY * texture->width + texelX];
+            color = tinted ? modulate(texel, instance.color) : texel;
+         }
+
+         const std::uint32_t alpha = channel(color, 24);
+         if (alpha == 255)
+         {
+            row[x] = color;
+         }
+         else if (alpha > 0)
+         {
+            row[x] = blend(color, row[x]);
+         }
+      }
+
+      rowS += stepSY;
+      rowT += stepTY;
+   }
+}
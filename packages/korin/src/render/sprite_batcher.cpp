@@ -0,0 +1,135 @@
+// sprite_batcher.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "korin/render/sprite_batcher.h"
+#include "korin/components/sprite_component.h"
+#include "korin/components/transform_component.h"
+#include "korin/util/bit_util.h"
+
+using namespace korin;
+
+namespace
+{
+constexpr float DEGREES_TO_RADIANS = 3.14159265358979f / 180.0f;
+
+std::uint64_t sortKey(std::int16_t layer, TextureID textureID)
+{
+   // Biasing the layer keeps negative layers ahead of the positive ones when sorted unsigned,
+   // so they are drawn first and end up behind
+   const auto biasedLayer = static_cast<std::uint16_t>(static_cast<std::int32_t>(layer) + 32768);
+   return (static_cast<std::uint64_t>(biasedLayer) << 32) | textureID;
+}
+} // namespace
+
+SpriteBatcher::SpriteBatcher()
+   : m_Gathered(std::vector<SpriteInstance>()), m_GatheredKeys(std::vector<std::uint64_t>())
+   , m_Bounds(std::vector<AABB4>()), m_SortEntries(std::vector<SortEntry>())
+   , m_Instances(std::vector<SpriteInstance>()), m_Batches(std::vector<DrawBatch>()), m_CulledCount(0)
+{
+}
+
+void SpriteBatcher::build(const std::vector<ComponentPtr>& sprites)
+{
+   const float limit = std::numeric_limits<float>::max();
+   build(sprites, AABB(-limit, -limit, limit, limit));
+}
+
+void SpriteBatcher::build(const std::vector<ComponentPtr>& sprites, const AABB& visibleArea)
+{
+   m_Gathered.clear();
+   m_GatheredKeys.clear();
+   m_Bounds.clear();
+   m_SortEntries.clear();
+
+   for (const ComponentPtr& component : sprites)
+   {
+      const auto& sprite = static_cast<const SpriteComponent&>(*component);
+      if (!sprite.visible)
+      {
+         continue;
+      }
+
+      auto transform = sprite.sibling<TransformComponent>().lock();
+      if (!transform)
+      {
+         continue;
+      }
+
+      const float radians = transform->rotation * DEGREES_TO_RADIANS;
+      const SpriteInstance instance = {
+         transform->x, transform->y,
+         0.5f * sprite.width * std::fabs(transform->scaleX), 0.5f * sprite.height * std::fabs(transform->scaleY),
+         std::cos(radians), std::sin(radians),
+         sprite.u0, sprite.v0, sprite.u1, sprite.v1,
+         sprite.color
+      };
+
+      // Bounds of the rotated quad
+      const float cosine = std::fabs(instance.cosRotation);
+      const float sine = std::fabs(instance.sinRotation);
+      const float extentX = cosine * instance.halfWidth + sine * instance.halfHeight;
+      const float extentY = sine * instance.halfWidth + cosine * instance.halfHeight;
+
+      const std::size_t lane = m_Gathered.size() % 4;
+      if (lane == 0)
+      {
+         m_Bounds.emplace_back();
+      }
+      m_Bounds.back().set(static_cast<int>(lane),
+         AABB(instance.x - extentX, instance.y - extentY, instance.x + extentX, instance.y + extentY));
+
+      m_Gathered.push_back(instance);
+      m_GatheredKeys.push_back(sortKey(sprite.layer, sprite.textureID));
+   }
+
+   for (std::size_t block = 0; block < m_Bounds.size(); block++)
+   {
+      std::uint32_t mask = overlapMask(m_Bounds[block], visibleArea);
+      while (mask != 0)
+      {
+         const std::size_t index = block * 4 + static_cast<std::size_t>(countTrailingZeros(mask));
+         mask &= mask - 1;
+
+         // Empty lanes at the end still overlap an unbounded area
+         if (index < m_Gathered.size())
+         {
+            m_SortEntries.push_back({m_GatheredKeys[index], static_cast<std::uint32_t>(index)});
+         }
+      }
+   }
+   m_CulledCount = static_cast<std::uint32_t>(m_Gathered.size() - m_SortEntries.size());
+
+   std::sort(m_SortEntries.begin(), m_SortEntries.end(), [](const SortEntry& a, const SortEntry& b)
+   {
+      return a.key != b.key ? a.key < b.key : a.index < b.index;
+   });
+
+   m_Instances.resize(m_SortEntries.size());
+   m_Batches.clear();
+   for (std::size_t i = 0; i < m_SortEntries.size(); i++)
+   {
+      const SortEntry& entry = m_SortEntries[i];
+      m_Instances[i] = m_Gathered[entry.index];
+
+      if (m_Batches.empty() || sortKey(m_Batches.back().layer, m_Batches.back().textureID) != entry.key)
+      {
+         const auto layer = static_cast<std::int16_t>(static_cast<std::int32_t>(entry.key >> 32) - 32768);
+         m_Batches.push_back({static_cast<TextureID>(entry.key), layer, static_cast<std::uint32_t>(i), 0});
+      }
+      m_Batches.back().instanceCount++;
+   }
+}
+
+void SpriteBatcher::submit(RenderBackend& backend) const
+{
+   for (const DrawBatch& batch : m_Batches)
+   {
+      backend.drawInstances(batch.textureID, m_Instances.data() + batch.firstInstance, batch.instanceCount);
+   }
+}
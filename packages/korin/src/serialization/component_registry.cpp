@@ -0,0 +1,167 @@
+// component_registry.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+
+#include "korin/serialization/component_registry.h"
+#include "korin/entity_admin.h"
+#include "korin/util/string_id.h"
+#include "korin/components/transform_component.h"
+#include "korin/components/physics_component.h"
+#include "korin/components/bounds_component.h"
+#include "korin/components/collider_component.h"
+#include "korin/components/input_stream_component.h"
+#include "korin/components/sprite_component.h"
+#include "korin/components/camera_component.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+ComponentRegistry::ComponentRegistry()
+   : m_Types(std::vector<ComponentType>()), m_IndexByTypeID(std::vector<std::int32_t>())
+   , m_IndexByStableID(std::unordered_map<std::uint32_t, std::int32_t>())
+{
+   registerBuiltinTypes();
+}
+
+const ComponentType* ComponentRegistry::find(ComponentTypeID typeID) const
+{
+   if (typeID >= m_IndexByTypeID.size() || m_IndexByTypeID[typeID] < 0)
+   {
+      return nullptr;
+   }
+   return &m_Types[static_cast<std::size_t>(m_IndexByTypeID[typeID])];
+}
+
+const ComponentType* ComponentRegistry::findStable(std::uint32_t stableID) const
+{
+   const auto indexIt = m_IndexByStableID.find(stableID);
+   return indexIt == m_IndexByStableID.end() ? nullptr : &m_Types[static_cast<std::size_t>(indexIt->second)];
+}
+
+void ComponentRegistry::gather(const EntityAdmin& admin, std::vector<EntityID>& entityIDs, std::vector<ComponentColumn>& columns) const
+{
+   entityIDs.clear();
+   for (const auto& entity : admin.entities())
+   {
+      entityIDs.push_back(entity.first);
+   }
+   std::sort(entityIDs.begin(), entityIDs.end());
+
+   columns.resize(m_Types.size());
+   for (ComponentColumn& column : columns)
+   {
+      column.entityIDs.clear();
+      column.components.clear();
+   }
+
+   for (const EntityID entityID : entityIDs)
+   {
+      for (const auto& component : admin.components(entityID))
+      {
+         const ComponentType* type = find(component->typeID());
+         if (type)
+         {
+            ComponentColumn& column = columns[static_cast<std::size_t>(type - m_Types.data())];
+            column.entityIDs.push_back(entityID);
+            column.components.push_back(component.get());
+         }
+      }
+   }
+}
+
+const ComponentType* ComponentRegistry::matchSchema(const ColumnSchema& schema, const std::string& source) const
+{
+   const ComponentType* type = findStable(schema.stableID);
+   if (!type)
+   {
+      KORIN_CORE_WARN(source + " has an unregistered component type(" + std::to_string(schema.stableID) + ").");
+      return nullptr;
+   }
+
+   if (schema.schemaVersion != type->schemaVersion || schema.fieldSizes != type->fieldSizes || schema.rowSize != type->rowSize)
+   {
+      KORIN_CORE_WARN(source + " schema(" + std::to_string(schema.schemaVersion) + ") of " + type->name
+         + " doesn't match the registered schema(" + std::to_string(type->schemaVersion) + ").");
+      return nullptr;
+   }
+   return type;
+}
+
+std::uint32_t ComponentRegistry::hashName(const std::string& name)
+{
+   return StringID::hash(name.data(), name.size());
+}
+
+bool ComponentRegistry::add(ComponentType type)
+{
+   const auto stableIt = m_IndexByStableID.find(type.stableID);
+   if (stableIt != m_IndexByStableID.end() && m_Types[static_cast<std::size_t>(stableIt->second)].typeID != type.typeID)
+   {
+      KORIN_CORE_WARN("Component name " + type.name + " is already registered to another type.");
+      return false;
+   }
+
+   if (type.typeID >= m_IndexByTypeID.size())
+   {
+      m_IndexByTypeID.resize(type.typeID + 1, -1);
+   }
+
+   std::int32_t& index = m_IndexByTypeID[type.typeID];
+   if (index >= 0)
+   {
+      // Re-registering a type replaces it, and its old name if that changed
+      m_IndexByStableID.erase(m_Types[static_cast<std::size_t>(index)].stableID);
+      m_Types[static_cast<std::size_t>(index)] = std::move(type);
+   }
+   else
+   {
+      index = static_cast<std::int32_t>(m_Types.size());
+      m_Types.push_back(std::move(type));
+   }
+
+   m_IndexByStableID[m_Types[static_cast<std::size_t>(index)].stableID] = index;
+   return true;
+}
+
+void ComponentRegistry::registerBuiltinTypes()
+{
+   registerType<TransformComponent>("Transform", 1,
+      &TransformComponent::x, &TransformComponent::y, &TransformComponent::rotation,
+      &TransformComponent::scaleX, &TransformComponent::scaleY);
+
+   registerType<PhysicsComponent>("Physics", 1,
+      &PhysicsComponent::dx, &PhysicsComponent::dy,
+      &PhysicsComponent::accelerationX, &PhysicsComponent::accelerationY,
+      &PhysicsComponent::inverseMass, &PhysicsComponent::enabled,
+      &PhysicsComponent::sleeping, &PhysicsComponent::sleepTime);
+
+   registerType<BoundsComponent>("Bounds", 1,
+      &BoundsComponent::halfWidth, &BoundsComponent::halfHeight);
+
+   registerType<ColliderComponent>("Collider", 1,
+      &ColliderComponent::shape, &ColliderComponent::halfWidth, &ColliderComponent::halfHeight,
+      &ColliderComponent::radius, &ColliderComponent::friction, &ColliderComponent::restitution,
+      &ColliderComponent::grounded);
+
+   registerType<InputStreamComponent>("InputStream", 1,
+      &InputStreamComponent::currentActionStates, &InputStreamComponent::previousActionStates,
+      &InputStreamComponent::actionsBegun, &InputStreamComponent::actionsEnded,
+      &InputStreamComponent::source, &InputStreamComponent::externalActionStates,
+      &InputStreamComponent::actionsHeld, &InputStreamComponent::actionsHoldBegun,
+      &InputStreamComponent::actionsDoubleTapped, &InputStreamComponent::combosCompleted,
+      &InputStreamComponent::holdCounter, &InputStreamComponent::tapCounter,
+      &InputStreamComponent::tapArmed, &InputStreamComponent::comboState,
+      &InputStreamComponent::comboIdleTicks);
+
+   registerType<SpriteComponent>("Sprite", 2,
+      &SpriteComponent::textureID, &SpriteComponent::assetID, &SpriteComponent::layer,
+      &SpriteComponent::width, &SpriteComponent::height,
+      &SpriteComponent::u0, &SpriteComponent::v0, &SpriteComponent::u1, &SpriteComponent::v1,
+      &SpriteComponent::color, &SpriteComponent::visible);
+
+   registerType<CameraComponent>("Camera", 1,
+      &CameraComponent::pixelsPerUnit, &CameraComponent::priority, &CameraComponent::active);
+}
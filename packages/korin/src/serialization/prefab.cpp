@@ -0,0 +1,293 @@
+// prefab.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cstring>
+
+#include "korin/serialization/prefab.h"
+#include "korin/serialization/component_registry.h"
+#include "korin/assets/pack_file.h"
+#include "korin/entity_admin.h"
+#include "korin/util/byte_stream.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+Prefab::Prefab()
+   : m_Handle(StringID()), m_Components(std::vector<Entry>())
+{
+}
+
+Prefab::Prefab(StringID handle)
+   : m_Handle(handle), m_Components(std::vector<Entry>())
+{
+}
+
+bool Prefab::add(const ComponentPtr& component)
+{
+   const ComponentRegistry& registry = ComponentRegistry::instance();
+   const ComponentType* type = component ? registry.find(component->typeID()) : nullptr;
+   if (!type)
+   {
+      KORIN_CORE_WARN("Only registered component types can be added to a prefab.");
+      return false;
+   }
+
+   const auto typeIndex = static_cast<std::size_t>(type - registry.types().data());
+   auto entryIt = std::find_if(m_Components.begin(), m_Components.end(),
+      [typeIndex](const Entry& entry) { return entry.typeIndex == typeIndex; });
+   if (entryIt == m_Components.end())
+   {
+      m_Components.push_back({typeIndex, std::vector<std::uint8_t>()});
+      entryIt = m_Components.end() - 1;
+   }
+
+   Component* source = component.get();
+   entryIt->row.resize(type->rowSize);
+   type->pack(&source, 1, entryIt->row.data());
+   return true;
+}
+
+bool Prefab::capture(const EntityAdmin& admin, EntityID entityID)
+{
+   const auto entityIt = admin.entities().find(entityID);
+   if (entityIt == admin.entities().end())
+   {
+      KORIN_CORE_WARN("EntityID(" + std::to_string(entityID) + ") does not exist for a prefab.");
+      return false;
+   }
+
+   m_Handle = entityIt->second->getResourceHandle();
+   m_Components.clear();
+   for (const ComponentPtr& component : admin.components(entityID))
+   {
+      // Unregistered components are left out
+      if (ComponentRegistry::instance().find(component->typeID()))
+      {
+         add(component);
+      }
+   }
+   return true;
+}
+
+void Prefab::serialize(std::vector<std::uint8_t>& data) const
+{
+   const std::vector<ComponentType>& types = ComponentRegistry::instance().types();
+   data.clear();
+   ByteWriter writer(data);
+   writer.writeU32(PREFAB_MAGIC);
+   writer.writeU16(PREFAB_VERSION);
+   writer.writeU16(static_cast<std::uint16_t>(m_Components.size()));
+   for (const Entry& entry : m_Components)
+   {
+      const ComponentType& type = types[entry.typeIndex];
+      writer.writeU32(type.stableID);
+      writer.writeU16(type.schemaVersion);
+      writer.writeU16(static_cast<std::uint16_t>(type.fieldSizes.size()));
+      for (const std::uint16_t fieldSize : type.fieldSizes)
+      {
+         writer.writeU16(fieldSize);
+      }
+      writer.writeU32(type.rowSize);
+      writer.writeBytes(entry.row.data(), entry.row.size());
+   }
+}
+
+bool Prefab::deserialize(const std::uint8_t* data, std::size_t size)
+{
+   m_Components.clear();
+
+   ByteReader reader(data, size);
+   std::uint32_t magic = 0;
+   std::uint16_t version = 0, componentCount = 0;
+   if (!reader.readU32(magic) || !reader.readU16(version) || !reader.readU16(componentCount)
+      || magic != PREFAB_MAGIC || version != PREFAB_VERSION)
+   {
+      KORIN_CORE_WARN("Prefab header is invalid.");
+      return false;
+   }
+
+   const ComponentRegistry& registry = ComponentRegistry::instance();
+   std::vector<Entry> components;
+   for (std::uint16_t i = 0; i < componentCount; i++)
+   {
+      ColumnSchema schema = {};
+      std::uint16_t fieldCount = 0;
+      bool valid = reader.readU32(schema.stableID) && reader.readU16(schema.schemaVersion) && reader.readU16(fieldCount);
+      schema.fieldSizes.resize(valid ? fieldCount : 0);
+      for (std::uint16_t& fieldSize : schema.fieldSizes)
+      {
+         valid = valid && reader.readU16(fieldSize);
+      }
+      if (!valid || !reader.readU32(schema.rowSize))
+      {
+         KORIN_CORE_WARN("Prefab is truncated.");
+         return false;
+      }
+
+      const ComponentType* type = registry.matchSchema(schema, "Prefab");
+      if (!type)
+      {
+         return false;
+      }
+
+      const std::uint8_t* row = reader.skip(type->rowSize);
+      if (!row)
+      {
+         KORIN_CORE_WARN("Prefab is truncated in its " + type->name + " row.");
+         return false;
+      }
+      components.push_back({static_cast<std::size_t>(type - registry.types().data()), std::vector<std::uint8_t>(row, row + type->rowSize)});
+   }
+
+   m_Components = std::move(components);
+   return true;
+}
+
+std::uint32_t Prefab::applyChanges(EntityAdmin& admin, const Prefab& previous) const
+{
+   const std::vector<ComponentType>& types = ComponentRegistry::instance().types();
+   auto findEntry = [](const std::vector<Entry>& entries, std::size_t typeIndex) -> const Entry*
+   {
+      for (const Entry& entry : entries)
+      {
+         if (entry.typeIndex == typeIndex)
+         {
+            return &entry;
+         }
+      }
+      return nullptr;
+   };
+
+   // Byte ranges of the fields that changed, per component of this version
+   struct Change
+   {
+      const Entry* entry;
+      bool added;
+      std::vector<std::pair<std::size_t, std::size_t>> fields;
+   };
+
+   std::vector<Change> changes;
+   for (const Entry& entry : m_Components)
+   {
+      const Entry* previousEntry = findEntry(previous.m_Components, entry.typeIndex);
+      Change change = {&entry, previousEntry == nullptr, {}};
+      std::size_t offset = 0;
+      for (const std::uint16_t fieldSize : types[entry.typeIndex].fieldSizes)
+      {
+         if (previousEntry && std::memcmp(entry.row.data() + offset, previousEntry->row.data() + offset, fieldSize) != 0)
+         {
+            change.fields.push_back({offset, fieldSize});
+         }
+         offset += fieldSize;
+      }
+
+      if (change.added || !change.fields.empty())
+      {
+         changes.push_back(std::move(change));
+      }
+   }
+
+   std::vector<ComponentTypeID> removed;
+   for (const Entry& entry : previous.m_Components)
+   {
+      if (!findEntry(m_Components, entry.typeIndex))
+      {
+         removed.push_back(types[entry.typeIndex].typeID);
+      }
+   }
+
+   if (changes.empty() && removed.empty())
+   {
+      return 0;
+   }
+
+   std::vector<EntityID> instances;
+   for (const auto& entity : admin.entities())
+   {
+      if (entity.second->getResourceHandle() == previous.handle())
+      {
+         instances.push_back(entity.first);
+      }
+   }
+
+   std::vector<std::uint8_t> row;
+   for (const EntityID entityID : instances)
+   {
+      for (const Change& change : changes)
+      {
+         const ComponentType& type = types[change.entry->typeIndex];
+         ComponentPtr component = admin.findComponent(entityID, type.typeID);
+         if (!component)
+         {
+            // A component the entity lost at run time is only given back if the prefab gained it
+            if (change.added)
+            {
+               component = type.create();
+               Component* target = component.get();
+               type.unpack(&target, 1, change.entry->row.data());
+               admin.addComponent(entityID, component);
+            }
+            continue;
+         }
+
+         Component* target = component.get();
+         row.resize(type.rowSize);
+         type.pack(&target, 1, row.data());
+         for (const auto& field : change.fields)
+         {
+            std::memcpy(row.data() + field.first, change.entry->row.data() + field.first, field.second);
+         }
+         type.unpack(&target, 1, row.data());
+      }
+
+      for (const ComponentTypeID typeID : removed)
+      {
+         if (admin.findComponent(entityID, typeID))
+         {
+            admin.removeComponent(entityID, typeID);
+         }
+      }
+   }
+   return static_cast<std::uint32_t>(instances.size());
+}
+
+PrefabLibrary::PrefabLibrary()
+   : m_Prefabs(std::unordered_map<StringID, Prefab>())
+{
+}
+
+void PrefabLibrary::add(Prefab prefab)
+{
+   const StringID handle = prefab.handle();
+   m_Prefabs[handle] = std::move(prefab);
+}
+
+const Prefab* PrefabLibrary::find(StringID handle) const
+{
+   const auto prefabIt = m_Prefabs.find(handle);
+   return prefabIt == m_Prefabs.end() ? nullptr : &prefabIt->second;
+}
+
+std::size_t PrefabLibrary::load(const PackFile& pack)
+{
+   std::size_t loaded = 0;
+   for (std::uint32_t entry = 0; entry < pack.entries().size(); entry++)
+   {
+      const PackEntry& packEntry = pack.entries()[entry];
+      if (packEntry.type != PackBlobType::Prefab)
+      {
+         continue;
+      }
+
+      Prefab prefab(StringID::intern(packEntry.name));
+      if (prefab.deserialize(pack.data(entry), static_cast<std::size_t>(packEntry.size)))
+      {
+         add(std::move(prefab));
+         loaded++;
+      }
+   }
+   return loaded;
+}
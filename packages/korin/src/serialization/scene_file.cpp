@@ -0,0 +1,393 @@
+// scene_file.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <fstream>
+
+#include "korin/serialization/scene_file.h"
+#include "korin/entity_admin.h"
+#include "korin/util/byte_stream.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+constexpr std::size_t ENTITY_IDS_OFFSET_POSITION = 16;
+constexpr std::size_t HANDLES_OFFSET_POSITION = 20;
+
+// Where the array offsets are within a column's directory entry
+constexpr std::size_t COLUMN_ENTITY_IDS_OFFSET_POSITION = 16;
+constexpr std::size_t COLUMN_ROWS_OFFSET_POSITION = 20;
+
+// Pads the data to the next array and returns where the array starts
+std::uint32_t alignArray(ByteWriter& writer)
+{
+   while (writer.size() % SCENE_ALIGNMENT != 0)
+   {
+      writer.writeU8(0);
+   }
+   return static_cast<std::uint32_t>(writer.size());
+}
+
+void appendHex(std::string& text, const std::uint8_t* bytes, std::size_t size)
+{
+   static const char DIGITS[] = "0123456789abcdef";
+   for (std::size_t i = 0; i < size; i++)
+   {
+      text += DIGITS[bytes[i] >> 4];
+      text += DIGITS[bytes[i] & 0xF];
+   }
+}
+} // namespace
+
+SceneWriter::SceneWriter()
+   : m_Data(std::vector<std::uint8_t>())
+{
+}
+
+void SceneWriter::capture(const EntityAdmin& admin)
+{
+   const ComponentRegistry& registry = ComponentRegistry::instance();
+   const std::vector<ComponentType>& types = registry.types();
+
+   // Entities are written in ID order so the same world always makes the same bytes
+   std::vector<EntityID> entityIDs;
+   std::vector<ComponentColumn> gathered;
+   registry.gather(admin, entityIDs, gathered);
+
+   std::vector<std::size_t> columnTypes;
+   for (std::size_t typeIndex = 0; typeIndex < types.size(); typeIndex++)
+   {
+      if (!gathered[typeIndex].components.empty())
+      {
+         columnTypes.push_back(typeIndex);
+      }
+   }
+
+   m_Data.clear();
+   ByteWriter writer(m_Data);
+   writer.writeU32(SCENE_MAGIC);
+   writer.writeU16(SCENE_VERSION);
+   writer.writeU16(static_cast<std::uint16_t>(columnTypes.size()));
+   writer.writeU32(static_cast<std::uint32_t>(entityIDs.size()));
+   writer.writeU32(admin.nextEntityID());
+   writer.writeU32(0);
+   writer.writeU32(0);
+
+   // The array offsets are patched in once the arrays are written
+   std::vector<std::size_t> directoryPositions;
+   for (const std::size_t typeIndex : columnTypes)
+   {
+      const ComponentType& type = types[typeIndex];
+      directoryPositions.push_back(writer.size());
+      writer.writeU32(type.stableID);
+      writer.writeU16(type.schemaVersion);
+      writer.writeU16(static_cast<std::uint16_t>(type.fieldSizes.size()));
+      writer.writeU32(type.rowSize);
+      writer.writeU32(static_cast<std::uint32_t>(gathered[typeIndex].components.size()));
+      writer.writeU32(0);
+      writer.writeU32(0);
+      for (const std::uint16_t fieldSize : type.fieldSizes)
+      {
+         writer.writeU16(fieldSize);
+      }
+   }
+
+   writer.patchU32(ENTITY_IDS_OFFSET_POSITION, alignArray(writer));
+   for (const EntityID entityID : entityIDs)
+   {
+      writer.writeU32(entityID);
+   }
+   writer.patchU32(HANDLES_OFFSET_POSITION, alignArray(writer));
+   for (const EntityID entityID : entityIDs)
+   {
+      writer.writeU32(admin.entities().at(entityID)->getResourceHandle().value());
+   }
+
+   for (std::size_t column = 0; column < columnTypes.size(); column++)
+   {
+      const std::size_t typeIndex = columnTypes[column];
+      const ComponentColumn& rows = gathered[typeIndex];
+      writer.patchU32(directoryPositions[column] + COLUMN_ENTITY_IDS_OFFSET_POSITION, alignArray(writer));
+      for (const EntityID entityID : rows.entityIDs)
+      {
+         writer.writeU32(entityID);
+      }
+
+      // The rows are packed straight into the buffer
+      const std::uint32_t rowsOffset = alignArray(writer);
+      writer.patchU32(directoryPositions[column] + COLUMN_ROWS_OFFSET_POSITION, rowsOffset);
+      m_Data.resize(rowsOffset + rows.components.size() * types[typeIndex].rowSize);
+      types[typeIndex].pack(rows.components.data(), rows.components.size(), m_Data.data() + rowsOffset);
+   }
+}
+
+bool SceneWriter::write(const std::string& path) const
+{
+   std::ofstream file(path, std::ios::binary | std::ios::trunc);
+   if (!file)
+   {
+      KORIN_CORE_WARN("Could not open " + path + " to write the scene.");
+      return false;
+   }
+
+   file.write(reinterpret_cast<const char*>(m_Data.data()), static_cast<std::streamsize>(m_Data.size()));
+   return static_cast<bool>(file);
+}
+
+SceneFile::SceneFile()
+   : m_File(), m_Data(nullptr), m_Columns(std::vector<Column>())
+   , m_EntityCount(0), m_NextEntityID(0), m_EntityIDs(nullptr), m_Handles(nullptr)
+{
+}
+
+bool SceneFile::open(const std::string& path)
+{
+   close();
+   if (!m_File.open(path))
+   {
+      return false;
+   }
+
+   if (!parse(m_File.data(), m_File.size()))
+   {
+      KORIN_CORE_WARN("Scene " + path + " is invalid.");
+      close();
+      return false;
+   }
+   return true;
+}
+
+bool SceneFile::open(const std::uint8_t* data, std::size_t size)
+{
+   close();
+   if (!data || reinterpret_cast<std::uintptr_t>(data) % SCENE_ALIGNMENT != 0)
+   {
+      KORIN_CORE_WARN("Scene data has to start on a multiple of " + std::to_string(SCENE_ALIGNMENT) + " bytes.");
+      return false;
+   }
+   return parse(data, size);
+}
+
+void SceneFile::close()
+{
+   m_File.close();
+   m_Data = nullptr;
+   m_Columns.clear();
+   m_EntityCount = 0;
+   m_NextEntityID = 0;
+   m_EntityIDs = nullptr;
+   m_Handles = nullptr;
+}
+
+bool SceneFile::load(EntityAdmin& admin) const
+{
+   if (!m_Data)
+   {
+      KORIN_CORE_WARN("Cannot load a scene that isn't open.");
+      return false;
+   }
+
+   admin.clear();
+   admin.m_Entities.reserve(m_EntityCount);
+   admin.m_ComponentsByEntity.reserve(m_EntityCount);
+   for (std::uint32_t i = 0; i < m_EntityCount; i++)
+   {
+      admin.insertEntity(std::make_shared<Entity>(m_EntityIDs[i], StringID::fromValue(m_Handles[i])));
+   }
+
+   // Each column is created as one block and filled straight from the mapping
+   const std::vector<ComponentType>& types = ComponentRegistry::instance().types();
+   std::vector<ComponentPtr> created;
+   std::vector<Component*> targets;
+   for (const Column& column : m_Columns)
+   {
+      const ComponentType& type = types[column.typeIndex];
+      created.assign(column.rowCount, ComponentPtr());
+      targets.resize(column.rowCount);
+      type.createBlock(column.rowCount, created.data());
+      for (std::uint32_t row = 0; row < column.rowCount; row++)
+      {
+         targets[row] = created[row].get();
+      }
+      type.unpack(targets.data(), column.rowCount, column.rows);
+
+      admin.m_ComponentsByType[type.typeID].reserve(column.rowCount);
+      for (std::uint32_t row = 0; row < column.rowCount; row++)
+      {
+         if (admin.m_Entities.find(column.entityIDs[row]) != admin.m_Entities.end())
+         {
+            admin.attachComponent(column.entityIDs[row], created[row]);
+         }
+      }
+   }
+
+   admin.setNextEntityID(m_NextEntityID);
+   admin.notifyWorldRestored();
+   return true;
+}
+
+std::string SceneFile::exportText() const
+{
+   std::string text;
+   if (!m_Data)
+   {
+      return text;
+   }
+
+   text += "scene " + std::to_string(SCENE_VERSION) + "\n";
+   text += "next " + std::to_string(m_NextEntityID) + "\n";
+   for (std::uint32_t i = 0; i < m_EntityCount; i++)
+   {
+      // Handles that were never interned are written as their hash
+      const StringID handle = StringID::fromValue(m_Handles[i]);
+      text += "entity " + std::to_string(m_EntityIDs[i]) + " ";
+      if (handle.str().empty())
+      {
+         const std::uint32_t value = handle.value();
+         const std::uint8_t bytes[4] = {static_cast<std::uint8_t>(value >> 24), static_cast<std::uint8_t>(value >> 16),
+            static_cast<std::uint8_t>(value >> 8), static_cast<std::uint8_t>(value)};
+         text += "#";
+         appendHex(text, bytes, sizeof(bytes));
+      }
+      else
+      {
+         text += handle.str();
+      }
+      text += "\n";
+   }
+
+   const std::vector<ComponentType>& types = ComponentRegistry::instance().types();
+   for (const Column& column : m_Columns)
+   {
+      const ComponentType& type = types[column.typeIndex];
+      text += "column " + type.name + " " + std::to_string(type.schemaVersion) + "\n";
+      for (std::uint32_t row = 0; row < column.rowCount; row++)
+      {
+         text += "   " + std::to_string(column.entityIDs[row]);
+         const std::uint8_t* field = column.rows + static_cast<std::size_t>(row) * type.rowSize;
+         for (const std::uint16_t fieldSize : type.fieldSizes)
+         {
+            text += " ";
+            appendHex(text, field, fieldSize);
+            field += fieldSize;
+         }
+         text += "\n";
+      }
+   }
+   return text;
+}
+
+bool SceneFile::parse(const std::uint8_t* data, std::size_t size)
+{
+   ByteReader reader(data, size);
+   std::uint32_t magic = 0, entityCount = 0, nextEntityID = 0, entityIDsOffset = 0, handlesOffset = 0;
+   std::uint16_t version = 0, columnCount = 0;
+   if (!reader.readU32(magic) || !reader.readU16(version) || !reader.readU16(columnCount)
+      || !reader.readU32(entityCount) || !reader.readU32(nextEntityID)
+      || !reader.readU32(entityIDsOffset) || !reader.readU32(handlesOffset)
+      || magic != SCENE_MAGIC)
+   {
+      KORIN_CORE_WARN("Scene header is invalid.");
+      return false;
+   }
+
+   if (version != SCENE_VERSION)
+   {
+      KORIN_CORE_WARN("Scene version(" + std::to_string(version) + ") is not supported.");
+      return false;
+   }
+
+   if (entityCount > EntityAdmin::MAX_ENTITIES)
+   {
+      KORIN_CORE_WARN("Scene has more than " + std::to_string(EntityAdmin::MAX_ENTITIES) + " entities.");
+      return false;
+   }
+
+   // Arrays are read in place, so they have to be aligned and inside the data
+   auto arrayFits = [size](std::uint32_t offset, std::size_t arraySize)
+   {
+      return offset % SCENE_ALIGNMENT == 0 && offset <= size && arraySize <= size - offset;
+   };
+
+   if (!arrayFits(entityIDsOffset, static_cast<std::size_t>(entityCount) * 4)
+      || !arrayFits(handlesOffset, static_cast<std::size_t>(entityCount) * 4))
+   {
+      KORIN_CORE_WARN("Scene is truncated in its entities.");
+      return false;
+   }
+
+   // IDs are written in ascending order, which also keeps them unique. Every one has to be
+   // below the next ID the world hands out, or a new entity would collide with a loaded one.
+   auto idsValid = [nextEntityID](const EntityID* entityIDs, std::uint32_t count)
+   {
+      for (std::uint32_t i = 0; i < count; i++)
+      {
+         if (entityIDs[i] == INVALID_ENTITY_ID || entityIDs[i] >= nextEntityID || (i > 0 && entityIDs[i] <= entityIDs[i - 1]))
+         {
+            return false;
+         }
+      }
+      return true;
+   };
+
+   if (!idsValid(reinterpret_cast<const EntityID*>(data + entityIDsOffset), entityCount))
+   {
+      KORIN_CORE_WARN("Scene has invalid, repeated or out of order entity IDs.");
+      return false;
+   }
+
+   const ComponentRegistry& registry = ComponentRegistry::instance();
+   std::vector<Column> columns;
+   for (std::uint16_t i = 0; i < columnCount; i++)
+   {
+      ColumnSchema schema = {};
+      std::uint32_t rowCount = 0, rowEntityIDsOffset = 0, rowsOffset = 0;
+      std::uint16_t fieldCount = 0;
+      bool valid = reader.readU32(schema.stableID) && reader.readU16(schema.schemaVersion) && reader.readU16(fieldCount)
+         && reader.readU32(schema.rowSize) && reader.readU32(rowCount)
+         && reader.readU32(rowEntityIDsOffset) && reader.readU32(rowsOffset);
+      schema.fieldSizes.resize(valid ? fieldCount : 0);
+      for (std::uint16_t& fieldSize : schema.fieldSizes)
+      {
+         valid = valid && reader.readU16(fieldSize);
+      }
+      if (!valid)
+      {
+         KORIN_CORE_WARN("Scene is truncated in its columns.");
+         return false;
+      }
+
+      const ComponentType* type = registry.matchSchema(schema, "Scene");
+      if (!type)
+      {
+         return false;
+      }
+
+      if (!arrayFits(rowEntityIDsOffset, static_cast<std::size_t>(rowCount) * 4)
+         || !arrayFits(rowsOffset, static_cast<std::size_t>(rowCount) * type->rowSize))
+      {
+         KORIN_CORE_WARN("Scene is truncated in the " + type->name + " column.");
+         return false;
+      }
+
+      const EntityID* rowEntityIDs = reinterpret_cast<const EntityID*>(data + rowEntityIDsOffset);
+      if (!idsValid(rowEntityIDs, rowCount))
+      {
+         KORIN_CORE_WARN("Scene has invalid, repeated or out of order entity IDs in the " + type->name + " column.");
+         return false;
+      }
+
+      columns.push_back({static_cast<std::size_t>(type - registry.types().data()), rowCount, rowEntityIDs, data + rowsOffset});
+   }
+
+   m_Data = data;
+   m_Columns = std::move(columns);
+   m_EntityCount = entityCount;
+   m_NextEntityID = nextEntityID;
+   m_EntityIDs = reinterpret_cast<const EntityID*>(data + entityIDsOffset);
+   m_Handles = reinterpret_cast<const std::uint32_t*>(data + handlesOffset);
+   return true;
+}
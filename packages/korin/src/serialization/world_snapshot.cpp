@@ -0,0 +1,333 @@
+// world_snapshot.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include "korin/serialization/world_snapshot.h"
+#include "korin/entity_admin.h"
+#include "korin/util/byte_stream.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+WorldSnapshot::WorldSnapshot()
+   : m_Data(std::vector<std::uint8_t>()), m_Columns(std::vector<Column>())
+   , m_EntityCount(0), m_RowCount(0), m_NextEntityID(0), m_EntitiesOffset(0)
+   , m_EntityIDs(std::vector<EntityID>()), m_Gathered(std::vector<ComponentColumn>())
+   , m_Components(std::vector<Component*>()), m_LastRestoreInPlace(false)
+{
+}
+
+void WorldSnapshot::capture(const EntityAdmin& admin)
+{
+   const ComponentRegistry& registry = ComponentRegistry::instance();
+   const std::vector<ComponentType>& types = registry.types();
+
+   // Entities are written in ID order so the same world always makes the same bytes
+   registry.gather(admin, m_EntityIDs, m_Gathered);
+
+   std::uint32_t columnCount = 0;
+   for (const ComponentColumn& gathered : m_Gathered)
+   {
+      columnCount += gathered.components.empty() ? 0 : 1;
+   }
+
+   m_Data.clear();
+   ByteWriter writer(m_Data);
+   writer.writeU32(WORLD_SNAPSHOT_MAGIC);
+   writer.writeU16(WORLD_SNAPSHOT_VERSION);
+   writer.writeU16(0);
+   writer.writeU32(static_cast<std::uint32_t>(m_EntityIDs.size()));
+   writer.writeU32(columnCount);
+   writer.writeU32(admin.nextEntityID());
+
+   for (const EntityID entityID : m_EntityIDs)
+   {
+      writer.writeU32(entityID);
+      writer.writeU32(admin.entities().at(entityID)->getResourceHandle().value());
+   }
+
+   for (std::size_t typeIndex = 0; typeIndex < types.size(); typeIndex++)
+   {
+      const ComponentColumn& gathered = m_Gathered[typeIndex];
+      if (gathered.components.empty())
+      {
+         continue;
+      }
+
+      const ComponentType& type = types[typeIndex];
+      writer.writeU32(type.stableID);
+      writer.writeU16(type.schemaVersion);
+      writer.writeU16(static_cast<std::uint16_t>(type.fieldSizes.size()));
+      for (const std::uint16_t fieldSize : type.fieldSizes)
+      {
+         writer.writeU16(fieldSize);
+      }
+      writer.writeU32(type.rowSize);
+      writer.writeU32(static_cast<std::uint32_t>(gathered.components.size()));
+      for (const EntityID entityID : gathered.entityIDs)
+      {
+         writer.writeU32(entityID);
+      }
+
+      // The rows are packed straight into the buffer
+      const std::size_t rowsOffset = m_Data.size();
+      m_Data.resize(rowsOffset + gathered.components.size() * type.rowSize);
+      type.pack(gathered.components.data(), gathered.components.size(), m_Data.data() + rowsOffset);
+   }
+
+   parse(m_Data);
+}
+
+bool WorldSnapshot::restore(EntityAdmin& admin) const
+{
+   if (m_Data.empty())
+   {
+      KORIN_CORE_WARN("Cannot restore an empty WorldSnapshot.");
+      return false;
+   }
+
+   m_LastRestoreInPlace = gatherExisting(admin);
+   if (m_LastRestoreInPlace)
+   {
+      std::size_t first = 0;
+      for (const Column& column : m_Columns)
+      {
+         columnType(column).unpack(m_Components.data() + first, column.rowCount, m_Data.data() + column.rowsOffset);
+         first += column.rowCount;
+      }
+   }
+   else
+   {
+      rebuild(admin);
+   }
+
+   admin.setNextEntityID(m_NextEntityID);
+   admin.notifyWorldRestored();
+   return true;
+}
+
+bool WorldSnapshot::load(std::vector<std::uint8_t> data)
+{
+   if (!parse(data))
+   {
+      return false;
+   }
+
+   m_Data = std::move(data);
+   return true;
+}
+
+bool WorldSnapshot::loadFromFile(const std::string& path)
+{
+   std::ifstream file(path, std::ios::binary);
+   if (!file)
+   {
+      KORIN_CORE_WARN("Could not open world snapshot " + path);
+      return false;
+   }
+
+   return load(std::vector<std::uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+}
+
+bool WorldSnapshot::saveToFile(const std::string& path) const
+{
+   std::ofstream file(path, std::ios::binary | std::ios::trunc);
+   if (!file)
+   {
+      KORIN_CORE_WARN("Could not open " + path + " to save the world snapshot.");
+      return false;
+   }
+
+   file.write(reinterpret_cast<const char*>(m_Data.data()), static_cast<std::streamsize>(m_Data.size()));
+   return static_cast<bool>(file);
+}
+
+bool WorldSnapshot::parse(const std::vector<std::uint8_t>& data)
+{
+   ByteReader reader(data);
+   std::uint32_t magic = 0, entityCount = 0, columnCount = 0, nextEntityID = 0;
+   std::uint16_t version = 0, reserved = 0;
+   if (!reader.readU32(magic) || !reader.readU16(version) || !reader.readU16(reserved)
+      || !reader.readU32(entityCount) || !reader.readU32(columnCount) || !reader.readU32(nextEntityID)
+      || magic != WORLD_SNAPSHOT_MAGIC)
+   {
+      KORIN_CORE_WARN("World snapshot header is invalid.");
+      return false;
+   }
+
+   if (version != WORLD_SNAPSHOT_VERSION)
+   {
+      KORIN_CORE_WARN("World snapshot version(" + std::to_string(version) + ") is not supported.");
+      return false;
+   }
+
+   if (entityCount > EntityAdmin::MAX_ENTITIES)
+   {
+      KORIN_CORE_WARN("World snapshot has more than " + std::to_string(EntityAdmin::MAX_ENTITIES) + " entities.");
+      return false;
+   }
+
+   const std::size_t entitiesOffset = reader.position();
+   for (std::uint32_t i = 0; i < entityCount; i++)
+   {
+      std::uint32_t entityID = 0, handle = 0;
+      if (!reader.readU32(entityID) || !reader.readU32(handle))
+      {
+         KORIN_CORE_WARN("World snapshot is truncated in its entities.");
+         return false;
+      }
+   }
+
+   const ComponentRegistry& registry = ComponentRegistry::instance();
+   std::vector<Column> columns;
+   std::uint32_t rowTotal = 0;
+   for (std::uint32_t i = 0; i < columnCount; i++)
+   {
+      ColumnSchema schema = {};
+      std::uint32_t rowCount = 0;
+      std::uint16_t fieldCount = 0;
+      bool valid = reader.readU32(schema.stableID) && reader.readU16(schema.schemaVersion) && reader.readU16(fieldCount);
+      schema.fieldSizes.resize(valid ? fieldCount : 0);
+      for (std::uint16_t& fieldSize : schema.fieldSizes)
+      {
+         valid = valid && reader.readU16(fieldSize);
+      }
+      if (!valid || !reader.readU32(schema.rowSize) || !reader.readU32(rowCount))
+      {
+         KORIN_CORE_WARN("World snapshot is truncated in its columns.");
+         return false;
+      }
+
+      const ComponentType* type = registry.matchSchema(schema, "World snapshot");
+      if (!type)
+      {
+         return false;
+      }
+
+      Column column = {static_cast<std::size_t>(type - registry.types().data()), rowCount, reader.position(), 0};
+      if (!reader.skip(static_cast<std::size_t>(rowCount) * 4))
+      {
+         KORIN_CORE_WARN("World snapshot is truncated in the " + type->name + " column.");
+         return false;
+      }
+      column.rowsOffset = reader.position();
+      if (!reader.skip(static_cast<std::size_t>(rowCount) * type->rowSize))
+      {
+         KORIN_CORE_WARN("World snapshot is truncated in the " + type->name + " column.");
+         return false;
+      }
+
+      columns.push_back(column);
+      rowTotal += rowCount;
+   }
+
+   m_Columns = std::move(columns);
+   m_EntitiesOffset = entitiesOffset;
+   m_EntityCount = entityCount;
+   m_RowCount = rowTotal;
+   m_NextEntityID = nextEntityID;
+   return true;
+}
+
+EntityID WorldSnapshot::rowEntityID(const Column& column, std::uint32_t row) const
+{
+   const std::uint8_t* bytes = m_Data.data() + column.entityIDsOffset + static_cast<std::size_t>(row) * 4;
+   return static_cast<EntityID>(bytes[0]) | static_cast<EntityID>(bytes[1]) << 8
+      | static_cast<EntityID>(bytes[2]) << 16 | static_cast<EntityID>(bytes[3]) << 24;
+}
+
+const ComponentType& WorldSnapshot::columnType(const Column& column)
+{
+   return ComponentRegistry::instance().types()[column.typeIndex];
+}
+
+bool WorldSnapshot::gatherExisting(const EntityAdmin& admin) const
+{
+   if (admin.entityCount() != m_EntityCount)
+   {
+      return false;
+   }
+
+   ByteReader reader(m_Data.data() + m_EntitiesOffset, m_Data.size() - m_EntitiesOffset);
+   for (std::uint32_t i = 0; i < m_EntityCount; i++)
+   {
+      std::uint32_t entityID = 0, handle = 0;
+      reader.readU32(entityID);
+      reader.readU32(handle);
+      if (admin.entities().find(entityID) == admin.entities().end())
+      {
+         return false;
+      }
+   }
+
+   // Components added since the capture would survive an in place restore
+   const ComponentRegistry& registry = ComponentRegistry::instance();
+   std::uint32_t registeredComponents = 0;
+   for (const auto& entity : admin.entities())
+   {
+      for (const auto& component : admin.components(entity.first))
+      {
+         registeredComponents += registry.find(component->typeID()) ? 1 : 0;
+      }
+   }
+   if (registeredComponents != m_RowCount)
+   {
+      return false;
+   }
+
+   m_Components.clear();
+   for (const Column& column : m_Columns)
+   {
+      for (std::uint32_t row = 0; row < column.rowCount; row++)
+      {
+         const ComponentPtr component = admin.findComponent(rowEntityID(column, row), columnType(column).typeID);
+         if (!component)
+         {
+            return false;
+         }
+         m_Components.push_back(component.get());
+      }
+   }
+   return true;
+}
+
+void WorldSnapshot::rebuild(EntityAdmin& admin) const
+{
+   admin.clear();
+
+   ByteReader reader(m_Data.data() + m_EntitiesOffset, m_Data.size() - m_EntitiesOffset);
+   for (std::uint32_t i = 0; i < m_EntityCount; i++)
+   {
+      std::uint32_t entityID = 0, handle = 0;
+      reader.readU32(entityID);
+      reader.readU32(handle);
+      admin.insertEntity(std::make_shared<Entity>(entityID, StringID::fromValue(handle)));
+   }
+
+   std::vector<ComponentPtr> created;
+   for (const Column& column : m_Columns)
+   {
+      created.clear();
+      m_Components.clear();
+      for (std::uint32_t row = 0; row < column.rowCount; row++)
+      {
+         created.push_back(columnType(column).create());
+         m_Components.push_back(created.back().get());
+      }
+
+      columnType(column).unpack(m_Components.data(), column.rowCount, m_Data.data() + column.rowsOffset);
+      for (std::uint32_t row = 0; row < column.rowCount; row++)
+      {
+         const EntityID entityID = rowEntityID(column, row);
+         if (admin.entities().find(entityID) != admin.entities().end())
+         {
+            admin.attachComponent(entityID, created[row]);
+         }
+      }
+   }
+}
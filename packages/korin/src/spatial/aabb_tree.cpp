@@ -0,0 +1,668 @@
+// aabb_tree.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "korin/spatial/aabb_tree.h"
+#include "korin/math/aabb4.h"
+#include "korin/util/bit_util.h"
+#include "korin/log.h"
+#include "korin/util/assert.h"
+
+using namespace korin;
+
+AABBTree::AABBTree(float fatMargin, float displacementMultiplier)
+   : m_FatMargin(fatMargin), m_DisplacementMultiplier(displacementMultiplier)
+   , m_Nodes(std::vector<Node>()), m_Root(NULL_PROXY), m_FreeList(NULL_PROXY), m_ProxyCount(0)
+   , m_Stack(std::vector<ProxyID>())
+{
+}
+
+ProxyID AABBTree::createProxy(EntityID entityID, const AABB& bounds)
+{
+   const ProxyID proxyID = allocateNode();
+   Node& node = m_Nodes[proxyID];
+   node.fatBounds = bounds.expanded(m_FatMargin);
+   node.bounds = bounds;
+   node.entityID = entityID;
+   node.height = 0;
+
+   insertLeaf(proxyID);
+   m_ProxyCount++;
+   return proxyID;
+}
+
+void AABBTree::destroyProxy(ProxyID proxyID)
+{
+   if (!isValidProxy(proxyID))
+   {
+      KORIN_CORE_WARN("ProxyID(" + std::to_string(proxyID) + ") does not exist in the AABBTree for removal.");
+      return;
+   }
+
+   removeLeaf(proxyID);
+   freeNode(proxyID);
+   m_ProxyCount--;
+}
+
+bool AABBTree::moveProxy(ProxyID proxyID, const AABB& bounds, const Vector2D& displacement)
+{
+   if (!isValidProxy(proxyID))
+   {
+      KORIN_CORE_WARN("ProxyID(" + std::to_string(proxyID) + ") does not exist in the AABBTree to move.");
+      return false;
+   }
+
+   Node& node = m_Nodes[proxyID];
+   node.bounds = bounds;
+
+   // Predict where the entity is heading so the new fat bounds last longer
+   AABB fatBounds = bounds.expanded(m_FatMargin);
+   const Vector2D predicted = displacement * m_DisplacementMultiplier;
+   (predicted.x < 0.0f ? fatBounds.minX : fatBounds.maxX) += predicted.x;
+   (predicted.y < 0.0f ? fatBounds.minY : fatBounds.maxY) += predicted.y;
+
+   const AABB& treeBounds = node.fatBounds;
+   if (treeBounds.contains(bounds))
+   {
+      // The leaf still encloses the entity. Only re-insert it if the leaf has grown far
+      // larger than it needs to be, which would otherwise produce needless overlaps.
+      const AABB hugeBounds = fatBounds.expanded(4.0f * m_FatMargin);
+      if (hugeBounds.contains(treeBounds))
+      {
+         return false;
+      }
+   }
+
+   removeLeaf(proxyID);
+   m_Nodes[proxyID].fatBounds = fatBounds;
+   insertLeaf(proxyID);
+   return true;
+}
+
+void AABBTree::clear()
+{
+   m_Nodes.clear();
+   m_Root = NULL_PROXY;
+   m_FreeList = NULL_PROXY;
+   m_ProxyCount = 0;
+}
+
+EntityID AABBTree::entityID(ProxyID proxyID) const
+{
+   KORIN_ASSERT(isValidProxy(proxyID));
+   return m_Nodes[proxyID].entityID;
+}
+
+const AABB& AABBTree::fatBounds(ProxyID proxyID) const
+{
+   KORIN_ASSERT(isValidProxy(proxyID));
+   return m_Nodes[proxyID].fatBounds;
+}
+
+const AABB& AABBTree::bounds(ProxyID proxyID) const
+{
+   KORIN_ASSERT(isValidProxy(proxyID));
+   return m_Nodes[proxyID].bounds;
+}
+
+void AABBTree::query(const AABB& region, std::vector<EntityID>& results) const
+{
+   if (m_Root == NULL_PROXY)
+   {
+      return;
+   }
+
+   m_Stack.clear();
+   m_Stack.push_back(m_Root);
+
+   AABB4 boxes;
+   ProxyID batch[4];
+   while (!m_Stack.empty())
+   {
+      // Pop up to four nodes and test all of their fat bounds at once
+      const int count = static_cast<int>(std::min<std::size_t>(4, m_Stack.size()));
+      for (int lane = 0; lane < count; lane++)
+      {
+         batch[lane] = m_Stack.back();
+         m_Stack.pop_back();
+         boxes.set(lane, m_Nodes[batch[lane]].fatBounds);
+      }
+
+      std::uint32_t hits = overlapMask(boxes, region) & ((1u << count) - 1);
+      while (hits)
+      {
+         const int lane = countTrailingZeros(hits);
+         hits &= hits - 1;
+
+         const Node& node = m_Nodes[batch[lane]];
+         if (node.isLeaf())
+         {
+            if (node.bounds.intersects(region))
+            {
+               results.push_back(node.entityID);
+            }
+         }
+         else
+         {
+            m_Stack.push_back(node.child1);
+            m_Stack.push_back(node.child2);
+         }
+      }
+   }
+}
+
+bool AABBTree::raycast(const Vector2D& start, const Vector2D& end, RaycastHit& hit) const
+{
+   if (m_Root == NULL_PROXY)
+   {
+      return false;
+   }
+
+   const Vector2D inverse = inverseDirection(start, end);
+   float maxFraction = 1.0f;
+   bool didHit = false;
+
+   m_Stack.clear();
+   m_Stack.push_back(m_Root);
+
+   AABB4 boxes;
+   ProxyID batch[4];
+   while (!m_Stack.empty())
+   {
+      const int count = static_cast<int>(std::min<std::size_t>(4, m_Stack.size()));
+      for (int lane = 0; lane < count; lane++)
+      {
+         batch[lane] = m_Stack.back();
+         m_Stack.pop_back();
+         boxes.set(lane, m_Nodes[batch[lane]].fatBounds);
+      }
+
+      // Nodes farther than the closest hit so far are culled by the shrinking max fraction
+      std::uint32_t hits = raycastMask(boxes, start, inverse, maxFraction) & ((1u << count) - 1);
+      while (hits)
+      {
+         const int lane = countTrailingZeros(hits);
+         hits &= hits - 1;
+
+         const Node& node = m_Nodes[batch[lane]];
+         if (!node.isLeaf())
+         {
+            m_Stack.push_back(node.child1);
+            m_Stack.push_back(node.child2);
+            continue;
+         }
+
+         float fraction;
+         Vector2D normal;
+         if (raycastBounds(node.bounds, start, inverse, maxFraction, fraction, normal))
+         {
+            maxFraction = fraction;
+            hit.entityID = node.entityID;
+            hit.fraction = fraction;
+            hit.point = Vector2D::lerp(start, end, fraction);
+            hit.normal = normal;
+            didHit = true;
+         }
+      }
+   }
+
+   return didHit;
+}
+
+void AABBTree::raycastAll(const Vector2D& start, const Vector2D& end, std::vector<RaycastHit>& hits) const
+{
+   if (m_Root == NULL_PROXY)
+   {
+      return;
+   }
+
+   const Vector2D inverse = inverseDirection(start, end);
+
+   m_Stack.clear();
+   m_Stack.push_back(m_Root);
+
+   AABB4 boxes;
+   ProxyID batch[4];
+   while (!m_Stack.empty())
+   {
+      const int count = static_cast<int>(std::min<std::size_t>(4, m_Stack.size()));
+      for (int lane = 0; lane < count; lane++)
+      {
+         batch[lane] = m_Stack.back();
+         m_Stack.pop_back();
+         boxes.set(lane, m_Nodes[batch[lane]].fatBounds);
+      }
+
+      std::uint32_t laneHits = raycastMask(boxes, start, inverse, 1.0f) & ((1u << count) - 1);
+      while (laneHits)
+      {
+         const int lane = countTrailingZeros(laneHits);
+         laneHits &= laneHits - 1;
+
+         const Node& node = m_Nodes[batch[lane]];
+         if (!node.isLeaf())
+         {
+            m_Stack.push_back(node.child1);
+            m_Stack.push_back(node.child2);
+            continue;
+         }
+
+         float fraction;
+         Vector2D normal;
+         if (raycastBounds(node.bounds, start, inverse, 1.0f, fraction, normal))
+         {
+            hits.push_back({node.entityID, fraction, Vector2D::lerp(start, end, fraction), normal});
+         }
+      }
+   }
+}
+
+std::int32_t AABBTree::height() const
+{
+   return m_Root == NULL_PROXY ? -1 : m_Nodes[m_Root].height;
+}
+
+std::int32_t AABBTree::maxBalance() const
+{
+   std::int32_t maxBalance = 0;
+   for (const Node& node : m_Nodes)
+   {
+      if (node.height <= 1)
+      {
+         continue;
+      }
+
+      const std::int32_t balance = std::abs(m_Nodes[node.child2].height - m_Nodes[node.child1].height);
+      maxBalance = std::max(maxBalance, balance);
+   }
+
+   return maxBalance;
+}
+
+float AABBTree::areaRatio() const
+{
+   if (m_Root == NULL_PROXY)
+   {
+      return 0.0f;
+   }
+
+   float totalPerimeter = 0.0f;
+   for (const Node& node : m_Nodes)
+   {
+      if (node.height >= 0)
+      {
+         totalPerimeter += node.fatBounds.perimeter();
+      }
+   }
+
+   return totalPerimeter / m_Nodes[m_Root].fatBounds.perimeter();
+}
+
+void AABBTree::validate() const
+{
+   if (m_Root != NULL_PROXY)
+   {
+      KORIN_ASSERT(m_Nodes[m_Root].parent == NULL_PROXY);
+      validateNode(m_Root);
+   }
+
+   std::size_t freeCount = 0;
+   for (ProxyID freeID = m_FreeList; freeID != NULL_PROXY; freeID = m_Nodes[freeID].parent)
+   {
+      KORIN_ASSERT(m_Nodes[freeID].height == -1);
+      freeCount++;
+   }
+
+   // A tree with n leaves always has n - 1 branches
+   const std::size_t usedCount = m_ProxyCount == 0 ? 0 : 2 * m_ProxyCount - 1;
+   KORIN_ASSERT(usedCount + freeCount == m_Nodes.size());
+}
+
+ProxyID AABBTree::allocateNode()
+{
+   if (m_FreeList == NULL_PROXY)
+   {
+      m_Nodes.push_back({AABB(0.0f, 0.0f, 0.0f, 0.0f), AABB(0.0f, 0.0f, 0.0f, 0.0f),
+         NULL_PROXY, NULL_PROXY, NULL_PROXY, -1, INVALID_ENTITY_ID});
+      m_FreeList = static_cast<ProxyID>(m_Nodes.size() - 1);
+   }
+
+   const ProxyID nodeID = m_FreeList;
+   Node& node = m_Nodes[nodeID];
+   m_FreeList = node.parent;
+
+   node.parent = NULL_PROXY;
+   node.child1 = NULL_PROXY;
+   node.child2 = NULL_PROXY;
+   node.height = 0;
+   node.entityID = INVALID_ENTITY_ID;
+   return nodeID;
+}
+
+void AABBTree::freeNode(ProxyID nodeID)
+{
+   Node& node = m_Nodes[nodeID];
+   node.parent = m_FreeList;
+   node.height = -1;
+   m_FreeList = nodeID;
+}
+
+void AABBTree::insertLeaf(ProxyID leafID)
+{
+   if (m_Root == NULL_PROXY)
+   {
+      m_Root = leafID;
+      m_Nodes[leafID].parent = NULL_PROXY;
+      return;
+   }
+
+   // Descend towards the sibling that grows the total perimeter of the tree the least
+   const AABB leafBounds = m_Nodes[leafID].fatBounds;
+   ProxyID index = m_Root;
+   while (!m_Nodes[index].isLeaf())
+   {
+      const Node& node = m_Nodes[index];
+      const float perimeter = node.fatBounds.perimeter();
+      const float combinedPerimeter = AABB::combine(node.fatBounds, leafBounds).perimeter();
+
+      // Cost of creating a new parent for this node and the new leaf
+      const float cost = 2.0f * combinedPerimeter;
+
+      // Minimum cost of pushing the leaf further down the tree
+      const float inheritanceCost = 2.0f * (combinedPerimeter - perimeter);
+
+      auto descendCost = [&](ProxyID childID)
+      {
+         const Node& child = m_Nodes[childID];
+         const float grownPerimeter = AABB::combine(leafBounds, child.fatBounds).perimeter();
+         return child.isLeaf()
+            ? grownPerimeter + inheritanceCost
+            : grownPerimeter - child.fatBounds.perimeter() + inheritanceCost;
+      };
+
+      const float cost1 = descendCost(node.child1);
+      const float cost2 = descendCost(node.child2);
+      if (cost < cost1 && cost < cost2)
+      {
+         break;
+      }
+
+      index = cost1 < cost2 ? node.child1 : node.child2;
+   }
+
+   const ProxyID siblingID = index;
+
+   // allocateNode can grow the node pool so no references are held across it
+   const ProxyID newParentID = allocateNode();
+   const ProxyID oldParentID = m_Nodes[siblingID].parent;
+
+   Node& newParent = m_Nodes[newParentID];
+   newParent.parent = oldParentID;
+   newParent.fatBounds = AABB::combine(leafBounds, m_Nodes[siblingID].fatBounds);
+   newParent.height = m_Nodes[siblingID].height + 1;
+   newParent.child1 = siblingID;
+   newParent.child2 = leafID;
+
+   if (oldParentID != NULL_PROXY)
+   {
+      Node& oldParent = m_Nodes[oldParentID];
+      (oldParent.child1 == siblingID ? oldParent.child1 : oldParent.child2) = newParentID;
+   }
+   else
+   {
+      m_Root = newParentID;
+   }
+
+   m_Nodes[siblingID].parent = newParentID;
+   m_Nodes[leafID].parent = newParentID;
+
+   refitAncestors(newParentID);
+}
+
+void AABBTree::removeLeaf(ProxyID leafID)
+{
+   if (leafID == m_Root)
+   {
+      m_Root = NULL_PROXY;
+      return;
+   }
+
+   const ProxyID parentID = m_Nodes[leafID].parent;
+   const ProxyID grandParentID = m_Nodes[parentID].parent;
+   const ProxyID siblingID = m_Nodes[parentID].child1 == leafID ? m_Nodes[parentID].child2 : m_Nodes[parentID].child1;
+
+   // The sibling takes the place of the parent
+   m_Nodes[siblingID].parent = grandParentID;
+   freeNode(parentID);
+
+   if (grandParentID == NULL_PROXY)
+   {
+      m_Root = siblingID;
+      return;
+   }
+
+   Node& grandParent = m_Nodes[grandParentID];
+   (grandParent.child1 == parentID ? grandParent.child1 : grandParent.child2) = siblingID;
+   refitAncestors(grandParentID);
+}
+
+void AABBTree::refitAncestors(ProxyID nodeID)
+{
+   while (nodeID != NULL_PROXY)
+   {
+      nodeID = balance(nodeID);
+
+      Node& node = m_Nodes[nodeID];
+      const Node& child1 = m_Nodes[node.child1];
+      const Node& child2 = m_Nodes[node.child2];
+      node.height = 1 + std::max(child1.height, child2.height);
+      node.fatBounds = AABB::combine(child1.fatBounds, child2.fatBounds);
+
+      nodeID = node.parent;
+   }
+}
+
+ProxyID AABBTree::balance(ProxyID idA)
+{
+   Node& a = m_Nodes[idA];
+   if (a.isLeaf() || a.height < 2)
+   {
+      return idA;
+   }
+
+   const ProxyID idB = a.child1;
+   const ProxyID idC = a.child2;
+   Node& b = m_Nodes[idB];
+   Node& c = m_Nodes[idC];
+
+   const std::int32_t balance = c.height - b.height;
+
+   // Rotate C up
+   if (balance > 1)
+   {
+      const ProxyID idF = c.child1;
+      const ProxyID idG = c.child2;
+      Node& f = m_Nodes[idF];
+      Node& g = m_Nodes[idG];
+
+      // Swap A and C
+      c.child1 = idA;
+      c.parent = a.parent;
+      a.parent = idC;
+
+      // A's old parent should point to C
+      if (c.parent != NULL_PROXY)
+      {
+         Node& parent = m_Nodes[c.parent];
+         (parent.child1 == idA ? parent.child1 : parent.child2) = idC;
+      }
+      else
+      {
+         m_Root = idC;
+      }
+
+      // Keep the taller of C's children under C and hand the other to A
+      if (f.height > g.height)
+      {
+         c.child2 = idF;
+         a.child2 = idG;
+         g.parent = idA;
+         a.fatBounds = AABB::combine(b.fatBounds, g.fatBounds);
+         c.fatBounds = AABB::combine(a.fatBounds, f.fatBounds);
+         a.height = 1 + std::max(b.height, g.height);
+         c.height = 1 + std::max(a.height, f.height);
+      }
+      else
+      {
+         c.child2 = idG;
+         a.child2 = idF;
+         f.parent = idA;
+         a.fatBounds = AABB::combine(b.fatBounds, f.fatBounds);
+         c.fatBounds = AABB::combine(a.fatBounds, g.fatBounds);
+         a.height = 1 + std::max(b.height, f.height);
+         c.height = 1 + std::max(a.height, g.height);
+      }
+
+      return idC;
+   }
+
+   // Rotate B up
+   if (balance < -1)
+   {
+      const ProxyID idD = b.child1;
+      const ProxyID idE = b.child2;
+      Node& d = m_Nodes[idD];
+      Node& e = m_Nodes[idE];
+
+      // Swap A and B
+      b.child1 = idA;
+      b.parent = a.parent;
+      a.parent = idB;
+
+      // A's old parent should point to B
+      if (b.parent != NULL_PROXY)
+      {
+         Node& parent = m_Nodes[b.parent];
+         (parent.child1 == idA ? parent.child1 : parent.child2) = idB;
+      }
+      else
+      {
+         m_Root = idB;
+      }
+
+      // Keep the taller of B's children under B and hand the other to A
+      if (d.height > e.height)
+      {
+         b.child2 = idD;
+         a.child1 = idE;
+         e.parent = idA;
+         a.fatBounds = AABB::combine(c.fatBounds, e.fatBounds);
+         b.fatBounds = AABB::combine(a.fatBounds, d.fatBounds);
+         a.height = 1 + std::max(c.height, e.height);
+         b.height = 1 + std::max(a.height, d.height);
+      }
+      else
+      {
+         b.child2 = idE;
+         a.child1 = idD;
+         d.parent = idA;
+         a.fatBounds = AABB::combine(c.fatBounds, d.fatBounds);
+         b.fatBounds = AABB::combine(a.fatBounds, e.fatBounds);
+         a.height = 1 + std::max(c.height, d.height);
+         b.height = 1 + std::max(a.height, e.height);
+      }
+
+      return idB;
+   }
+
+   return idA;
+}
+
+bool AABBTree::isValidProxy(ProxyID proxyID) const
+{
+   return proxyID >= 0 && static_cast<std::size_t>(proxyID) < m_Nodes.size()
+      && m_Nodes[proxyID].height == 0;
+}
+
+void AABBTree::validateNode(ProxyID nodeID) const
+{
+   const Node& node = m_Nodes[nodeID];
+   if (node.isLeaf())
+   {
+      KORIN_ASSERT(node.height == 0);
+      KORIN_ASSERT(node.child2 == NULL_PROXY);
+      KORIN_ASSERT(node.fatBounds.contains(node.bounds));
+      return;
+   }
+
+   const Node& child1 = m_Nodes[node.child1];
+   const Node& child2 = m_Nodes[node.child2];
+   KORIN_ASSERT(child1.parent == nodeID);
+   KORIN_ASSERT(child2.parent == nodeID);
+   KORIN_ASSERT(node.height == 1 + std::max(child1.height, child2.height));
+   KORIN_ASSERT(node.fatBounds == AABB::combine(child1.fatBounds, child2.fatBounds));
+
+   validateNode(node.child1);
+   validateNode(node.child2);
+}
+
+bool AABBTree::raycastBounds(const AABB& bounds, const Vector2D& start, const Vector2D& inverseDirection,
+   float maxFraction, float& fraction, Vector2D& normal)
+{
+   const float nearX = (bounds.minX - start.x) * inverseDirection.x;
+   const float farX = (bounds.maxX - start.x) * inverseDirection.x;
+   const float nearY = (bounds.minY - start.y) * inverseDirection.y;
+   const float farY = (bounds.maxY - start.y) * inverseDirection.y;
+
+   const float entryX = std::min(nearX, farX);
+   const float entryY = std::min(nearY, farY);
+   const float exit = std::min(std::max(nearX, farX), std::max(nearY, farY));
+   const float entry = std::max(entryX, entryY);
+
+   // Segments that start inside the bounds hit at the start with no meaningful normal
+   if (entry < 0.0f)
+   {
+      if (exit < 0.0f || !bounds.contains(start))
+      {
+         return false;
+      }
+
+      fraction = 0.0f;
+      normal = Vector2D();
+      return true;
+   }
+
+   if (entry > exit || entry > maxFraction)
+   {
+      return false;
+   }
+
+   fraction = entry;
+   if (entryX > entryY)
+   {
+      normal = Vector2D(inverseDirection.x > 0.0f ? -1.0f : 1.0f, 0.0f);
+   }
+   else
+   {
+      normal = Vector2D(0.0f, inverseDirection.y > 0.0f ? -1.0f : 1.0f);
+   }
+
+   return true;
+}
+
+Vector2D AABBTree::inverseDirection(const Vector2D& start, const Vector2D& end)
+{
+   // Axis aligned segments get a huge inverse instead of infinity so the
+   // slab tests never multiply zero by infinity
+   const Vector2D direction = end - start;
+   const float huge = std::numeric_limits<float>::max();
+   return Vector2D(
+      direction.x != 0.0f ? 1.0f / direction.x : huge,
+      direction.y != 0.0f ? 1.0f / direction.y : huge
+   );
+}
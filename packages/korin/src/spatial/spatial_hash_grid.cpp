@@ -0,0 +1,306 @@
+// spatial_hash_grid.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cmath>
+
+#include "korin/spatial/spatial_hash_grid.h"
+#include "korin/math/vector2d.h"
+#include "korin/log.h"
+#include "korin/util/assert.h"
+
+using namespace korin;
+
+namespace
+{
+// Cell coordinates are biased into 16 bits before Morton encoding
+constexpr std::int32_t CELL_BIAS = 1 << 15;
+constexpr std::int32_t CELL_MIN = -CELL_BIAS;
+constexpr std::int32_t CELL_MAX = CELL_BIAS - 1;
+} // namespace
+
+SpatialHashGrid::SpatialHashGrid(float cellSize)
+   : m_CellSize(cellSize), m_InverseCellSize(1.0f / cellSize)
+   , m_Slots(), m_Proxies(std::vector<Proxy>()), m_Count(0)
+   , m_Cells(std::unordered_map<MortonCode, std::vector<std::uint32_t>>())
+   , m_QueryStamps(std::vector<std::uint32_t>()), m_QueryStamp(0)
+   , m_SortedCellKeys(std::vector<MortonCode>())
+{
+   KORIN_ASSERT(cellSize > 0.0f);
+}
+
+void SpatialHashGrid::insert(EntityID entityID, const AABB& bounds)
+{
+   if (entityID == INVALID_ENTITY_ID)
+   {
+      KORIN_CORE_WARN("Cannot add an invalid EntityID to the SpatialHashGrid.");
+      return;
+   }
+
+   if (!isFinite(bounds))
+   {
+      KORIN_CORE_WARN("Cannot add EntityID(" + std::to_string(entityID) + ") to the SpatialHashGrid. Its bounds are not finite.");
+      return;
+   }
+
+   if (contains(entityID))
+   {
+      update(entityID, bounds);
+      return;
+   }
+
+   const std::uint32_t slot = m_Slots.assign(entityID);
+   if (slot >= m_Proxies.size())
+   {
+      m_Proxies.resize(slot + 1, Proxy{AABB(0.0f, 0.0f, 0.0f, 0.0f), CellRange{0, 0, -1, -1}, INVALID_ENTITY_ID});
+      m_QueryStamps.resize(slot + 1, 0);
+   }
+
+   auto& proxy = m_Proxies[slot];
+   proxy.bounds = bounds;
+   proxy.cells = cellRangeFor(bounds);
+   proxy.entityID = entityID;
+   m_Count++;
+
+   addToCells(slot, proxy.cells);
+}
+
+void SpatialHashGrid::update(EntityID entityID, const AABB& bounds)
+{
+   const std::uint32_t slot = m_Slots.find(entityID);
+   if (slot == EntitySlotMap::NO_SLOT)
+   {
+      insert(entityID, bounds);
+      return;
+   }
+
+   if (!isFinite(bounds))
+   {
+      KORIN_CORE_WARN("Cannot move EntityID(" + std::to_string(entityID) + ") in the SpatialHashGrid. Its bounds are not finite.");
+      return;
+   }
+
+   auto& proxy = m_Proxies[slot];
+   proxy.bounds = bounds;
+
+   // Most movement stays inside the same cells so the buckets are left alone
+   const CellRange cells = cellRangeFor(bounds);
+   if (cells == proxy.cells)
+   {
+      return;
+   }
+
+   removeFromCells(slot, proxy.cells);
+   addToCells(slot, cells);
+   proxy.cells = cells;
+}
+
+void SpatialHashGrid::remove(EntityID entityID)
+{
+   const std::uint32_t slot = m_Slots.find(entityID);
+   if (slot == EntitySlotMap::NO_SLOT)
+   {
+      KORIN_CORE_WARN("EntityID(" + std::to_string(entityID) + ") does not exist in the SpatialHashGrid for removal.");
+      return;
+   }
+
+   auto& proxy = m_Proxies[slot];
+   removeFromCells(slot, proxy.cells);
+   proxy.entityID = INVALID_ENTITY_ID;
+   m_Slots.release(entityID);
+   m_Count--;
+}
+
+void SpatialHashGrid::clear()
+{
+   m_Slots.clear();
+   m_Proxies.clear();
+   m_QueryStamps.clear();
+   m_Cells.clear();
+   m_Count = 0;
+}
+
+bool SpatialHashGrid::contains(EntityID entityID) const
+{
+   return m_Slots.find(entityID) != EntitySlotMap::NO_SLOT;
+}
+
+void SpatialHashGrid::queryRegion(const AABB& region, std::vector<EntityID>& results) const
+{
+   if (!isFinite(region))
+   {
+      KORIN_CORE_WARN("Cannot query the SpatialHashGrid with a region that is not finite.");
+      return;
+   }
+
+   // A new stamp invalidates the marks from all previous queries at once
+   if (++m_QueryStamp == 0)
+   {
+      std::fill(m_QueryStamps.begin(), m_QueryStamps.end(), 0);
+      m_QueryStamp = 1;
+   }
+
+   const CellRange cells = cellRangeFor(region);
+   for (std::int32_t cellY = cells.minY; cellY <= cells.maxY; cellY++)
+   {
+      for (std::int32_t cellX = cells.minX; cellX <= cells.maxX; cellX++)
+      {
+         const auto cellIt = m_Cells.find(cellKey(cellX, cellY));
+         if (cellIt == m_Cells.end())
+         {
+            continue;
+         }
+
+         for (const std::uint32_t slot : cellIt->second)
+         {
+            if (m_QueryStamps[slot] == m_QueryStamp)
+            {
+               continue;
+            }
+
+            m_QueryStamps[slot] = m_QueryStamp;
+            const Proxy& proxy = m_Proxies[slot];
+            if (proxy.bounds.intersects(region))
+            {
+               results.push_back(proxy.entityID);
+            }
+         }
+      }
+   }
+}
+
+void SpatialHashGrid::queryPoint(const Vector2D& point, std::vector<EntityID>& results) const
+{
+   if (!std::isfinite(point.x) || !std::isfinite(point.y))
+   {
+      KORIN_CORE_WARN("Cannot query the SpatialHashGrid with a point that is not finite.");
+      return;
+   }
+
+   // A point only ever falls in a single cell so there are no duplicates to filter
+   const auto cellIt = m_Cells.find(cellKey(cellCoordinate(point.x), cellCoordinate(point.y)));
+   if (cellIt == m_Cells.end())
+   {
+      return;
+   }
+
+   for (const std::uint32_t slot : cellIt->second)
+   {
+      const Proxy& proxy = m_Proxies[slot];
+      if (proxy.bounds.contains(point))
+      {
+         results.push_back(proxy.entityID);
+      }
+   }
+}
+
+void SpatialHashGrid::queryPairs(std::vector<std::pair<EntityID, EntityID>>& pairs) const
+{
+   // Walk the occupied cells in Morton order so neighbouring cells are visited together
+   m_SortedCellKeys.clear();
+   m_SortedCellKeys.reserve(m_Cells.size());
+   for (const auto& [key, slots] : m_Cells)
+   {
+      if (slots.size() > 1)
+      {
+         m_SortedCellKeys.push_back(key);
+      }
+   }
+   std::sort(m_SortedCellKeys.begin(), m_SortedCellKeys.end());
+
+   for (const MortonCode key : m_SortedCellKeys)
+   {
+      const auto& slots = m_Cells.find(key)->second;
+      const std::int32_t cellX = static_cast<std::int32_t>(mortonDecodeX(key)) - CELL_BIAS;
+      const std::int32_t cellY = static_cast<std::int32_t>(mortonDecodeY(key)) - CELL_BIAS;
+
+      for (std::size_t i = 0; i < slots.size(); i++)
+      {
+         const Proxy& a = m_Proxies[slots[i]];
+         for (std::size_t j = i + 1; j < slots.size(); j++)
+         {
+            const Proxy& b = m_Proxies[slots[j]];
+
+            // Two proxies can share many cells. Only the first cell they
+            // share reports the pair so it is never reported twice.
+            if (std::max(a.cells.minX, b.cells.minX) != cellX || std::max(a.cells.minY, b.cells.minY) != cellY)
+            {
+               continue;
+            }
+
+            if (a.bounds.intersects(b.bounds))
+            {
+               pairs.emplace_back(std::min(a.entityID, b.entityID), std::max(a.entityID, b.entityID));
+            }
+         }
+      }
+   }
+}
+
+SpatialHashGrid::CellRange SpatialHashGrid::cellRangeFor(const AABB& bounds) const
+{
+   return {
+      cellCoordinate(bounds.minX), cellCoordinate(bounds.minY),
+      cellCoordinate(bounds.maxX), cellCoordinate(bounds.maxY)
+   };
+}
+
+std::int32_t SpatialHashGrid::cellCoordinate(float value) const
+{
+   // Clamp before converting so huge bounds can't overflow the cell range
+   const float cell = std::floor(value * m_InverseCellSize);
+   return static_cast<std::int32_t>(std::clamp(cell, static_cast<float>(CELL_MIN), static_cast<float>(CELL_MAX)));
+}
+
+bool SpatialHashGrid::isFinite(const AABB& bounds)
+{
+   // Casting a NaN cell coordinate to an integer is undefined
+   return std::isfinite(bounds.minX) && std::isfinite(bounds.minY) && std::isfinite(bounds.maxX) && std::isfinite(bounds.maxY);
+}
+
+MortonCode SpatialHashGrid::cellKey(std::int32_t cellX, std::int32_t cellY)
+{
+   return mortonEncode(static_cast<std::uint16_t>(cellX + CELL_BIAS), static_cast<std::uint16_t>(cellY + CELL_BIAS));
+}
+
+void SpatialHashGrid::addToCells(std::uint32_t slot, const CellRange& cells)
+{
+   for (std::int32_t cellY = cells.minY; cellY <= cells.maxY; cellY++)
+   {
+      for (std::int32_t cellX = cells.minX; cellX <= cells.maxX; cellX++)
+      {
+         m_Cells[cellKey(cellX, cellY)].push_back(slot);
+      }
+   }
+}
+
+void SpatialHashGrid::removeFromCells(std::uint32_t slot, const CellRange& cells)
+{
+   for (std::int32_t cellY = cells.minY; cellY <= cells.maxY; cellY++)
+   {
+      for (std::int32_t cellX = cells.minX; cellX <= cells.maxX; cellX++)
+      {
+         auto cellIt = m_Cells.find(cellKey(cellX, cellY));
+         if (cellIt == m_Cells.end())
+         {
+            continue;
+         }
+
+         // Order inside a cell doesn't matter so swap and pop
+         auto& slots = cellIt->second;
+         auto slotIt = std::find(slots.begin(), slots.end(), slot);
+         if (slotIt != slots.end())
+         {
+            *slotIt = slots.back();
+            slots.pop_back();
+         }
+
+         if (slots.empty())
+         {
+            m_Cells.erase(cellIt);
+         }
+      }
+   }
+}
@@ -0,0 +1,336 @@
+// sweep_and_prune.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+
+#include "korin/spatial/sweep_and_prune.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+// Past this many new endpoints an insertion sort costs more than a full sort
+constexpr std::size_t FULL_SORT_THRESHOLD = 64;
+} // namespace
+
+SweepAndPrune::SweepAndPrune()
+   : m_Slots(), m_Proxies(std::vector<Proxy>()), m_Count(0)
+   , m_EndpointsX(std::vector<Endpoint>()), m_EndpointsY(std::vector<Endpoint>())
+   , m_InsertedSinceSort(0), m_RemovedSinceSort(0)
+   , m_Pairs(std::set<std::uint64_t>()), m_PairsRestored(false)
+   , m_SweptPairs(std::vector<std::uint64_t>()), m_Active(std::vector<std::uint32_t>())
+   , m_Begun(std::vector<std::uint64_t>())
+{
+}
+
+void SweepAndPrune::insert(EntityID entityID, const AABB& bounds)
+{
+   if (entityID == INVALID_ENTITY_ID)
+   {
+      KORIN_CORE_WARN("Cannot add an invalid EntityID to the SweepAndPrune.");
+      return;
+   }
+
+   if (!isValidBounds(bounds))
+   {
+      KORIN_CORE_WARN("Cannot add EntityID(" + std::to_string(entityID) + ") to the SweepAndPrune. Its bounds are inverted or NaN.");
+      return;
+   }
+
+   if (contains(entityID))
+   {
+      update(entityID, bounds);
+      return;
+   }
+
+   const std::uint32_t slot = m_Slots.assign(entityID);
+   if (slot >= m_Proxies.size())
+   {
+      m_Proxies.resize(slot + 1, Proxy{AABB(0.0f, 0.0f, 0.0f, 0.0f), INVALID_ENTITY_ID, false, false, 0});
+   }
+
+   Proxy& proxy = m_Proxies[slot];
+   proxy.bounds = bounds;
+   proxy.entityID = entityID;
+   proxy.active = true;
+   m_Count++;
+
+   // An entity removed since the last update still has its endpoints and pairs, 
+   // so it carries on as if it had moved
+   if (proxy.hasEndpoints)
+   {
+      return;
+   }
+
+   // New endpoints start past every other one on both axes, where they overlap nothing, 
+   // and the next sort moves them into place
+   proxy.hasEndpoints = true;
+   m_EndpointsX.push_back({bounds.minX, slot, false});
+   m_EndpointsX.push_back({bounds.maxX, slot, true});
+   m_EndpointsY.push_back({bounds.minY, slot, false});
+   m_EndpointsY.push_back({bounds.maxY, slot, true});
+   m_InsertedSinceSort += 2;
+}
+
+void SweepAndPrune::update(EntityID entityID, const AABB& bounds)
+{
+   if (!contains(entityID))
+   {
+      insert(entityID, bounds);
+      return;
+   }
+
+   if (!isValidBounds(bounds))
+   {
+      KORIN_CORE_WARN("Cannot move EntityID(" + std::to_string(entityID) + ") in the SweepAndPrune. Its bounds are inverted or NaN.");
+      return;
+   }
+
+   m_Proxies[m_Slots.find(entityID)].bounds = bounds;
+}
+
+void SweepAndPrune::remove(EntityID entityID)
+{
+   if (!contains(entityID))
+   {
+      KORIN_CORE_WARN("EntityID(" + std::to_string(entityID) + ") does not exist in the SweepAndPrune for removal.");
+      return;
+   }
+
+   // The endpoints and pairs are dropped in one pass on the next update
+   m_Proxies[m_Slots.find(entityID)].active = false;
+   m_Count--;
+   m_RemovedSinceSort++;
+}
+
+bool SweepAndPrune::contains(EntityID entityID) const
+{
+   const std::uint32_t slot = m_Slots.find(entityID);
+   return slot != EntitySlotMap::NO_SLOT && m_Proxies[slot].active;
+}
+
+void SweepAndPrune::restorePairs(const std::vector<std::uint64_t>& pairs)
+{
+   m_Pairs = std::set<std::uint64_t>(pairs.begin(), pairs.end());
+   m_PairsRestored = true;
+}
+
+void SweepAndPrune::updatePairs(std::vector<OverlapEvent>& events, bool includePersisting)
+{
+   const std::size_t firstEvent = events.size();
+
+   removeStaleEndpoints(events);
+
+   for (Endpoint& endpoint : m_EndpointsX)
+   {
+      const AABB& bounds = m_Proxies[endpoint.slot].bounds;
+      endpoint.value = endpoint.isMax ? bounds.maxX : bounds.minX;
+   }
+   for (Endpoint& endpoint : m_EndpointsY)
+   {
+      const AABB& bounds = m_Proxies[endpoint.slot].bounds;
+      endpoint.value = endpoint.isMax ? bounds.maxY : bounds.minY;
+   }
+
+   if (m_PairsRestored || m_InsertedSinceSort > FULL_SORT_THRESHOLD)
+   {
+      rebuildPairs(events);
+   }
+   else
+   {
+      sortAxis(m_EndpointsX, events);
+      sortAxis(m_EndpointsY, events);
+   }
+   m_InsertedSinceSort = 0;
+   m_PairsRestored = false;
+
+   if (!includePersisting)
+   {
+      return;
+   }
+
+   m_Begun.clear();
+   for (std::size_t i = firstEvent; i < events.size(); i++)
+   {
+      if (events[i].type == OverlapEventType::Begin)
+      {
+         m_Begun.push_back(pairKey(events[i].a, events[i].b));
+      }
+   }
+   std::sort(m_Begun.begin(), m_Begun.end());
+
+   for (const std::uint64_t key : m_Pairs)
+   {
+      if (!std::binary_search(m_Begun.begin(), m_Begun.end(), key))
+      {
+         events.push_back({pairKeyFirst(key), pairKeySecond(key), OverlapEventType::Persist});
+      }
+   }
+}
+
+std::uint64_t SweepAndPrune::pairKey(EntityID a, EntityID b)
+{
+   return a < b 
+      ? (static_cast<std::uint64_t>(a) << 32) | b 
+      : (static_cast<std::uint64_t>(b) << 32) | a;
+}
+
+bool SweepAndPrune::isValidBounds(const AABB& bounds)
+{
+   // Also false when any of them is NaN
+   return bounds.minX <= bounds.maxX && bounds.minY <= bounds.maxY;
+}
+
+void SweepAndPrune::addPair(EntityID a, EntityID b, std::vector<OverlapEvent>& events)
+{
+   const std::uint64_t key = pairKey(a, b);
+   if (m_Pairs.insert(key).second)
+   {
+      events.push_back({pairKeyFirst(key), pairKeySecond(key), OverlapEventType::Begin});
+   }
+}
+
+void SweepAndPrune::removePair(EntityID a, EntityID b, std::vector<OverlapEvent>& events)
+{
+   const std::uint64_t key = pairKey(a, b);
+   if (m_Pairs.erase(key) > 0)
+   {
+      events.push_back({pairKeyFirst(key), pairKeySecond(key), OverlapEventType::End});
+   }
+}
+
+void SweepAndPrune::removeStaleEndpoints(std::vector<OverlapEvent>& events)
+{
+   if (m_RemovedSinceSort == 0)
+   {
+      return;
+   }
+
+   // Removals are rare next to moves, so one pass over the pairs ends all of theirs
+   for (auto pair = m_Pairs.begin(); pair != m_Pairs.end();)
+   {
+      if (!contains(pairKeyFirst(*pair)) || !contains(pairKeySecond(*pair)))
+      {
+         events.push_back({pairKeyFirst(*pair), pairKeySecond(*pair), OverlapEventType::End});
+         pair = m_Pairs.erase(pair);
+      }
+      else
+      {
+         ++pair;
+      }
+   }
+
+   auto isStale = [this](const Endpoint& endpoint) { return !m_Proxies[endpoint.slot].active; };
+   m_EndpointsX.erase(std::remove_if(m_EndpointsX.begin(), m_EndpointsX.end(), isStale), m_EndpointsX.end());
+   m_EndpointsY.erase(std::remove_if(m_EndpointsY.begin(), m_EndpointsY.end(), isStale), m_EndpointsY.end());
+   for (Proxy& proxy : m_Proxies)
+   {
+      // Without endpoints nothing refers to the slot any more
+      if (proxy.hasEndpoints && !proxy.active)
+      {
+         m_Slots.release(proxy.entityID);
+         proxy.entityID = INVALID_ENTITY_ID;
+      }
+      proxy.hasEndpoints = proxy.active;
+   }
+   m_RemovedSinceSort = 0;
+}
+
+void SweepAndPrune::sortAxis(std::vector<Endpoint>& endpoints, std::vector<OverlapEvent>& events)
+{
+   // Endpoints only moved a little since last tick so they are nearly sorted already.
+   // Each pair of endpoints that changed order is swapped exactly once, and the swap tells 
+   // whether the two bounds came together or came apart on this axis.
+   for (std::size_t i = 1; i < endpoints.size(); i++)
+   {
+      const Endpoint endpoint = endpoints[i];
+      std::size_t j = i;
+      while (j > 0 && endpoint < endpoints[j - 1])
+      {
+         const Endpoint& passed = endpoints[j - 1];
+         if (!endpoint.isMax && passed.isMax)
+         {
+            // They now overlap on this axis, so they overlap if the current bounds do on both
+            const Proxy& proxy = m_Proxies[endpoint.slot];
+            const Proxy& other = m_Proxies[passed.slot];
+            if (proxy.bounds.intersects(other.bounds))
+            {
+               addPair(proxy.entityID, other.entityID, events);
+            }
+         }
+         else if (endpoint.isMax && !passed.isMax)
+         {
+            removePair(m_Proxies[endpoint.slot].entityID, m_Proxies[passed.slot].entityID, events);
+         }
+
+         endpoints[j] = passed;
+         j--;
+      }
+      endpoints[j] = endpoint;
+   }
+}
+
+void SweepAndPrune::rebuildPairs(std::vector<OverlapEvent>& events)
+{
+   std::sort(m_EndpointsX.begin(), m_EndpointsX.end());
+   std::sort(m_EndpointsY.begin(), m_EndpointsY.end());
+
+   m_SweptPairs.clear();
+   m_Active.clear();
+
+   // Every bounds between a min and its max endpoint overlaps it on X, 
+   // so only those need to be checked on Y
+   for (const Endpoint& endpoint : m_EndpointsX)
+   {
+      Proxy& proxy = m_Proxies[endpoint.slot];
+      if (endpoint.isMax)
+      {
+         const std::uint32_t last = m_Active.back();
+         m_Active[proxy.sweepIndex] = last;
+         m_Proxies[last].sweepIndex = proxy.sweepIndex;
+         m_Active.pop_back();
+         continue;
+      }
+
+      for (const std::uint32_t otherSlot : m_Active)
+      {
+         const Proxy& other = m_Proxies[otherSlot];
+         if (proxy.bounds.minY <= other.bounds.maxY && proxy.bounds.maxY >= other.bounds.minY)
+         {
+            m_SweptPairs.push_back(pairKey(proxy.entityID, other.entityID));
+         }
+      }
+
+      proxy.sweepIndex = static_cast<std::uint32_t>(m_Active.size());
+      m_Active.push_back(endpoint.slot);
+   }
+
+   std::sort(m_SweptPairs.begin(), m_SweptPairs.end());
+
+   // Both pair lists are sorted so one merge finds what began and ended
+   auto current = m_SweptPairs.begin();
+   auto previous = m_Pairs.begin();
+   while (current != m_SweptPairs.end() || previous != m_Pairs.end())
+   {
+      if (previous == m_Pairs.end() || (current != m_SweptPairs.end() && *current < *previous))
+      {
+         events.push_back({pairKeyFirst(*current), pairKeySecond(*current), OverlapEventType::Begin});
+         ++current;
+      }
+      else if (current == m_SweptPairs.end() || *previous < *current)
+      {
+         events.push_back({pairKeyFirst(*previous), pairKeySecond(*previous), OverlapEventType::End});
+         ++previous;
+      }
+      else
+      {
+         ++current;
+         ++previous;
+      }
+   }
+
+   m_Pairs = std::set<std::uint64_t>(m_SweptPairs.begin(), m_SweptPairs.end());
+}
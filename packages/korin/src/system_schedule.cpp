@@ -0,0 +1,183 @@
+// system_schedule.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+
+#include "korin/system_schedule.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+SystemSchedule::SystemSchedule()
+   : m_Entries(std::vector<Entry>()), m_Phases(), m_Sorted(true)
+{
+   m_Enabled.fill(true);
+}
+
+bool SystemSchedule::add(const SystemPtr& system, const SystemDesc& desc)
+{
+   if (contains(system))
+   {
+      KORIN_CORE_WARN("System already exists in schedule.");
+      return false;
+   }
+
+   if (!desc.name.empty())
+   {
+      for (const Entry& entry : m_Entries)
+      {
+         if (entry.desc.name == desc.name)
+         {
+            KORIN_CORE_WARN("A System named " + desc.name + " already exists in schedule.");
+            return false;
+         }
+      }
+   }
+
+   m_Entries.push_back({system, desc});
+   m_Sorted = false;
+   return true;
+}
+
+bool SystemSchedule::remove(const SystemPtr& system)
+{
+   const auto entryIt = std::find_if(m_Entries.begin(), m_Entries.end(),
+      [&system](const Entry& entry) { return entry.system == system; });
+   if (entryIt == m_Entries.end())
+   {
+      return false;
+   }
+
+   // The sorted phase lets go of the system now, not at the next sort, in case its code is about to be unloaded
+   std::vector<SystemPtr>& sorted = m_Phases[static_cast<std::size_t>(entryIt->desc.phase)];
+   sorted.erase(std::remove(sorted.begin(), sorted.end(), system), sorted.end());
+
+   m_Entries.erase(entryIt);
+   m_Sorted = false;
+   return true;
+}
+
+bool SystemSchedule::contains(const SystemPtr& system) const
+{
+   return std::any_of(m_Entries.begin(), m_Entries.end(),
+      [&system](const Entry& entry) { return entry.system == system; });
+}
+
+void SystemSchedule::clear()
+{
+   m_Entries.clear();
+   for (std::vector<SystemPtr>& sorted : m_Phases)
+   {
+      sorted.clear();
+   }
+   m_Sorted = false;
+}
+
+const std::vector<SystemPtr>& SystemSchedule::phase(SystemPhase phase)
+{
+   if (!m_Sorted)
+   {
+      sort();
+   }
+   return m_Phases[static_cast<std::size_t>(phase)];
+}
+
+void SystemSchedule::sort()
+{
+   for (std::size_t phase = 0; phase < SYSTEM_PHASE_COUNT; phase++)
+   {
+      sortPhase(static_cast<SystemPhase>(phase));
+   }
+   m_Sorted = true;
+}
+
+void SystemSchedule::sortPhase(SystemPhase phase)
+{
+   std::vector<SystemPtr>& sorted = m_Phases[static_cast<std::size_t>(phase)];
+   sorted.clear();
+
+   std::vector<const Entry*> entries;
+   for (const Entry& entry : m_Entries)
+   {
+      if (entry.desc.phase == phase)
+      {
+         entries.push_back(&entry);
+      }
+   }
+
+   auto indexOf = [&entries](const std::string& name) -> std::size_t
+   {
+      for (std::size_t i = 0; i < entries.size(); i++)
+      {
+         if (!name.empty() && entries[i]->desc.name == name)
+         {
+            return i;
+         }
+      }
+      return entries.size();
+   };
+
+   // An edge from each system to the systems that have to wait for it
+   std::vector<std::vector<std::size_t>> successors(entries.size());
+   std::vector<std::uint32_t> waitingOn(entries.size(), 0);
+   for (std::size_t i = 0; i < entries.size(); i++)
+   {
+      for (const std::string& name : entries[i]->desc.after)
+      {
+         const std::size_t other = indexOf(name);
+         if (other < entries.size() && other != i)
+         {
+            successors[other].push_back(i);
+            waitingOn[i]++;
+         }
+      }
+      for (const std::string& name : entries[i]->desc.before)
+      {
+         const std::size_t other = indexOf(name);
+         if (other < entries.size() && other != i)
+         {
+            successors[i].push_back(other);
+            waitingOn[other]++;
+         }
+      }
+   }
+
+   // Always taking the earliest added system that is ready keeps the order stable
+   std::vector<bool> scheduled(entries.size(), false);
+   while (sorted.size() < entries.size())
+   {
+      std::size_t next = entries.size();
+      for (std::size_t i = 0; i < entries.size(); i++)
+      {
+         if (!scheduled[i] && waitingOn[i] == 0)
+         {
+            next = i;
+            break;
+         }
+      }
+
+      if (next == entries.size())
+      {
+         std::string cycle;
+         for (std::size_t i = 0; i < entries.size(); i++)
+         {
+            if (!scheduled[i])
+            {
+               cycle += (cycle.empty() ? "" : ", ") + entries[i]->desc.name;
+               sorted.push_back(entries[i]->system);
+            }
+         }
+         KORIN_CORE_WARN("System order constraints form a cycle between " + cycle + ". They run in the order they were added.");
+         break;
+      }
+
+      scheduled[next] = true;
+      sorted.push_back(entries[next]->system);
+      for (const std::size_t successor : successors[next])
+      {
+         waitingOn[successor]--;
+      }
+   }
+}
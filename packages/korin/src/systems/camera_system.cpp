@@ -0,0 +1,54 @@
+// camera_system.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/systems/camera_system.h"
+#include "korin/components/transform_component.h"
+#include "korin/util/assert.h"
+
+using namespace korin;
+
+CameraSystem::CameraSystem(std::weak_ptr<RenderSystem> renderSystem)
+   : m_RenderSystem(std::move(renderSystem))
+{
+}
+
+void CameraSystem::update(float timeStep, const ComponentPtr& component)
+{
+   KORIN_ASSERT(component->typeID() == Component::typeID<CameraComponent>());
+   updateBatch(timeStep, {component});
+}
+
+void CameraSystem::updateBatch(float timeStep, const std::vector<ComponentPtr>& components)
+{
+   auto renderSystem = m_RenderSystem.lock();
+   if (!renderSystem)
+   {
+      return;
+   }
+
+   // The earliest added camera wins a tie
+   const CameraComponent* best = nullptr;
+   std::shared_ptr<TransformComponent> bestTransform;
+   for (const ComponentPtr& component : components)
+   {
+      const auto& camera = static_cast<const CameraComponent&>(*component);
+      if (!camera.active || (best && camera.priority <= best->priority))
+      {
+         continue;
+      }
+
+      auto transform = camera.sibling<TransformComponent>().lock();
+      if (transform)
+      {
+         best = &camera;
+         bestTransform = std::move(transform);
+      }
+   }
+
+   if (best)
+   {
+      renderSystem->view = {bestTransform->x, bestTransform->y, best->pixelsPerUnit};
+   }
+}
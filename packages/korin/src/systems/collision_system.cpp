@@ -0,0 +1,387 @@
+// collision_system.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cmath>
+
+#include "korin/systems/collision_system.h"
+#include "korin/util/byte_stream.h"
+#include "korin/log.h"
+#include "korin/util/assert.h"
+
+using namespace korin;
+
+namespace
+{
+// Contacts whose normal points at least this far up hold the body above them
+constexpr float GROUND_NORMAL_Y = 0.7f;
+} // namespace
+
+CollisionSystem::CollisionSystem()
+   : m_BroadPhase(SweepAndPrune()), m_Solver(ContactSolver())
+   , m_Bodies(std::vector<Body>()), m_BodyIndices(std::unordered_map<EntityID, std::uint32_t>())
+   , m_Events(std::vector<OverlapEvent>())
+   , m_SweptPairs(std::vector<SweptPair>())
+   , m_Contacts(std::vector<ContactConstraint>())
+{
+}
+
+void CollisionSystem::update(float timeStep, const ComponentPtr& component)
+{
+   KORIN_ASSERT(component->typeID() == Component::typeID<ColliderComponent>());
+   auto collider = std::static_pointer_cast<ColliderComponent>(component);
+   auto transform = collider->sibling<TransformComponent>().lock();
+   if (!transform)
+   {
+      KORIN_CORE_WARN("TransformComponent not found");
+      return;
+   }
+
+   m_BroadPhase.update(collider->entityID(), collider->worldBounds(*transform));
+}
+
+void CollisionSystem::updateBatch(float timeStep, const std::vector<ComponentPtr>& components)
+{
+   m_CachedComponents.resize(components.size(), nullptr);
+   m_CachedSiblingsVersions.resize(components.size(), 0);
+   m_CachedTransforms.resize(components.size());
+   m_CachedPhysics.resize(components.size());
+
+   // Gather the bodies and refresh their bounds in the broad phase
+   m_Bodies.clear();
+   m_Present.clear();
+   for (std::size_t i = 0; i < components.size(); i++)
+   {
+      KORIN_ASSERT(components[i]->typeID() == Component::typeID<ColliderComponent>());
+      auto* collider = static_cast<ColliderComponent*>(components[i].get());
+      refreshSiblings(i, collider);
+      if (!m_CachedTransforms[i])
+      {
+         continue;
+      }
+
+      Body body = {collider, m_CachedTransforms[i].get(), m_CachedPhysics[i].get(), Vector2D(), false, 1.0f};
+      collider->grounded = false;
+
+      AABB bounds = collider->worldBounds(*body.transform);
+      if (isDynamic(body))
+      {
+         // Bodies that moved more than their own half size this tick could have skipped
+         // over something, so their broad-phase bounds cover the whole path
+         body.displacement = Vector2D(body.physics->dx, body.physics->dy) * timeStep;
+         body.fast = std::fabs(body.displacement.x) > bounds.width() * 0.5f 
+            || std::fabs(body.displacement.y) > bounds.height() * 0.5f;
+         if (body.fast)
+         {
+            const AABB previous(bounds.minX - body.displacement.x, bounds.minY - body.displacement.y,
+               bounds.maxX - body.displacement.x, bounds.maxY - body.displacement.y);
+            bounds = AABB::combine(bounds, previous);
+         }
+      }
+
+      const EntityID entityID = collider->entityID();
+      m_BodyIndices[entityID] = static_cast<std::uint32_t>(m_Bodies.size());
+      m_Bodies.push_back(body);
+      m_Present.push_back(entityID);
+
+      m_BroadPhase.update(entityID, bounds);
+   }
+
+   // Drop colliders that were removed since the last batch
+   std::sort(m_Present.begin(), m_Present.end());
+   for (EntityID entityID : m_Tracked)
+   {
+      if (!std::binary_search(m_Present.begin(), m_Present.end(), entityID))
+      {
+         m_BroadPhase.remove(entityID);
+         m_BodyIndices.erase(entityID);
+      }
+   }
+   m_Tracked.swap(m_Present);
+
+   // Only the pairs that began or ended are reported. Contacts that persist keep their
+   // impulses in the solver cache until their pair ends.
+   m_Events.clear();
+   m_BroadPhase.updatePairs(m_Events);
+   for (const OverlapEvent& event : m_Events)
+   {
+      if (event.type == OverlapEventType::End)
+      {
+         m_Solver.forget(SweepAndPrune::pairKey(event.a, event.b));
+      }
+   }
+
+   // Narrow phase on every overlapping pair with at least one awake dynamic body
+   m_Contacts.clear();
+   m_SweptPairs.clear();
+   for (const std::uint64_t key : m_BroadPhase.overlappingPairs())
+   {
+      const EntityID entityA = SweepAndPrune::pairKeyFirst(key);
+      const EntityID entityB = SweepAndPrune::pairKeySecond(key);
+      const std::uint32_t indexA = m_BodyIndices.find(entityA)->second;
+      const std::uint32_t indexB = m_BodyIndices.find(entityB)->second;
+      Body& a = m_Bodies[indexA];
+      Body& b = m_Bodies[indexB];
+      const bool awakeA = isDynamic(a) && !a.physics->sleeping;
+      const bool awakeB = isDynamic(b) && !b.physics->sleeping;
+      if (!awakeA && !awakeB)
+      {
+         continue;
+      }
+
+      Manifold manifold;
+      if (collide(a, b, manifold))
+      {
+         addContact(indexA, indexB, key, manifold);
+         continue;
+      }
+
+      // Fast bodies are only moved back once every pair has been swept, to the first thing they hit
+      float timeOfImpact = 1.0f;
+      Vector2D normal;
+      if ((a.fast || b.fast) && collideSwept(a, b, timeOfImpact, normal))
+      {
+         m_SweptPairs.push_back({indexA, indexB, key, timeOfImpact, normal});
+         a.timeOfImpact = std::min(a.timeOfImpact, timeOfImpact);
+         b.timeOfImpact = std::min(b.timeOfImpact, timeOfImpact);
+      }
+   }
+   resolveSweptPairs();
+
+   if (m_Contacts.empty())
+   {
+      return;
+   }
+
+   m_SolverBodies.resize(m_Bodies.size());
+   for (std::size_t i = 0; i < m_Bodies.size(); i++)
+   {
+      const Body& body = m_Bodies[i];
+      SolverBody& solverBody = m_SolverBodies[i];
+      solverBody.positionCorrection = Vector2D();
+      if (isDynamic(body) && !body.physics->sleeping)
+      {
+         solverBody.velocity = Vector2D(body.physics->dx, body.physics->dy);
+         solverBody.inverseMass = body.physics->inverseMass;
+      }
+      else
+      {
+         solverBody.velocity = Vector2D();
+         solverBody.inverseMass = 0.0f;
+      }
+   }
+
+   m_Solver.solve(m_SolverBodies, m_Contacts);
+
+   for (std::size_t i = 0; i < m_Bodies.size(); i++)
+   {
+      const SolverBody& solverBody = m_SolverBodies[i];
+      if (solverBody.inverseMass <= 0.0f)
+      {
+         continue;
+      }
+
+      const Body& body = m_Bodies[i];
+      body.physics->dx = solverBody.velocity.x;
+      body.physics->dy = solverBody.velocity.y;
+      body.transform->x += solverBody.positionCorrection.x;
+      body.transform->y += solverBody.positionCorrection.y;
+   }
+
+   // The normal points from A to B so an upward normal means B rests on A
+   for (const ContactConstraint& contact : m_Contacts)
+   {
+      if (contact.manifold.normal.y >= GROUND_NORMAL_Y)
+      {
+         m_Bodies[contact.bodyB].collider->grounded = true;
+      }
+      else if (contact.manifold.normal.y <= -GROUND_NORMAL_Y)
+      {
+         m_Bodies[contact.bodyA].collider->grounded = true;
+      }
+   }
+}
+
+void CollisionSystem::onWorldRestored()
+{
+   m_BroadPhase = SweepAndPrune();
+   m_Solver.clearCache();
+   m_CachedComponents.clear();
+   m_CachedSiblingsVersions.clear();
+   m_CachedTransforms.clear();
+   m_CachedPhysics.clear();
+   m_Bodies.clear();
+   m_BodyIndices.clear();
+   m_Tracked.clear();
+   m_Events.clear();
+   m_SweptPairs.clear();
+   m_Contacts.clear();
+}
+
+void CollisionSystem::saveState(std::vector<std::uint8_t>& state) const
+{
+   ByteWriter writer(state);
+   const std::set<std::uint64_t>& pairs = m_BroadPhase.overlappingPairs();
+   writer.writeU32(static_cast<std::uint32_t>(pairs.size()));
+   for (const std::uint64_t pair : pairs)
+   {
+      writer.writeU64(pair);
+   }
+   m_Solver.writeCache(writer);
+}
+
+void CollisionSystem::loadState(const std::vector<std::uint8_t>& state)
+{
+   ByteReader reader(state);
+   std::uint32_t pairCount = 0;
+   std::vector<std::uint64_t> pairs;
+   bool valid = reader.readU32(pairCount);
+   for (std::uint32_t i = 0; valid && i < pairCount; i++)
+   {
+      std::uint64_t pair = 0;
+      valid = reader.readU64(pair);
+      pairs.push_back(pair);
+   }
+
+   if (!valid || !m_Solver.readCache(reader))
+   {
+      KORIN_CORE_WARN("CollisionSystem state is invalid.");
+      return;
+   }
+   m_BroadPhase.restorePairs(pairs);
+}
+
+void CollisionSystem::refreshSiblings(std::size_t index, ColliderComponent* collider)
+{
+   // The entity check catches a new component allocated where an old one was freed, 
+   // and the version catches siblings added to or removed from the entity
+   const auto& cachedTransform = m_CachedTransforms[index];
+   if (m_CachedComponents[index] == collider && m_CachedSiblingsVersions[index] == collider->siblingsVersion()
+      && cachedTransform && cachedTransform->entityID() == collider->entityID())
+   {
+      return;
+   }
+
+   m_CachedComponents[index] = collider;
+   m_CachedSiblingsVersions[index] = collider->siblingsVersion();
+   m_CachedTransforms[index] = collider->sibling<TransformComponent>().lock();
+   m_CachedPhysics[index] = collider->sibling<PhysicsComponent>().lock();
+}
+
+bool CollisionSystem::isDynamic(const Body& body) const
+{
+   return body.physics && body.physics->enabled && body.physics->inverseMass > 0.0f;
+}
+
+bool CollisionSystem::collide(const Body& a, const Body& b, Manifold& manifold) const
+{
+   const bool circleA = a.collider->shape == ColliderShape::Circle;
+   const bool circleB = b.collider->shape == ColliderShape::Circle;
+
+   if (circleA && circleB)
+   {
+      return collideCircles(a.collider->worldCircle(*a.transform), b.collider->worldCircle(*b.transform), manifold);
+   }
+
+   if (circleA)
+   {
+      return collideCircleAABB(a.collider->worldCircle(*a.transform), b.collider->worldBounds(*b.transform), manifold);
+   }
+
+   if (circleB)
+   {
+      if (!collideCircleAABB(b.collider->worldCircle(*b.transform), a.collider->worldBounds(*a.transform), manifold))
+      {
+         return false;
+      }
+      manifold.normal = manifold.normal * -1.0f;
+      return true;
+   }
+
+   return collideAABBs(a.collider->worldBounds(*a.transform), b.collider->worldBounds(*b.transform), manifold);
+}
+
+bool CollisionSystem::collideSwept(const Body& a, const Body& b, float& timeOfImpact, Vector2D& normal) const
+{
+   // Sweep A relative to B using the bounds of both at the start of the tick
+   const AABB endA = a.collider->worldBounds(*a.transform);
+   const AABB endB = b.collider->worldBounds(*b.transform);
+   const AABB startA(endA.minX - a.displacement.x, endA.minY - a.displacement.y, 
+      endA.maxX - a.displacement.x, endA.maxY - a.displacement.y);
+   const AABB startB(endB.minX - b.displacement.x, endB.minY - b.displacement.y, 
+      endB.maxX - b.displacement.x, endB.maxY - b.displacement.y);
+   return sweepAABBs(startA, a.displacement - b.displacement, startB, timeOfImpact, normal);
+}
+
+void CollisionSystem::resolveSweptPairs()
+{
+   if (m_SweptPairs.empty())
+   {
+      return;
+   }
+
+   // Each body moves back once, to its earliest impact. Static bodies have no displacement.
+   for (Body& body : m_Bodies)
+   {
+      if (body.timeOfImpact < 1.0f)
+      {
+         const float rewind = 1.0f - body.timeOfImpact;
+         body.transform->x -= body.displacement.x * rewind;
+         body.transform->y -= body.displacement.y * rewind;
+      }
+   }
+
+   // Contacts found at the end of the tick may no longer touch bodies that moved back
+   m_Contacts.erase(std::remove_if(m_Contacts.begin(), m_Contacts.end(), [this](ContactConstraint& contact)
+   {
+      const Body& a = m_Bodies[contact.bodyA];
+      const Body& b = m_Bodies[contact.bodyB];
+      return (a.timeOfImpact < 1.0f || b.timeOfImpact < 1.0f) && !collide(a, b, contact.manifold);
+   }), m_Contacts.end());
+
+   // A pair only touches if neither moving body was stopped earlier by something else
+   for (const SweptPair& pair : m_SweptPairs)
+   {
+      const Body& a = m_Bodies[pair.bodyA];
+      const Body& b = m_Bodies[pair.bodyB];
+      if ((isDynamic(a) && a.timeOfImpact < pair.timeOfImpact) || (isDynamic(b) && b.timeOfImpact < pair.timeOfImpact))
+      {
+         continue;
+      }
+
+      // The swept normal points back towards A, the manifold normal points from A to B
+      const AABB boundsA = a.collider->worldBounds(*a.transform);
+      Manifold manifold;
+      manifold.normal = pair.normal * -1.0f;
+      manifold.pointCount = 1;
+      manifold.points[0] = {boundsA.center() + manifold.normal * 0.5f * 
+         (manifold.normal.x != 0.0f ? boundsA.width() : boundsA.height()), 0.0f};
+      addContact(pair.bodyA, pair.bodyB, pair.key, manifold);
+   }
+}
+
+void CollisionSystem::addContact(std::uint32_t indexA, std::uint32_t indexB, std::uint64_t key, const Manifold& manifold)
+{
+   // Sleeping bodies hit by an awake one join the solve
+   const Body& a = m_Bodies[indexA];
+   const Body& b = m_Bodies[indexB];
+   if (isDynamic(a) && a.physics->sleeping)
+   {
+      a.physics->wake();
+   }
+   if (isDynamic(b) && b.physics->sleeping)
+   {
+      b.physics->wake();
+   }
+
+   ContactConstraint contact;
+   contact.bodyA = indexA;
+   contact.bodyB = indexB;
+   contact.key = key;
+   contact.manifold = manifold;
+   contact.friction = std::sqrt(a.collider->friction * b.collider->friction);
+   contact.restitution = std::max(a.collider->restitution, b.collider->restitution);
+   m_Contacts.push_back(contact);
+}
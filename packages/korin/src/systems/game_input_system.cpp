@@ -3,90 +3,238 @@
 // Copyright (c) Zachary Duncan - Duncandoit
 // 07/31/2024
 
-#include <iostream>
-
-#ifdef KORIN_PLATFORM_MACOSX
-#include <ApplicationServices/ApplicationServices.h>
+#if defined(KORIN_PLATFORM_MACOSX)
 #include <Carbon/Carbon.h>
+#elif defined(KORIN_PLATFORM_LINUX)
+#include <linux/input-event-codes.h>
 #endif
 
+#include <mutex>
+#include <utility>
+
 #include "korin/systems/game_input_system.h"
 #include "korin/util/game_action_util.h"
+#include "korin/util/assert.h"
 
 using namespace korin;
 
 GameInputSystem::GameInputSystem() 
-   : consumed(false)
+   : GameInputSystem(InputBackend::createPlatformBackend())
+{
+}
+
+GameInputSystem::GameInputSystem(std::unique_ptr<InputBackend> backend) 
+   : consumed(false), m_Backend(nullptr), m_Mode(InputMode::Live), m_Resimulating(false)
+   , m_LocalActions(0), m_LocalActionsPressed(0), m_LocalActionsReleased(0), m_EdgeMasks(std::vector<ActionMask>())
+{
+   m_AxisValues.fill(0.0f);
+   m_AxisDeltas.fill(0.0f);
+
+   // The bindings are shared by every world, so they're only defaulted by the first
+   // input system and bindings changed after that are left alone
+   static std::once_flag defaultsAssigned;
+   std::call_once(defaultsAssigned, assignDefaultGameActions);
+
+   setBackend(std::move(backend));
+}
+
+GameInputSystem::~GameInputSystem()
 {
-   requestListenEventAccess();
-   assignDefaultGameActions();
+   if (m_Backend)
+   {
+      m_Backend->stop();
+   }
 }
 
 void GameInputSystem::update(float timeStep, const ComponentPtr& component)
 {
-   auto inputStream = std::static_pointer_cast<InputStreamComponent>(component);
-   if (!inputStream)
+   if (!component)
    {
       KORIN_CORE_WARN("InputStreamComponent not found");
       return;
    }
 
-   uint64_t keyCodes = pollKeyCodes();
-   uint64_t gameActions = GameActionUtil::instance().getActionsForInput(keyCodes);
-   inputStream->previousActionStates = inputStream->currentActionStates;
-   inputStream->currentActionStates = gameActions;
+   updateBatch(timeStep, {component});
+}
 
-   updateButtonUpDownEvents(inputStream);
+void GameInputSystem::updateBatch(float timeStep, const std::vector<ComponentPtr>& components)
+{
+   // Live input is drained even while replaying so the queue doesn't fill up. Ticks 
+   // simulated again by a rollback already had their input, so the queue is left for 
+   // the next new tick and presses from the last one aren't repeated.
+   if (m_Resimulating)
+   {
+      m_LocalActionsPressed = 0;
+      m_LocalActionsReleased = 0;
+   }
+   else
+   {
+      drainEvents();
+   }
+
+   bool replayed = false;
+   if (m_Mode == InputMode::Replaying)
+   {
+      replayed = m_Player.playTick(components);
+      if (!replayed)
+      {
+         KORIN_CORE_INFO("Input replay finished after " + std::to_string(m_Player.tick()) + " ticks.");
+         m_Mode = InputMode::Live;
+      }
+   }
+
+   if (!replayed)
+   {
+      updateActionStates(components);
+
+      if (m_Mode == InputMode::Recording)
+      {
+         m_Recorder.recordTick(components);
+      }
+   }
 
    // Update button squence events, held events, etc.
+   m_ActionStateMachine.evaluateBatch(components);
 }
 
-void GameInputSystem::updateButtonUpDownEvents(const std::shared_ptr<InputStreamComponent>& inputStream)
+void GameInputSystem::startRecording()
 {
-   // XOR the current and last button states to find the changes
-   const uint64_t changes = inputStream->currentActionStates ^ inputStream->previousActionStates;
+   m_Recorder.begin();
+   m_Mode = InputMode::Recording;
+}
 
-   // AND the changes with the current button states to find the downs
-   inputStream->actionsBegun = changes & inputStream->currentActionStates;
+bool GameInputSystem::startReplay(std::vector<std::uint8_t> recording)
+{
+   if (!m_Player.load(std::move(recording)))
+   {
+      return false;
+   }
 
-   // AND-NOT the changes with the current button states to find the ups
-   inputStream->actionsEnded = changes & (~inputStream->currentActionStates);
+   m_Mode = InputMode::Replaying;
+   return true;
 }
 
-void GameInputSystem::requestListenEventAccess() const
+void GameInputSystem::resumeLiveInput()
 {
-   #ifdef KORIN_PLATFORM_MACOSX
-      CGRequestListenEventAccess();
-   #endif
+   m_Mode = InputMode::Live;
 }
 
-void GameInputSystem::assignDefaultGameActions() const
+void GameInputSystem::setBackend(std::unique_ptr<InputBackend> backend)
 {
-   #ifdef KORIN_PLATFORM_MACOSX
-      GameActionUtil::instance().mapInputToAction(kVK_ANSI_W, GameAction::MoveForward);
-      GameActionUtil::instance().mapInputToAction(kVK_ANSI_A, GameAction::MoveLeft);
-      GameActionUtil::instance().mapInputToAction(kVK_ANSI_S, GameAction::MoveBackward);
-      GameActionUtil::instance().mapInputToAction(kVK_ANSI_D, GameAction::MoveRight);
-   #endif
+   if (m_Backend)
+   {
+      m_Backend->stop();
+   }
+
+   m_Backend = std::move(backend);
+   m_PressedInputs.reset();
+   if (m_Backend && !m_Backend->start())
+   {
+      KORIN_CORE_WARN("Input backend failed to start");
+   }
 }
 
-uint64_t GameInputSystem::pollKeyCodes() const
+void GameInputSystem::drainEvents()
 {
-   #ifdef KORIN_PLATFORM_MACOSX
-      uint64_t keyCodes = 0;
-      for (const auto& [code, action] : GameActionUtil::instance().getActionsByInput())
+   m_PressedThisFrame.reset();
+   m_ReleasedThisFrame.reset();
+   m_AxisDeltas.fill(0.0f);
+
+   if (m_Backend)
+   {
+      pollBackend();
+   }
+
+   const GameActionUtil& actions = GameActionUtil::instance();
+   m_LocalActions = actions.getActionsForInput(m_PressedInputs);
+   m_LocalActionsPressed = actions.getActionsForInput(m_PressedThisFrame);
+   m_LocalActionsReleased = actions.getActionsForInput(m_ReleasedThisFrame);
+}
+
+void GameInputSystem::pollBackend()
+{
+   m_Backend->poll();
+
+   InputEvent event;
+   while (m_Backend->pollEvent(event))
+   {
+      if (event.type == InputEventType::Axis)
       {
-         // Check if the key is currently pressed
-         if (CGEventSourceKeyState(kCGEventSourceStateHIDSystemState, code))
+         if (event.code < INPUT_AXIS_COUNT)
          {
-            keyCodes |= (1ULL << code);
+            m_AxisValues[event.code] = event.value;
+            m_AxisDeltas[event.code] += event.value;
          }
+         continue;
+      }
+
+      const std::uint16_t inputCode = event.inputCode();
+      if (inputCode >= INPUT_CODE_COUNT)
+      {
+         continue;
+      }
+
+      if (event.isPress())
+      {
+         m_PressedInputs.set(inputCode);
+         m_PressedThisFrame.set(inputCode);
+      }
+      else
+      {
+         m_PressedInputs.reset(inputCode);
+         m_ReleasedThisFrame.set(inputCode);
       }
+   }
+}
 
-      std::cout << "InputSys > Poll > Return > keyCodes:" << keyCodes << std::endl;
-      return keyCodes;
+void GameInputSystem::updateActionStates(const std::vector<ComponentPtr>& inputStreams)
+{
+   const std::size_t count = inputStreams.size();
+   m_EdgeMasks.resize(count * 6);
+   ActionMask* previous = m_EdgeMasks.data();
+   ActionMask* current = previous + count;
+   ActionMask* pressed = current + count;
+   ActionMask* released = pressed + count;
+   ActionMask* begun = released + count;
+   ActionMask* ended = begun + count;
+
+   for (std::size_t i = 0; i < count; i++)
+   {
+      KORIN_ASSERT(inputStreams[i]->typeID() == Component::typeID<InputStreamComponent>());
+      const auto* inputStream = static_cast<const InputStreamComponent*>(inputStreams[i].get());
+      previous[i] = inputStream->currentActionStates;
+
+      // Taps that began and ended between two frames still count as a press and a release
+      // for Local streams. External streams only see the states they are given.
+      const bool local = inputStream->source == InputSource::Local;
+      current[i] = local ? m_LocalActions : inputStream->externalActionStates;
+      pressed[i] = local ? m_LocalActionsPressed : 0;
+      released[i] = local ? m_LocalActionsReleased : 0;
+   }
 
-   #else
-      return 0;
+   computeActionEdges(count, previous, current, pressed, released, begun, ended);
+
+   for (std::size_t i = 0; i < count; i++)
+   {
+      auto* inputStream = static_cast<InputStreamComponent*>(inputStreams[i].get());
+      inputStream->previousActionStates = previous[i];
+      inputStream->currentActionStates = current[i];
+      inputStream->actionsBegun = begun[i];
+      inputStream->actionsEnded = ended[i];
+   }
+}
+
+void GameInputSystem::assignDefaultGameActions()
+{
+   #if defined(KORIN_PLATFORM_MACOSX)
+      GameActionUtil::instance().mapInputToAction(kVK_ANSI_W, GameAction::MoveForward);
+      GameActionUtil::instance().mapInputToAction(kVK_ANSI_A, GameAction::MoveLeft);
+      GameActionUtil::instance().mapInputToAction(kVK_ANSI_S, GameAction::MoveBackward);
+      GameActionUtil::instance().mapInputToAction(kVK_ANSI_D, GameAction::MoveRight);
+   #elif defined(KORIN_PLATFORM_LINUX)
+      GameActionUtil::instance().mapInputToAction(KEY_W, GameAction::MoveForward);
+      GameActionUtil::instance().mapInputToAction(KEY_A, GameAction::MoveLeft);
+      GameActionUtil::instance().mapInputToAction(KEY_S, GameAction::MoveBackward);
+      GameActionUtil::instance().mapInputToAction(KEY_D, GameAction::MoveRight);
    #endif
-}
\ No newline at end of file
+}
@@ -3,6 +3,8 @@
 // Copyright (c) Zachary Duncan - Duncandoit
 // 2024-07-09
 
+#include <array>
+
 #include "korin/systems/movement_system.h"
 #include "korin/components/transform_component.h"
 #include "korin/components/input_stream_component.h"
@@ -11,6 +13,39 @@
 
 using namespace korin;
 
+namespace
+{
+constexpr float MOVE_SPEED = 5.5f;
+
+// The movement actions are four neighbouring bits so they can be used as a table index
+constexpr int MOVE_ACTION_SHIFT = 3;
+static_assert(toMask(GameAction::MoveForward) == 1ULL << MOVE_ACTION_SHIFT
+   && toMask(GameAction::MoveBackward) == 1ULL << (MOVE_ACTION_SHIFT + 1)
+   && toMask(GameAction::MoveRight) == 1ULL << (MOVE_ACTION_SHIFT + 2)
+   && toMask(GameAction::MoveLeft) == 1ULL << (MOVE_ACTION_SHIFT + 3),
+   "The movement GameActions must be consecutive bits");
+
+struct Direction
+{
+   float x, y;
+};
+
+// Direction of every combination of forward, backward, right and left, indexed by
+// the movement bits. Opposite actions cancel out.
+constexpr std::array<Direction, 16> makeDirectionTable()
+{
+   std::array<Direction, 16> table = {};
+   for (std::size_t index = 0; index < table.size(); index++)
+   {
+      table[index].y = static_cast<float>(index & 1) - static_cast<float>((index >> 1) & 1);
+      table[index].x = static_cast<float>((index >> 2) & 1) - static_cast<float>((index >> 3) & 1);
+   }
+   return table;
+}
+
+constexpr std::array<Direction, 16> DIRECTIONS = makeDirectionTable();
+} // namespace
+
 void MovementSystem::update(float timeStep, const ComponentPtr& component)
 {
    KORIN_ASSERT(component->typeID() == Component::typeID<TransformComponent>());
@@ -28,34 +63,11 @@ void MovementSystem::update(float timeStep, const ComponentPtr& component)
       return;
    }
 
-   if (didActionBegin(GameAction::MoveForward, inputStream) || didActionContinue(GameAction::MoveForward, inputStream))
-   {
-      transform->y += 5.5f * timeStep;
-   }
+   // Actions that began this frame or are still held from the last one
+   const ActionMask active = inputStream->actionsBegun 
+      | (inputStream->currentActionStates & inputStream->previousActionStates);
 
-   if (didActionBegin(GameAction::MoveBackward, inputStream) || didActionContinue(GameAction::MoveBackward, inputStream))
-   {
-      transform->y -= 5.5f * timeStep;
-   }
-
-   if (didActionBegin(GameAction::MoveRight, inputStream) || didActionContinue(GameAction::MoveRight, inputStream))
-   {
-      transform->x += 5.5f * timeStep;
-   }
-
-   if (didActionBegin(GameAction::MoveLeft, inputStream) || didActionContinue(GameAction::MoveLeft, inputStream))
-   {
-      transform->x -= 5.5f * timeStep;
-   }
-}
-
-bool MovementSystem::didActionBegin(GameAction action, const std::shared_ptr<InputStreamComponent>& inputStream) const
-{
-   return inputStream->actionsBegun & static_cast<uint64_t>(action);
+   const Direction& direction = DIRECTIONS[(active >> MOVE_ACTION_SHIFT) & 0xF];
+   transform->x += direction.x * MOVE_SPEED * timeStep;
+   transform->y += direction.y * MOVE_SPEED * timeStep;
 }
-
-bool MovementSystem::didActionContinue(GameAction action, const std::shared_ptr<InputStreamComponent>& inputStream) const
-{
-   return (inputStream->currentActionStates & static_cast<uint64_t>(action)) 
-      && (inputStream->previousActionStates & static_cast<uint64_t>(action));
-}
\ No newline at end of file
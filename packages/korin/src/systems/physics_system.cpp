@@ -0,0 +1,135 @@
+// physics_system.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/systems/physics_system.h"
+#include "korin/physics/integration.h"
+#include "korin/log.h"
+#include "korin/util/assert.h"
+
+using namespace korin;
+
+PhysicsSystem::PhysicsSystem()
+   : sleepVelocity(0.01f), timeToSleep(0.5f)
+{
+}
+
+void PhysicsSystem::update(float timeStep, const ComponentPtr& component)
+{
+   KORIN_ASSERT(component->typeID() == Component::typeID<PhysicsComponent>());
+   auto physics = std::static_pointer_cast<PhysicsComponent>(component);
+   if (!physics->enabled || physics->sleeping)
+   {
+      return;
+   }
+
+   auto transform = physics->sibling<TransformComponent>().lock();
+   if (!transform)
+   {
+      KORIN_CORE_WARN("TransformComponent not found");
+      return;
+   }
+
+   integrateSemiImplicitEuler(1, timeStep, &transform->x, &transform->y, 
+      &physics->dx, &physics->dy, &physics->accelerationX, &physics->accelerationY);
+   updateSleep(timeStep, *physics);
+}
+
+void PhysicsSystem::onWorldRestored()
+{
+   m_CachedComponents.clear();
+   m_CachedSiblingsVersions.clear();
+   m_CachedTransforms.clear();
+}
+
+void PhysicsSystem::updateBatch(float timeStep, const std::vector<ComponentPtr>& components)
+{
+   // Sibling lookups are only repeated for components that changed since the last batch
+   m_CachedComponents.resize(components.size(), nullptr);
+   m_CachedSiblingsVersions.resize(components.size(), 0);
+   m_CachedTransforms.resize(components.size());
+
+   m_Awake.clear();
+   for (std::size_t i = 0; i < components.size(); i++)
+   {
+      KORIN_ASSERT(components[i]->typeID() == Component::typeID<PhysicsComponent>());
+      auto* physics = static_cast<PhysicsComponent*>(components[i].get());
+      if (!physics->enabled || physics->sleeping)
+      {
+         continue;
+      }
+
+      // The entity check catches a new component allocated where an old one was freed
+      const auto& cachedTransform = m_CachedTransforms[i];
+      if (m_CachedComponents[i] != physics || m_CachedSiblingsVersions[i] != physics->siblingsVersion()
+          || !cachedTransform || cachedTransform->entityID() != physics->entityID())
+      {
+         m_CachedComponents[i] = physics;
+         m_CachedSiblingsVersions[i] = physics->siblingsVersion();
+         m_CachedTransforms[i] = physics->sibling<TransformComponent>().lock();
+      }
+
+      if (!m_CachedTransforms[i])
+      {
+         continue;
+      }
+
+      m_Awake.push_back({physics, m_CachedTransforms[i].get()});
+   }
+
+   const std::size_t count = m_Awake.size();
+   m_PositionX.resize(count);
+   m_PositionY.resize(count);
+   m_VelocityX.resize(count);
+   m_VelocityY.resize(count);
+   m_AccelerationX.resize(count);
+   m_AccelerationY.resize(count);
+
+   for (std::size_t i = 0; i < count; i++)
+   {
+      const Body& body = m_Awake[i];
+      m_PositionX[i] = body.transform->x;
+      m_PositionY[i] = body.transform->y;
+      m_VelocityX[i] = body.physics->dx;
+      m_VelocityY[i] = body.physics->dy;
+      m_AccelerationX[i] = body.physics->accelerationX;
+      m_AccelerationY[i] = body.physics->accelerationY;
+   }
+
+   integrateSemiImplicitEuler(count, timeStep, m_PositionX.data(), m_PositionY.data(), 
+      m_VelocityX.data(), m_VelocityY.data(), m_AccelerationX.data(), m_AccelerationY.data());
+
+   for (std::size_t i = 0; i < count; i++)
+   {
+      const Body& body = m_Awake[i];
+      body.transform->x = m_PositionX[i];
+      body.transform->y = m_PositionY[i];
+      body.physics->dx = m_VelocityX[i];
+      body.physics->dy = m_VelocityY[i];
+      updateSleep(timeStep, *body.physics);
+   }
+}
+
+bool PhysicsSystem::updateSleep(float timeStep, PhysicsComponent& body) const
+{
+   const float speedSquared = body.dx * body.dx + body.dy * body.dy;
+   const bool accelerating = body.accelerationX != 0.0f || body.accelerationY != 0.0f;
+   if (accelerating || speedSquared > sleepVelocity * sleepVelocity)
+   {
+      body.sleepTime = 0.0f;
+      return false;
+   }
+
+   body.sleepTime += timeStep;
+   if (body.sleepTime < timeToSleep)
+   {
+      return false;
+   }
+
+   // Resting bodies stop drifting once they are asleep
+   body.sleeping = true;
+   body.dx = 0.0f;
+   body.dy = 0.0f;
+   return true;
+}
@@ -3,19 +3,91 @@
 // Copyright (c) Zachary Duncan - Duncandoit
 // 08/20/2024
 
-#include <iostream>
-
 #include "korin/systems/render_system.h"
 #include "korin/log.h"
 #include "korin/util/assert.h"
 
 using namespace korin;
 
+RenderSystem::RenderSystem()
+   : view({0.0f, 0.0f, 32.0f}), m_Backend(RenderBackend::createPlatformBackend()), m_RenderThread(nullptr), m_Batcher()
+{
+}
+
+void RenderSystem::setBackend(std::unique_ptr<RenderBackend> backend)
+{
+   m_RenderThread.reset();
+   m_Backend = std::move(backend);
+}
+
+RenderBackend* RenderSystem::backend() const
+{
+   return m_RenderThread ? &m_RenderThread->backend() : m_Backend.get();
+}
+
+bool RenderSystem::startRenderThread()
+{
+   if (m_RenderThread || !m_Backend)
+   {
+      KORIN_CORE_WARN("The render thread needs a backend and can only be started once.");
+      return false;
+   }
+
+   m_RenderThread = std::make_unique<RenderThread>(std::move(m_Backend));
+   return m_RenderThread->start();
+}
+
+void RenderSystem::stopRenderThread()
+{
+   if (m_RenderThread)
+   {
+      m_Backend = m_RenderThread->releaseBackend();
+      m_RenderThread.reset();
+   }
+}
+
 void RenderSystem::update(float timeStep, const ComponentPtr& component)
 {
-   KORIN_ASSERT(component->typeID() == Component::typeID<TransformComponent>());
-   auto transform = std::static_pointer_cast<TransformComponent>(component);
+   KORIN_ASSERT(component->typeID() == Component::typeID<SpriteComponent>());
+   updateBatch(timeStep, {component});
+}
+
+AABB RenderSystem::visibleArea() const
+{
+   // The size never changes, so reading it while the render thread draws is safe
+   const RenderBackend* target = backend();
+   KORIN_ASSERT(target && view.pixelsPerUnit > 0.0f);
+   const float halfWidth = 0.5f * static_cast<float>(target->width()) / view.pixelsPerUnit;
+   const float halfHeight = 0.5f * static_cast<float>(target->height()) / view.pixelsPerUnit;
+   return AABB(view.centerX - halfWidth, view.centerY - halfHeight, view.centerX + halfWidth, view.centerY + halfHeight);
+}
+
+void RenderSystem::updateBatch(float timeStep, const std::vector<ComponentPtr>& components)
+{
+   // Without a backend there is no screen to cull against
+   if (!backend())
+   {
+      m_Batcher.build(components);
+      return;
+   }
+
+   m_Batcher.build(components, visibleArea());
+
+   // Dropping the frame when the render thread is behind keeps the simulation from waiting on it
+   if (m_RenderThread)
+   {
+      RenderCommandBuffer* frame = m_RenderThread->acquireFrame();
+      if (frame)
+      {
+         frame->beginFrame(view);
+         m_Batcher.submit(*frame);
+         frame->endFrame();
+         m_RenderThread->submitFrame(frame);
+      }
+      return;
+   }
 
-   KORIN_CORE_INFO("Entity Position X:{0}", transform->x);
-   KORIN_CORE_INFO("Entity Position Y:{0}", transform->y);
-}
\ No newline at end of file
+   m_Backend->beginFrame(view);
+   m_Batcher.submit(*m_Backend);
+   m_Backend->endFrame();
+}
@@ -0,0 +1,58 @@
+// spatial_query_system.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+
+#include "korin/systems/spatial_query_system.h"
+#include "korin/components/transform_component.h"
+#include "korin/log.h"
+#include "korin/util/assert.h"
+
+using namespace korin;
+
+void SpatialQuerySystem::update(float timeStep, const ComponentPtr& component)
+{
+   KORIN_ASSERT(component->typeID() == Component::typeID<BoundsComponent>());
+   index(*std::static_pointer_cast<BoundsComponent>(component));
+}
+
+void SpatialQuerySystem::updateBatch(float timeStep, const std::vector<ComponentPtr>& components)
+{
+   m_Present.clear();
+   for (const auto& component : components)
+   {
+      KORIN_ASSERT(component->typeID() == Component::typeID<BoundsComponent>());
+      const auto& bounds = static_cast<const BoundsComponent&>(*component);
+      if (index(bounds))
+      {
+         m_Present.push_back(bounds.entityID());
+      }
+   }
+
+   // Drop entities whose bounds or transform were removed since the last batch
+   std::sort(m_Present.begin(), m_Present.end());
+   for (EntityID entityID : m_Tracked)
+   {
+      if (!std::binary_search(m_Present.begin(), m_Present.end(), entityID))
+      {
+         m_Grid.remove(entityID);
+      }
+   }
+   m_Tracked.swap(m_Present);
+}
+
+bool SpatialQuerySystem::index(const BoundsComponent& bounds)
+{
+   auto transform = bounds.sibling<TransformComponent>().lock();
+   if (!transform)
+   {
+      KORIN_CORE_WARN("TransformComponent not found");
+      return false;
+   }
+
+   // The grid only re-buckets the entity when the cells it covers changed
+   m_Grid.update(bounds.entityID(), bounds.worldBounds(*transform));
+   return true;
+}
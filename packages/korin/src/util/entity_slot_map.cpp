@@ -0,0 +1,65 @@
+// entity_slot_map.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/util/entity_slot_map.h"
+
+using namespace korin;
+
+EntitySlotMap::EntitySlotMap()
+   : m_Slots(std::unordered_map<EntityID, std::uint32_t>()), m_Entities(std::vector<EntityID>())
+   , m_FreeSlots(std::vector<std::uint32_t>())
+{
+}
+
+std::uint32_t EntitySlotMap::find(EntityID entityID) const
+{
+   const auto slotIt = m_Slots.find(entityID);
+   return slotIt == m_Slots.end() ? NO_SLOT : slotIt->second;
+}
+
+std::uint32_t EntitySlotMap::assign(EntityID entityID)
+{
+   const auto slotIt = m_Slots.find(entityID);
+   if (slotIt != m_Slots.end())
+   {
+      return slotIt->second;
+   }
+
+   std::uint32_t slot = 0;
+   if (m_FreeSlots.empty())
+   {
+      slot = static_cast<std::uint32_t>(m_Entities.size());
+      m_Entities.push_back(entityID);
+   }
+   else
+   {
+      slot = m_FreeSlots.back();
+      m_FreeSlots.pop_back();
+      m_Entities[slot] = entityID;
+   }
+
+   m_Slots.emplace(entityID, slot);
+   return slot;
+}
+
+void EntitySlotMap::release(EntityID entityID)
+{
+   const auto slotIt = m_Slots.find(entityID);
+   if (slotIt == m_Slots.end())
+   {
+      return;
+   }
+
+   m_Entities[slotIt->second] = INVALID_ENTITY_ID;
+   m_FreeSlots.push_back(slotIt->second);
+   m_Slots.erase(slotIt);
+}
+
+void EntitySlotMap::clear()
+{
+   m_Slots.clear();
+   m_Entities.clear();
+   m_FreeSlots.clear();
+}
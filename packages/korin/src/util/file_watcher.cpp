@@ -0,0 +1,66 @@
+// file_watcher.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+
+#include "korin/util/file_watcher.h"
+
+using namespace korin;
+
+FileWatcher::FileWatcher()
+   : m_Files(std::vector<WatchedFile>())
+{
+}
+
+void FileWatcher::watch(const std::string& path, Callback onChanged)
+{
+   unwatch(path);
+
+   WatchedFile file = {path, std::move(onChanged), std::filesystem::file_time_type(), 0};
+   stamp(path, file.modified, file.size);
+   m_Files.push_back(std::move(file));
+}
+
+void FileWatcher::unwatch(const std::string& path)
+{
+   m_Files.erase(std::remove_if(m_Files.begin(), m_Files.end(),
+      [&path](const WatchedFile& file) { return file.path == path; }), m_Files.end());
+}
+
+std::size_t FileWatcher::poll()
+{
+   // Callbacks may watch or unwatch files, so the changes are gathered first
+   std::vector<std::pair<std::string, Callback>> changed;
+   for (WatchedFile& file : m_Files)
+   {
+      std::filesystem::file_time_type modified;
+      std::uintmax_t size = 0;
+      if (stamp(file.path, modified, size) && (modified != file.modified || size != file.size))
+      {
+         file.modified = modified;
+         file.size = size;
+         changed.push_back({file.path, file.onChanged});
+      }
+   }
+
+   for (const auto& file : changed)
+   {
+      file.second(file.first);
+   }
+   return changed.size();
+}
+
+bool FileWatcher::stamp(const std::string& path, std::filesystem::file_time_type& modified, std::uintmax_t& size)
+{
+   std::error_code error;
+   modified = std::filesystem::last_write_time(path, error);
+   if (error)
+   {
+      return false;
+   }
+
+   size = std::filesystem::file_size(path, error);
+   return !error;
+}
@@ -0,0 +1,111 @@
+// mapped_file.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#if defined(KORIN_PLATFORM_WINDOWS)
+   #include <windows.h>
+#else
+   #include <fcntl.h>
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <unistd.h>
+#endif
+
+#include "korin/util/mapped_file.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+MappedFile::MappedFile()
+   : m_Data(nullptr), m_Size(0), m_Mapping(nullptr)
+{
+}
+
+MappedFile::~MappedFile()
+{
+   close();
+}
+
+bool MappedFile::open(const std::string& path)
+{
+   close();
+
+#if defined(KORIN_PLATFORM_WINDOWS)
+   HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+   if (file == INVALID_HANDLE_VALUE)
+   {
+      KORIN_CORE_WARN("Could not open " + path + ".");
+      return false;
+   }
+
+   LARGE_INTEGER fileSize;
+   GetFileSizeEx(file, &fileSize);
+   HANDLE mapping = fileSize.QuadPart > 0 ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+   CloseHandle(file);
+   if (!mapping)
+   {
+      KORIN_CORE_WARN("Could not map " + path + ".");
+      return false;
+   }
+
+   m_Mapping = mapping;
+   m_Size = static_cast<std::size_t>(fileSize.QuadPart);
+   m_Data = static_cast<const std::uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+   if (!m_Data)
+   {
+      KORIN_CORE_WARN("Could not map " + path + ".");
+      close();
+      return false;
+   }
+#else
+   const int fileDescriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+   if (fileDescriptor < 0)
+   {
+      KORIN_CORE_WARN("Could not open " + path + ".");
+      return false;
+   }
+
+   struct stat status = {};
+   void* mapped = MAP_FAILED;
+   if (fstat(fileDescriptor, &status) == 0 && status.st_size > 0)
+   {
+      mapped = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+   }
+
+   // The mapping keeps the file alive on its own
+   ::close(fileDescriptor);
+   if (mapped == MAP_FAILED)
+   {
+      KORIN_CORE_WARN("Could not map " + path + ".");
+      return false;
+   }
+
+   m_Size = static_cast<std::size_t>(status.st_size);
+   m_Data = static_cast<const std::uint8_t*>(mapped);
+#endif
+   return true;
+}
+
+void MappedFile::close()
+{
+#if defined(KORIN_PLATFORM_WINDOWS)
+   if (m_Data)
+   {
+      UnmapViewOfFile(m_Data);
+   }
+   if (m_Mapping)
+   {
+      CloseHandle(static_cast<HANDLE>(m_Mapping));
+   }
+#else
+   if (m_Data)
+   {
+      munmap(const_cast<std::uint8_t*>(m_Data), m_Size);
+   }
+#endif
+
+   m_Data = nullptr;
+   m_Size = 0;
+   m_Mapping = nullptr;
+}
@@ -0,0 +1,58 @@
+// string_id.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/util/string_id.h"
+#include "korin/log.h"
+
+using namespace korin;
+
+namespace
+{
+const std::string EMPTY_STRING;
+} // namespace
+
+StringID StringID::intern(std::string_view string)
+{
+   return StringTable::instance().intern(string);
+}
+
+const std::string& StringID::str() const
+{
+   return StringTable::instance().find(*this);
+}
+
+StringTable::StringTable()
+   : m_Strings(std::unordered_map<std::uint32_t, std::string>())
+{
+}
+
+StringID StringTable::intern(std::string_view string)
+{
+   const StringID id(string);
+   std::lock_guard<std::mutex> lock(m_Mutex);
+   const auto stringIt = m_Strings.find(id.value());
+   if (stringIt == m_Strings.end())
+   {
+      m_Strings.emplace(id.value(), std::string(string));
+   }
+   else if (stringIt->second != string)
+   {
+      KORIN_CORE_WARN("String IDs of " + stringIt->second + " and " + std::string(string) + " collide.");
+   }
+   return id;
+}
+
+const std::string& StringTable::find(StringID id) const
+{
+   std::lock_guard<std::mutex> lock(m_Mutex);
+   const auto stringIt = m_Strings.find(id.value());
+   return stringIt == m_Strings.end() ? EMPTY_STRING : stringIt->second;
+}
+
+std::size_t StringTable::size() const
+{
+   std::lock_guard<std::mutex> lock(m_Mutex);
+   return m_Strings.size();
+}
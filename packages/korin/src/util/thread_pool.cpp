@@ -0,0 +1,137 @@
+// thread_pool.cpp
+//
+// Copyright (c) Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+
+#include "korin/util/thread_pool.h"
+
+using namespace korin;
+
+ThreadPool::ThreadPool(std::size_t workerCount)
+   : m_Workers(std::vector<std::thread>()), m_Jobs(std::deque<std::function<void()>>()), m_Stopping(false)
+{
+   m_Workers.reserve(workerCount);
+   for (std::size_t i = 0; i < workerCount; i++)
+   {
+      m_Workers.emplace_back(&ThreadPool::workerLoop, this);
+   }
+}
+
+ThreadPool::~ThreadPool()
+{
+   {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Stopping = true;
+   }
+
+   m_JobAvailable.notify_all();
+   for (auto& worker : m_Workers)
+   {
+      worker.join();
+   }
+}
+
+void ThreadPool::enqueue(std::function<void()> job)
+{
+   if (m_Workers.empty())
+   {
+      job();
+      return;
+   }
+
+   {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Jobs.push_back(std::move(job));
+   }
+
+   m_JobAvailable.notify_one();
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t begin, std::size_t end)>& job)
+{
+   if (count == 0)
+   {
+      return;
+   }
+
+   const std::size_t rangeCount = std::min(count, m_Workers.size() + 1);
+   if (rangeCount == 1)
+   {
+      job(0, count);
+      return;
+   }
+
+   const std::size_t rangeSize = (count + rangeCount - 1) / rangeCount;
+   std::atomic<std::size_t> remaining(rangeCount - 1);
+
+   for (std::size_t range = 1; range < rangeCount; range++)
+   {
+      const std::size_t begin = range * rangeSize;
+      const std::size_t end = std::min(count, begin + rangeSize);
+      enqueue([&job, &remaining, begin, end]()
+      {
+         if (begin < end)
+         {
+            job(begin, end);
+         }
+         remaining.fetch_sub(1, std::memory_order_release);
+      });
+   }
+
+   // The calling thread takes the first range, then helps with whatever is queued
+   job(0, std::min(count, rangeSize));
+   while (remaining.load(std::memory_order_acquire) > 0)
+   {
+      if (!runPendingJob())
+      {
+         std::this_thread::yield();
+      }
+   }
+}
+
+std::size_t ThreadPool::defaultWorkerCount()
+{
+   const std::size_t hardwareThreads = std::thread::hardware_concurrency();
+   return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+void ThreadPool::workerLoop()
+{
+   while (true)
+   {
+      std::function<void()> job;
+      {
+         std::unique_lock<std::mutex> lock(m_Mutex);
+         m_JobAvailable.wait(lock, [this]() { return m_Stopping || !m_Jobs.empty(); });
+         if (m_Stopping && m_Jobs.empty())
+         {
+            return;
+         }
+
+         job = std::move(m_Jobs.front());
+         m_Jobs.pop_front();
+      }
+
+      job();
+   }
+}
+
+bool ThreadPool::runPendingJob()
+{
+   std::function<void()> job;
+   {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      if (m_Jobs.empty())
+      {
+         return false;
+      }
+
+      job = std::move(m_Jobs.front());
+      m_Jobs.pop_front();
+   }
+
+   job();
+   return true;
+}
@@ -93,4 +93,66 @@ project 'sandbox' do
     filter {'system:macosx', 'configurations:release'} do
         buildoptions {'-flto=full'}
     end
-end
\ No newline at end of file
+
+    filter {'system:linux'} do
+        defines {'KORIN_PLATFORM_LINUX'}
+        linkoptions
+        {
+            '-Wl,-rpath,' .. KORIN_DIR .. TARGET_DIR -- RPATH for dynamic linking
+        }
+        links
+        {
+            'pthread',
+        }
+    end
+end
+
+-- The system module test_hot_reload swaps in a running world, built once per step so
+-- there are two different builds to swap between
+for _, variant in ipairs({{name = 'slide_module', step = '1.0f'}, {name = 'slide_module_fast', step = '10.0f'}}) do
+    project (variant.name) do
+        kind 'SharedLib'
+        language 'C++'
+        cppdialect 'C++17'
+        toolset 'clang'
+        location '.'
+        targetdir (SANDBOX_DIR .. TARGET_DIR)
+        objdir (SANDBOX_DIR .. '/build/%{cfg.system}/obj/%{cfg.buildcfg}/' .. variant.name)
+        files
+        {
+            SANDBOX_DIR .. '/tests/modules/slide_module.cpp'
+        }
+        includedirs
+        {
+            KORIN_DIR .. '/include',                                 -- libkorin
+            KORIN_DIR .. '/dependencies/submodules/spdlog/include'   -- spdlog
+        }
+        libdirs {
+            KORIN_DIR .. TARGET_DIR,                               -- libkorin
+        }
+        links
+        {
+            'korin',                     -- The same korin library as the game that loads it
+        }
+        buildoptions
+        {
+            "-Wall",                     -- Enable all warnings
+            "-fno-rtti",                 -- Disable RTTI
+            "-Werror=format",            -- Treat format errors as errors
+            "-Werror=vla"                -- Treat variable length arrays as errors
+        }
+        defines
+        {
+            'SLIDE_MODULE_STEP=' .. variant.step,
+        }
+
+        filter {'system:macosx'} do
+            defines {'KORIN_PLATFORM_MACOSX'}
+        end
+
+        filter {'system:linux'} do
+            defines {'KORIN_PLATFORM_LINUX'}
+            buildoptions {'-fPIC'}
+        end
+    end
+end
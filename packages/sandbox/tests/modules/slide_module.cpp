@@ -0,0 +1,42 @@
+// slide_module.cpp
+//
+// A system module for test_hot_reload. It is built twice with a different
+// SLIDE_MODULE_STEP, so the test can swap one build for the other in a running world.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <memory>
+#include <vector>
+
+#include "korin/reload/system_module.h"
+#include "korin/components/transform_component.h"
+
+#ifndef SLIDE_MODULE_STEP
+#define SLIDE_MODULE_STEP 1.0f
+#endif
+
+namespace
+{
+/// Moves every transform right by the step of the build, once per update
+class SlideSystem : public korin::System
+{
+public:
+   virtual korin::ComponentTypeID primaryComponentTypeID() const override
+   {
+      return korin::Component::typeID<korin::TransformComponent>();
+   }
+
+   virtual void notify(const korin::ComponentPtr& component) override {}
+
+   virtual void update(float timeStep, const korin::ComponentPtr& component) override
+   {
+      static_cast<korin::TransformComponent*>(component.get())->x += SLIDE_MODULE_STEP;
+   }
+};
+} // namespace
+
+KORIN_MODULE_EXPORT void korinCreateSystems(std::vector<korin::ModuleSystem>& systems)
+{
+   systems.push_back({std::make_shared<SlideSystem>(), {"Slide", korin::SystemPhase::Simulation, {}, {}}});
+}
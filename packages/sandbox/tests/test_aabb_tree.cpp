@@ -0,0 +1,121 @@
+// test_aabb_tree.cpp
+//
+// This file contains unit tests for the AABBTree class.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "korin/spatial/aabb_tree.h"
+#include "korin/math/aabb.h"
+#include "korin/math/vector2d.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+korin::AABB boxFor(korin::EntityID id, float offset)
+{
+   const float x = static_cast<float>((id * 37) % 100) + offset;
+   const float y = static_cast<float>((id * 91) % 100);
+   const float extent = 0.5f + static_cast<float>(id % 4);
+   return korin::AABB(x, y, x + extent, y + extent);
+}
+
+std::vector<korin::EntityID> bruteForceQuery(const std::vector<korin::AABB>& boxes, const korin::AABB& region)
+{
+   std::vector<korin::EntityID> results;
+   for (korin::EntityID id = 0; id < boxes.size(); id++)
+   {
+      if (boxes[id].intersects(region))
+      {
+         results.push_back(id);
+      }
+   }
+   return results;
+}
+} // namespace
+
+void test_aabb_tree() {
+   korin::AABBTree tree;
+   KORIN_ASSERT(tree.height() == -1);
+
+   // Test createProxy() keeps the tree balanced
+   std::vector<korin::AABB> boxes;
+   std::vector<korin::ProxyID> proxies;
+   for (korin::EntityID id = 0; id < 500; id++)
+   {
+      boxes.push_back(boxFor(id, 0.0f));
+      proxies.push_back(tree.createProxy(id, boxes.back()));
+   }
+   tree.validate();
+   KORIN_ASSERT(tree.size() == 500);
+   KORIN_ASSERT(tree.maxBalance() <= 1);
+   KORIN_ASSERT(tree.height() <= 2 * static_cast<int>(std::ceil(std::log2(500.0f))));
+
+   // Test query() against brute force
+   const korin::AABB region(20.0f, 20.0f, 45.0f, 60.0f);
+   std::vector<korin::EntityID> results;
+   tree.query(region, results);
+   std::sort(results.begin(), results.end());
+   KORIN_ASSERT(results == bruteForceQuery(boxes, region));
+
+   // Test moveProxy() only re-inserts when the bounds leave the fat bounds
+   const korin::AABB nudged(boxes[0].minX + 0.01f, boxes[0].minY, boxes[0].maxX + 0.01f, boxes[0].maxY);
+   KORIN_ASSERT(!tree.moveProxy(proxies[0], nudged, korin::Vector2D(0.01f, 0.0f)));
+   boxes[0] = nudged;
+
+   for (korin::EntityID id = 0; id < 500; id += 3)
+   {
+      boxes[id] = boxFor(id, 7.0f);
+      tree.moveProxy(proxies[id], boxes[id], korin::Vector2D(7.0f, 0.0f));
+   }
+   tree.validate();
+   KORIN_ASSERT(tree.maxBalance() <= 1);
+
+   results.clear();
+   tree.query(region, results);
+   std::sort(results.begin(), results.end());
+   KORIN_ASSERT(results == bruteForceQuery(boxes, region));
+
+   // Test raycast() finds the closest hit
+   korin::AABBTree rayTree;
+   rayTree.createProxy(1, korin::AABB(5.0f, -1.0f, 6.0f, 1.0f));
+   rayTree.createProxy(2, korin::AABB(2.0f, -1.0f, 3.0f, 1.0f));
+   rayTree.createProxy(3, korin::AABB(2.0f, 5.0f, 3.0f, 6.0f));
+
+   korin::RaycastHit hit;
+   KORIN_ASSERT(rayTree.raycast(korin::Vector2D(0.0f, 0.0f), korin::Vector2D(10.0f, 0.0f), hit));
+   KORIN_ASSERT(hit.entityID == 2);
+   KORIN_ASSERT(std::fabs(hit.fraction - 0.2f) < 0.0001f);
+   KORIN_ASSERT(hit.normal == korin::Vector2D(-1.0f, 0.0f));
+
+   KORIN_ASSERT(!rayTree.raycast(korin::Vector2D(0.0f, 3.0f), korin::Vector2D(10.0f, 3.0f), hit));
+
+   // Test raycastAll()
+   std::vector<korin::RaycastHit> hits;
+   rayTree.raycastAll(korin::Vector2D(0.0f, 0.0f), korin::Vector2D(10.0f, 0.0f), hits);
+   KORIN_ASSERT(hits.size() == 2);
+
+   // Test destroyProxy() frees every node
+   for (const korin::ProxyID proxyID : proxies)
+   {
+      tree.destroyProxy(proxyID);
+   }
+   tree.validate();
+   KORIN_ASSERT(tree.size() == 0);
+   KORIN_ASSERT(tree.height() == -1);
+}
+
+int main() {
+   korin::Log::init();
+
+   test_aabb_tree();
+
+   KORIN_INFO("AABBTree tests passed!");
+
+   return 0;
+}
@@ -0,0 +1,102 @@
+// test_action_mask.cpp
+//
+// This file contains unit tests for the ActionMask edge evaluation and 64 bit action states.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "korin/input/action_mask.h"
+#include "korin/input/action_state_machine.h"
+#include "korin/components/input_stream_component.h"
+#include "korin/systems/game_input_system.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+// An action past the 32 bits the masks used to be truncated to
+constexpr korin::ActionMask HIGH_ACTION = 1ULL << 50;
+} // namespace
+
+void test_compute_action_edges() {
+   std::mt19937_64 random(7);
+
+   // Odd counts exercise the scalar remainder after the SIMD loop
+   for (std::size_t count = 0; count < 10; count++)
+   {
+      std::vector<korin::ActionMask> previous(count), current(count), pressed(count), released(count);
+      for (std::size_t i = 0; i < count; i++)
+      {
+         previous[i] = random();
+         current[i] = random();
+         pressed[i] = random() & random();
+         released[i] = random() & random();
+      }
+
+      std::vector<korin::ActionMask> begun(count, ~0ULL), ended(count, ~0ULL);
+      korin::computeActionEdges(count, previous.data(), current.data(), pressed.data(), released.data(), begun.data(), ended.data());
+
+      for (std::size_t i = 0; i < count; i++)
+      {
+         const korin::ActionMask changes = current[i] ^ previous[i];
+         KORIN_ASSERT(begun[i] == ((changes & current[i]) | pressed[i]));
+         KORIN_ASSERT(ended[i] == ((changes & ~current[i]) | (released[i] & ~current[i])));
+      }
+   }
+}
+
+void test_batch_action_states() {
+   korin::GameInputSystem inputSystem;
+   inputSystem.setBackend(nullptr);
+
+   std::vector<korin::ComponentPtr> streams;
+   std::vector<std::shared_ptr<korin::InputStreamComponent>> external;
+   for (std::size_t i = 0; i < 5; i++)
+   {
+      auto stream = std::make_shared<korin::InputStreamComponent>();
+      stream->source = korin::InputSource::External;
+      external.push_back(stream);
+      streams.push_back(stream);
+   }
+
+   // High actions survive the trip through the batch without being truncated
+   external[0]->externalActionStates = HIGH_ACTION;
+   external[3]->externalActionStates = HIGH_ACTION | korin::toMask(korin::GameAction::Jump);
+   inputSystem.updateBatch(0.016f, streams);
+
+   KORIN_ASSERT(external[0]->currentActionStates == HIGH_ACTION);
+   KORIN_ASSERT(external[0]->actionsBegun == HIGH_ACTION);
+   KORIN_ASSERT(external[1]->actionsBegun == 0);
+   KORIN_ASSERT(external[3]->actionsBegun == (HIGH_ACTION | korin::toMask(korin::GameAction::Jump)));
+
+   external[0]->externalActionStates = 0;
+   external[3]->externalActionStates = HIGH_ACTION;
+   inputSystem.updateBatch(0.016f, streams);
+
+   KORIN_ASSERT(external[0]->previousActionStates == HIGH_ACTION);
+   KORIN_ASSERT(external[0]->actionsEnded == HIGH_ACTION);
+   KORIN_ASSERT(external[3]->actionsBegun == 0);
+   KORIN_ASSERT(external[3]->actionsEnded == korin::toMask(korin::GameAction::Jump));
+   KORIN_ASSERT(korin::hasAction(external[3]->currentActionStates, static_cast<korin::GameAction>(HIGH_ACTION)));
+
+   // The hold counters have a lane for every bit of the mask
+   inputSystem.actionStateMachine().holdTicks = 4;
+   for (std::size_t tick = 0; tick < 3; tick++)
+   {
+      inputSystem.updateBatch(0.016f, streams);
+   }
+   KORIN_ASSERT(korin::ActionStateMachine::heldTicks(*external[3], static_cast<korin::GameAction>(HIGH_ACTION)) == 5);
+   KORIN_ASSERT(external[3]->actionsHeld == HIGH_ACTION);
+}
+
+int main() {
+   korin::Log::init();
+   test_compute_action_edges();
+   test_batch_action_states();
+   KORIN_INFO("ActionMask tests passed!");
+   return 0;
+}
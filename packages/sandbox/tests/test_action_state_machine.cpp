@@ -0,0 +1,216 @@
+// test_action_state_machine.cpp
+//
+// This file contains unit tests for the ActionStateMachine holds, double taps and combos.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <memory>
+#include <vector>
+
+#include "korin/input/action_state_machine.h"
+#include "korin/components/input_stream_component.h"
+#include "korin/systems/game_input_system.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+korin::ActionMask bit(korin::GameAction action)
+{
+   return korin::toMask(action);
+}
+
+// Advances the stream one tick with the given actions held
+void step(const korin::ActionStateMachine& machine, korin::InputStreamComponent& stream, korin::ActionMask current)
+{
+   stream.previousActionStates = stream.currentActionStates;
+   stream.currentActionStates = current;
+   stream.actionsBegun = current & ~stream.previousActionStates;
+   stream.actionsEnded = stream.previousActionStates & ~current;
+   machine.evaluate(stream);
+}
+} // namespace
+
+void test_holds() {
+   korin::ActionStateMachine machine;
+   machine.holdTicks = 3;
+   korin::InputStreamComponent stream;
+   const korin::ActionMask jump = bit(korin::GameAction::Jump);
+   const korin::ActionMask crouch = bit(korin::GameAction::Crouch);
+
+   // Test the hold begins on exactly the hold tick and stays held
+   step(machine, stream, jump);
+   step(machine, stream, jump | crouch);
+   KORIN_ASSERT(stream.actionsHeld == 0 && stream.actionsHoldBegun == 0);
+   step(machine, stream, jump | crouch);
+   KORIN_ASSERT(stream.actionsHoldBegun == jump && stream.actionsHeld == jump);
+   step(machine, stream, jump | crouch);
+   KORIN_ASSERT(stream.actionsHoldBegun == crouch && stream.actionsHeld == (jump | crouch));
+   KORIN_ASSERT(korin::ActionStateMachine::heldTicks(stream, korin::GameAction::Jump) == 4);
+   KORIN_ASSERT(korin::ActionStateMachine::heldTicks(stream, korin::GameAction::Crouch) == 3);
+
+   // Test releasing ends the hold and resets the counter
+   step(machine, stream, crouch);
+   KORIN_ASSERT(stream.actionsHeld == crouch);
+   KORIN_ASSERT(korin::ActionStateMachine::heldTicks(stream, korin::GameAction::Jump) == 0);
+
+   // Test the counter stops at its maximum instead of wrapping
+   for (int i = 0; i < 400; i++)
+   {
+      step(machine, stream, crouch);
+   }
+   KORIN_ASSERT(korin::ActionStateMachine::heldTicks(stream, korin::GameAction::Crouch) == 255);
+   KORIN_ASSERT(stream.actionsHeld == crouch && stream.actionsHoldBegun == 0);
+
+   // Test a hold longer than the counter can count begins once, on the last tick it can
+   machine.holdTicks = 1000;
+   step(machine, stream, 0);
+   int holdsBegun = 0;
+   for (int i = 0; i < 400; i++)
+   {
+      step(machine, stream, jump);
+      if (stream.actionsHoldBegun == jump)
+      {
+         holdsBegun++;
+         KORIN_ASSERT(korin::ActionStateMachine::heldTicks(stream, korin::GameAction::Jump) == 254);
+      }
+   }
+   KORIN_ASSERT(holdsBegun == 1 && stream.actionsHeld == jump);
+}
+
+void test_double_taps() {
+   korin::ActionStateMachine machine;
+   machine.doubleTapTicks = 4;
+   korin::InputStreamComponent stream;
+   const korin::ActionMask sprint = bit(korin::GameAction::Sprint);
+
+   // Test a second press inside the window double taps
+   step(machine, stream, sprint);
+   step(machine, stream, 0);
+   step(machine, stream, 0);
+   step(machine, stream, 0);
+   step(machine, stream, sprint);
+   KORIN_ASSERT(stream.actionsDoubleTapped == sprint);
+
+   // Test a third press doesn't double tap again
+   step(machine, stream, 0);
+   step(machine, stream, sprint);
+   KORIN_ASSERT(stream.actionsDoubleTapped == 0);
+
+   // Test a second press after the window is just a press
+   step(machine, stream, 0);
+   for (int i = 0; i < 4; i++)
+   {
+      step(machine, stream, 0);
+   }
+   step(machine, stream, sprint);
+   KORIN_ASSERT(stream.actionsDoubleTapped == 0);
+   step(machine, stream, 0);
+   step(machine, stream, sprint);
+   KORIN_ASSERT(stream.actionsDoubleTapped == sprint);
+}
+
+void test_combos() {
+   korin::ActionStateMachine machine;
+   machine.comboGapTicks = 5;
+   const std::int32_t hadouken = machine.addCombo({korin::GameAction::Crouch, korin::GameAction::MoveForward, korin::GameAction::PrimaryAbility});
+   const std::int32_t dash = machine.addCombo({korin::GameAction::MoveForward, korin::GameAction::MoveForward});
+   KORIN_ASSERT(hadouken == 0 && dash == 1);
+   korin::InputStreamComponent stream;
+   const korin::ActionMask crouch = bit(korin::GameAction::Crouch);
+   const korin::ActionMask forward = bit(korin::GameAction::MoveForward);
+   const korin::ActionMask primary = bit(korin::GameAction::PrimaryAbility);
+
+   // Test a combo completes on its last step
+   step(machine, stream, crouch);
+   step(machine, stream, 0);
+   step(machine, stream, forward);
+   KORIN_ASSERT(stream.combosCompleted == 0);
+   step(machine, stream, 0);
+   step(machine, stream, primary);
+   KORIN_ASSERT(stream.combosCompleted == (1u << hadouken));
+
+   // Test overlapping combos are matched at the same time
+   step(machine, stream, 0);
+   step(machine, stream, forward);
+   step(machine, stream, 0);
+   step(machine, stream, forward);
+   KORIN_ASSERT(stream.combosCompleted == (1u << dash));
+
+   // Test a wrong step breaks the combo
+   step(machine, stream, 0);
+   step(machine, stream, crouch);
+   step(machine, stream, 0);
+   step(machine, stream, primary);
+   step(machine, stream, 0);
+   step(machine, stream, forward);
+   step(machine, stream, 0);
+   step(machine, stream, primary);
+   KORIN_ASSERT(stream.combosCompleted == 0);
+
+   // Test waiting too long between steps drops the combo
+   step(machine, stream, crouch);
+   for (int i = 0; i < 6; i++)
+   {
+      step(machine, stream, 0);
+   }
+   step(machine, stream, forward);
+   step(machine, stream, 0);
+   step(machine, stream, primary);
+   KORIN_ASSERT(stream.combosCompleted == 0);
+
+   // Test a gap longer than the idle counter can count is clamped so combos still drop
+   machine.comboGapTicks = 1000;
+   KORIN_ASSERT(machine.addCombo({korin::GameAction::Jump, korin::GameAction::Crouch}) == 2);
+   KORIN_ASSERT(machine.comboGapTicks == 254);
+   step(machine, stream, bit(korin::GameAction::Jump));
+   for (int i = 0; i < 300; i++)
+   {
+      step(machine, stream, 0);
+   }
+   step(machine, stream, crouch);
+   KORIN_ASSERT(stream.combosCompleted == 0);
+
+   // Test combos that don't fit are refused
+   KORIN_ASSERT(machine.addCombo({korin::GameAction::Jump}) == -1);
+   KORIN_ASSERT(machine.addCombo({korin::GameAction::Jump, korin::GameAction::Any}) == -1);
+}
+
+void test_batch() {
+   // Test thousands of externally driven streams are evaluated in one pass
+   korin::GameInputSystem inputSystem;
+   inputSystem.setBackend(nullptr);
+   inputSystem.actionStateMachine().holdTicks = 10;
+
+   std::vector<korin::ComponentPtr> streams;
+   for (int i = 0; i < 4096; i++)
+   {
+      auto stream = std::make_shared<korin::InputStreamComponent>();
+      stream->source = korin::InputSource::External;
+      stream->externalActionStates = (i % 2) ? bit(korin::GameAction::MoveLeft) : 0;
+      streams.push_back(stream);
+   }
+
+   for (int tick = 0; tick < 10; tick++)
+   {
+      inputSystem.updateBatch(1.0f / 60.0f, streams);
+   }
+
+   for (int i = 0; i < 4096; i++)
+   {
+      const auto& stream = *std::static_pointer_cast<korin::InputStreamComponent>(streams[i]);
+      KORIN_ASSERT(stream.currentActionStates == stream.externalActionStates);
+      KORIN_ASSERT(stream.actionsHoldBegun == stream.externalActionStates);
+   }
+}
+
+int main() {
+   korin::Log::init();
+   test_holds();
+   test_double_taps();
+   test_combos();
+   test_batch();
+   KORIN_INFO("ActionStateMachine tests passed!");
+   return 0;
+}
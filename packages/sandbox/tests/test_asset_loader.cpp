@@ -0,0 +1,237 @@
+// test_asset_loader.cpp
+//
+// This file contains unit tests for the PackFile, PackWriter and AssetLoader.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "korin/assets/asset_loader.h"
+#include "korin/assets/pack_file.h"
+#include "korin/render/render_backend.h"
+#include "korin/util/thread_pool.h"
+#include "korin/util/byte_stream.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+constexpr const char* PACK_PATH = "test_asset_loader.kpak";
+
+// A striped 32 by 32 image is 4 KB decoded and only a few runs encoded
+std::vector<std::uint32_t> stripes(std::uint32_t color)
+{
+   std::vector<std::uint32_t> pixels(32 * 32);
+   for (std::size_t i = 0; i < pixels.size(); i++)
+   {
+      pixels[i] = (i / 32) % 8 < 4 ? color : korin::rgba(0, 0, 0, 0);
+   }
+   return pixels;
+}
+
+void writePack()
+{
+   korin::PackWriter writer;
+   const char text[] = "spawn 3 crates";
+   writer.add("levels/forest/script", korin::PackBlobType::Raw, text, sizeof(text));
+   writer.addImage("ui/cursor", 32, 32, stripes(korin::WHITE).data());
+   for (int i = 0; i < 8; i++)
+   {
+      writer.addImage("levels/forest/tile" + std::to_string(i), 32, 32,
+         stripes(korin::rgba(static_cast<std::uint8_t>(i * 30), 100, 50)).data(), true);
+   }
+   KORIN_ASSERT(writer.size() == 10);
+   KORIN_ASSERT(writer.write(PACK_PATH));
+}
+} // namespace
+
+void test_pack_file() {
+   writePack();
+   korin::PackFile pack;
+   KORIN_ASSERT(pack.open(PACK_PATH));
+   KORIN_ASSERT(pack.entries().size() == 10);
+   KORIN_ASSERT(pack.find("levels/forest/missing") == korin::PackFile::INVALID_PACK_ENTRY);
+
+   // Blobs are read in place from the mapping, aligned
+   const std::uint32_t script = pack.find("levels/forest/script");
+   KORIN_ASSERT(script != korin::PackFile::INVALID_PACK_ENTRY);
+   KORIN_ASSERT(reinterpret_cast<std::uintptr_t>(pack.data(script)) % korin::PACK_ALIGNMENT == 0);
+   KORIN_ASSERT(std::strcmp(reinterpret_cast<const char*>(pack.data(script)), "spawn 3 crates") == 0);
+   KORIN_ASSERT(pack.data(korin::PackFile::INVALID_PACK_ENTRY) == nullptr);
+
+   // Run length encoding shrinks the tiles
+   const korin::PackEntry& cursor = pack.entries()[pack.find("ui/cursor")];
+   const korin::PackEntry& tile = pack.entries()[pack.find("levels/forest/tile3")];
+   KORIN_ASSERT(cursor.type == korin::PackBlobType::Image && cursor.size == 8 + 32 * 32 * 4);
+   KORIN_ASSERT(tile.type == korin::PackBlobType::RunLengthImage && tile.size < 200);
+   pack.close();
+   KORIN_ASSERT(!pack.isOpen());
+
+   // Files that aren't packs are turned away
+   std::ofstream("test_asset_loader.bad", std::ios::binary) << "not a pack at all, just some text";
+   KORIN_ASSERT(!pack.open("test_asset_loader.bad"));
+   KORIN_ASSERT(!pack.open("test_asset_loader.missing"));
+   std::remove("test_asset_loader.bad");
+
+   // Tables claiming more entries than fit in the file, or out of hash order, are turned away
+   std::ifstream packFile(PACK_PATH, std::ios::binary);
+   const std::vector<std::uint8_t> packBytes((std::istreambuf_iterator<char>(packFile)), std::istreambuf_iterator<char>());
+   std::uint64_t tableOffset = 0;
+   std::memcpy(&tableOffset, packBytes.data() + 16, sizeof(tableOffset));
+
+   std::vector<std::uint8_t> corrupt = packBytes;
+   const std::uint32_t entryCount = 0xFFFFFFFF;
+   std::memcpy(corrupt.data() + 8, &entryCount, sizeof(entryCount));
+   std::ofstream("test_asset_loader.bad", std::ios::binary).write(reinterpret_cast<const char*>(corrupt.data()), 
+      static_cast<std::streamsize>(corrupt.size()));
+   KORIN_ASSERT(!pack.open("test_asset_loader.bad"));
+
+   corrupt = packBytes;
+   std::swap_ranges(corrupt.begin() + static_cast<std::ptrdiff_t>(tableOffset), 
+      corrupt.begin() + static_cast<std::ptrdiff_t>(tableOffset + 32), corrupt.begin() + static_cast<std::ptrdiff_t>(tableOffset + 32));
+   std::ofstream("test_asset_loader.bad", std::ios::binary).write(reinterpret_cast<const char*>(corrupt.data()), 
+      static_cast<std::streamsize>(corrupt.size()));
+   KORIN_ASSERT(!pack.open("test_asset_loader.bad"));
+   std::remove("test_asset_loader.bad");
+}
+
+void test_streaming_and_eviction() {
+   writePack();
+   korin::PackFile pack;
+   KORIN_ASSERT(pack.open(PACK_PATH));
+   korin::ThreadPool threadPool(2);
+
+   // Room for three decoded tiles
+   const std::size_t tileSize = 8 + 32 * 32 * 4;
+   korin::AssetLoader loader(pack, threadPool, 3 * tileSize);
+
+   // Images stored plain are ready at once and cost no budget
+   const std::uint32_t cursor = loader.acquire("ui/cursor");
+   KORIN_ASSERT(loader.state(cursor) == korin::AssetState::Ready && loader.memoryUsed() == 0);
+   korin::AssetData data;
+   korin::ImageView image;
+   KORIN_ASSERT(loader.get(cursor, data) && data.bytes == pack.data(cursor));
+   KORIN_ASSERT(korin::AssetLoader::readImage(data, image) && image.width == 32 && image.pixels[0] == korin::WHITE);
+
+   // Encoded tiles decode in the background
+   std::vector<std::uint32_t> tiles;
+   for (int i = 0; i < 8; i++)
+   {
+      tiles.push_back(loader.acquire("levels/forest/tile" + std::to_string(i)));
+   }
+   KORIN_ASSERT(loader.acquire("levels/forest/missing") == korin::PackFile::INVALID_PACK_ENTRY);
+   loader.finishLoading();
+
+   // Entries past the end of the pack are refused instead of read
+   const std::uint32_t missing = static_cast<std::uint32_t>(pack.entries().size());
+   loader.acquire(missing);
+   loader.release(missing);
+   KORIN_ASSERT(!loader.get(missing, data));
+   KORIN_ASSERT(loader.state(missing) == korin::AssetState::Failed);
+   KORIN_ASSERT(loader.referenceCount(korin::PackFile::INVALID_PACK_ENTRY) == 0);
+
+   for (int i = 0; i < 8; i++)
+   {
+      KORIN_ASSERT(loader.state(tiles[i]) == korin::AssetState::Ready);
+      KORIN_ASSERT(loader.get(tiles[i], data) && korin::AssetLoader::readImage(data, image));
+      KORIN_ASSERT(image.pixels[0] == korin::rgba(static_cast<std::uint8_t>(i * 30), 100, 50));
+      KORIN_ASSERT(image.pixels[32 * 5] == korin::rgba(0, 0, 0, 0));
+   }
+
+   // Referenced assets are kept even over budget
+   KORIN_ASSERT(loader.memoryUsed() == 8 * tileSize && loader.evictionCount() == 0);
+
+   // Releasing evicts the least recently released until back under budget
+   for (int i = 0; i < 8; i++)
+   {
+      loader.release(tiles[i]);
+   }
+   KORIN_ASSERT(loader.evictionCount() == 5 && loader.memoryUsed() == 3 * tileSize);
+   KORIN_ASSERT(loader.state(tiles[4]) == korin::AssetState::Unloaded);
+   KORIN_ASSERT(loader.state(tiles[5]) == korin::AssetState::Ready && loader.state(tiles[7]) == korin::AssetState::Ready);
+
+   // Acquiring a kept asset takes it out of line, so loading another evicts the next oldest
+   loader.acquire(tiles[5]);
+   loader.acquire(tiles[0]);
+   KORIN_ASSERT(loader.state(tiles[0]) == korin::AssetState::Loading);
+   loader.finishLoading();
+   KORIN_ASSERT(loader.state(tiles[0]) == korin::AssetState::Ready && loader.state(tiles[5]) == korin::AssetState::Ready);
+   KORIN_ASSERT(loader.state(tiles[6]) == korin::AssetState::Unloaded && loader.state(tiles[7]) == korin::AssetState::Ready);
+   KORIN_ASSERT(loader.referenceCount(tiles[5]) == 1 && loader.referenceCount(tiles[1]) == 0);
+
+   // A tile released before it finishes decoding is still kept, in line for eviction
+   loader.acquire(tiles[1]);
+   loader.release(tiles[1]);
+   loader.finishLoading();
+   KORIN_ASSERT(loader.state(tiles[1]) == korin::AssetState::Ready);
+   KORIN_ASSERT(loader.state(tiles[7]) == korin::AssetState::Unloaded);
+
+   loader.release(cursor);
+   loader.release(tiles[5]);
+   loader.release(tiles[0]);
+   std::remove(PACK_PATH);
+}
+
+void test_corrupt_images() {
+   const char* path = "test_asset_loader_corrupt.kpak";
+   korin::PackWriter writer;
+
+   // Too short to hold the header
+   const std::uint8_t truncated[] = {32, 0, 0};
+   writer.add("truncated", korin::PackBlobType::RunLengthImage, truncated, sizeof(truncated));
+
+   // Claims far more pixels than it has runs for
+   std::vector<std::uint8_t> huge;
+   korin::ByteWriter hugeWriter(huge);
+   hugeWriter.writeU32(16384);
+   hugeWriter.writeU32(16384);
+   hugeWriter.writeVarint(5);
+   hugeWriter.writeU32(korin::WHITE);
+   writer.add("huge", korin::PackBlobType::RunLengthImage, huge.data(), huge.size());
+
+   // Larger than any texture
+   std::vector<std::uint8_t> wide;
+   korin::ByteWriter wideWriter(wide);
+   wideWriter.writeU32(1u << 20);
+   wideWriter.writeU32(1);
+   wideWriter.writeVarint(1u << 20);
+   wideWriter.writeU32(korin::WHITE);
+   writer.add("wide", korin::PackBlobType::RunLengthImage, wide.data(), wide.size());
+   writer.addImage("good", 32, 32, stripes(korin::WHITE).data(), true);
+   KORIN_ASSERT(writer.write(path));
+
+   korin::PackFile pack;
+   KORIN_ASSERT(pack.open(path));
+   korin::ThreadPool threadPool(2);
+   korin::AssetLoader loader(pack, threadPool, 1 << 20);
+   const std::uint32_t assets[] = {loader.acquire("truncated"), loader.acquire("huge"), loader.acquire("wide"), loader.acquire("good")};
+   loader.finishLoading();
+   KORIN_ASSERT(loader.state(assets[0]) == korin::AssetState::Failed);
+   KORIN_ASSERT(loader.state(assets[1]) == korin::AssetState::Failed);
+   KORIN_ASSERT(loader.state(assets[2]) == korin::AssetState::Failed);
+   KORIN_ASSERT(loader.state(assets[3]) == korin::AssetState::Ready);
+   KORIN_ASSERT(loader.memoryUsed() == 8 + 32 * 32 * 4);
+
+   for (const std::uint32_t asset : assets)
+   {
+      loader.release(asset);
+   }
+   pack.close();
+   std::remove(path);
+}
+
+int main() {
+   korin::Log::init();
+   test_pack_file();
+   test_streaming_and_eviction();
+   test_corrupt_images();
+   KORIN_INFO("Asset loader tests passed!");
+   return 0;
+}
@@ -0,0 +1,159 @@
+// test_asset_registry.cpp
+//
+// This file contains unit tests for the AtlasPacker and AssetRegistry.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <memory>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/assets/asset_registry.h"
+#include "korin/assets/atlas_packer.h"
+#include "korin/systems/render_system.h"
+#include "korin/render/software_render_backend.h"
+#include "korin/components/sprite_component.h"
+#include "korin/components/transform_component.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+std::vector<std::uint32_t> solid(std::uint32_t width, std::uint32_t height, std::uint32_t color)
+{
+   return std::vector<std::uint32_t>(static_cast<std::size_t>(width) * height, color);
+}
+
+// Whether the two rectangles overlap once both are grown by their padding
+bool overlaps(const korin::AtlasPlacement& a, const korin::AtlasRect& aSize, const korin::AtlasPlacement& b, const korin::AtlasRect& bSize, std::uint32_t padding)
+{
+   return a.page == b.page
+      && a.x < b.x + bSize.width + 2 * padding && b.x < a.x + aSize.width + 2 * padding
+      && a.y < b.y + bSize.height + 2 * padding && b.y < a.y + aSize.height + 2 * padding;
+}
+} // namespace
+
+void test_atlas_packer() {
+   std::vector<korin::AtlasRect> rects;
+   for (std::uint32_t i = 0; i < 40; i++)
+   {
+      rects.push_back({4 + (i * 7) % 29, 3 + (i * 11) % 23});
+   }
+
+   korin::AtlasPacker packer(64, 64, 1);
+   std::vector<korin::AtlasPlacement> placements;
+   KORIN_ASSERT(packer.pack(rects, placements));
+   KORIN_ASSERT(placements.size() == rects.size());
+   KORIN_ASSERT(packer.pageCount() > 1);
+
+   for (std::size_t i = 0; i < rects.size(); i++)
+   {
+      // Padding included, every rectangle stays on its page and clear of the others
+      KORIN_ASSERT(placements[i].page < packer.pageCount());
+      KORIN_ASSERT(placements[i].x >= 1 && placements[i].x + rects[i].width + 1 <= 64);
+      KORIN_ASSERT(placements[i].y >= 1 && placements[i].y + rects[i].height + 1 <= 64);
+      for (std::size_t j = i + 1; j < rects.size(); j++)
+      {
+         KORIN_ASSERT(!overlaps(placements[i], rects[i], placements[j], rects[j], 1));
+      }
+   }
+
+   // An image bigger than a page can't be packed
+   KORIN_ASSERT(!packer.pack({{63, 10}}, placements));
+}
+
+void test_assets_share_an_atlas() {
+   korin::AssetRegistry& assets = korin::AssetRegistry::instance();
+   assets.clear();
+
+   const auto red = solid(4, 4, korin::rgba(255, 0, 0));
+   const auto green = solid(8, 2, korin::rgba(0, 255, 0));
+   const auto blue = solid(2, 6, korin::rgba(0, 0, 255));
+   const korin::AssetID redID = assets.addImage("tiles/red", 4, 4, red.data());
+   const korin::AssetID greenID = assets.addImage("tiles/green", 8, 2, green.data());
+   const korin::AssetID blueID = assets.addImage("tiles/blue", 2, 6, blue.data());
+   KORIN_ASSERT(redID == 0 && greenID == 1 && blueID == 2);
+   KORIN_ASSERT(assets.find("tiles/green") == greenID && assets.find("tiles/missing") == korin::INVALID_ASSET_ID);
+   KORIN_ASSERT(assets.sprite(redID) == nullptr);
+   KORIN_ASSERT(assets.handle(greenID) == korin::StringID("tiles/green"));
+   KORIN_ASSERT(assets.handle(korin::INVALID_ASSET_ID) == korin::StringID());
+
+   KORIN_ASSERT(assets.buildAtlas(32, 1));
+   KORIN_ASSERT(assets.pages().size() == 1);
+   const korin::AtlasPage& page = assets.pages().front();
+   KORIN_ASSERT(page.textureID == korin::ATLAS_TEXTURE_ID_BASE);
+
+   // Each rect covers exactly its image, and the padding repeats the image's edge
+   const korin::SpriteAsset* greenSprite = assets.sprite(greenID);
+   KORIN_ASSERT(greenSprite && greenSprite->width == 8 && greenSprite->height == 2);
+   const auto left = static_cast<std::uint32_t>(greenSprite->u0 * 32.0f);
+   const auto top = static_cast<std::uint32_t>(greenSprite->v0 * 32.0f);
+   KORIN_ASSERT(static_cast<std::uint32_t>(greenSprite->u1 * 32.0f) == left + 8);
+   KORIN_ASSERT(static_cast<std::uint32_t>(greenSprite->v1 * 32.0f) == top + 2);
+   KORIN_ASSERT(page.pixels[top * 32 + left] == korin::rgba(0, 255, 0));
+   KORIN_ASSERT(page.pixels[(top - 1) * 32 + left - 1] == korin::rgba(0, 255, 0));
+   KORIN_ASSERT(page.pixels[(top + 2) * 32 + left + 8] == korin::rgba(0, 255, 0));
+
+   // Adding a handle again keeps its ID
+   const auto yellow = solid(4, 4, korin::rgba(255, 255, 0));
+   KORIN_ASSERT(assets.addImage("tiles/red", 4, 4, yellow.data()) == redID);
+   KORIN_ASSERT(assets.size() == 3 && assets.sprite(redID) == nullptr);
+   KORIN_ASSERT(assets.buildAtlas(32, 1) && assets.sprite(redID) != nullptr);
+}
+
+void test_atlas_sprites_draw_in_one_batch() {
+   korin::AssetRegistry& assets = korin::AssetRegistry::instance();
+   assets.clear();
+   const auto red = solid(4, 4, korin::rgba(255, 0, 0));
+   const auto blue = solid(4, 4, korin::rgba(0, 0, 255));
+   assets.addImage("red", 4, 4, red.data());
+   assets.addImage("blue", 4, 4, blue.data());
+   KORIN_ASSERT(assets.buildAtlas(16, 1));
+
+   korin::EntityAdmin world;
+   auto renderSystem = std::make_shared<korin::RenderSystem>();
+   renderSystem->view = {0.0f, 0.0f, 4.0f};
+   auto backend = std::make_unique<korin::SoftwareRenderBackend>(16, 16);
+   korin::SoftwareRenderBackend* software = backend.get();
+   for (const korin::AtlasPage& page : assets.pages())
+   {
+      software->setTexture(page.textureID, page.width, page.height, page.pixels.data());
+   }
+   renderSystem->setBackend(std::move(backend));
+   world.addSystem(renderSystem, {"Render", korin::SystemPhase::Render});
+
+   const korin::StringID handles[2] = {"red", "blue"};
+   for (int i = 0; i < 2; i++)
+   {
+      auto entity = world.createEntity(handles[i]);
+      auto sprite = std::make_shared<korin::SpriteComponent>();
+      sprite->create(entity->getResourceHandle());
+      sprite->width = 2.0f;
+      sprite->height = 2.0f;
+      KORIN_ASSERT(sprite->assetID == assets.find(handles[i]));
+      world.addComponent(entity->entityID(), std::make_shared<korin::TransformComponent>(i == 0 ? -1.0f : 1.0f, 0.0f, 0.0f));
+      world.addComponent(entity->entityID(), sprite);
+   }
+
+   // Two images, one texture, one draw call
+   world.updateFrame(1.0f / 60.0f);
+   KORIN_ASSERT(software->drawCalls() == 1 && software->instancesDrawn() == 2);
+   KORIN_ASSERT(software->pixel(4, 8) == korin::rgba(255, 0, 0));
+   KORIN_ASSERT(software->pixel(11, 8) == korin::rgba(0, 0, 255));
+
+   // Unknown handles leave the sprite as it was
+   korin::SpriteComponent missing;
+   missing.create("missing");
+   KORIN_ASSERT(missing.assetID == korin::INVALID_ASSET_ID && missing.textureID == 0);
+   assets.clear();
+}
+
+int main() {
+   korin::Log::init();
+   test_atlas_packer();
+   test_assets_share_an_atlas();
+   test_atlas_sprites_draw_in_one_batch();
+   KORIN_INFO("Asset registry tests passed!");
+   return 0;
+}
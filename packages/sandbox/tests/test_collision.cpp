@@ -0,0 +1,216 @@
+// test_collision.cpp
+//
+// This file contains unit tests for the narrow phase and the ContactSolver.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/systems/collision_system.h"
+#include "korin/systems/physics_system.h"
+#include "korin/components/collider_component.h"
+#include "korin/components/physics_component.h"
+#include "korin/components/transform_component.h"
+#include "korin/physics/collision.h"
+#include "korin/physics/contact_solver.h"
+#include "korin/math/aabb.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+bool nearlyEqual(float a, float b, float epsilon = 1.0e-4f)
+{
+   return std::fabs(a - b) <= epsilon;
+}
+
+korin::ContactConstraint makeContact(std::uint32_t a, std::uint32_t b, const korin::Manifold& manifold)
+{
+   korin::ContactConstraint contact = {};
+   contact.bodyA = a;
+   contact.bodyB = b;
+   contact.key = (static_cast<std::uint64_t>(a) << 32) | b;
+   contact.manifold = manifold;
+   contact.friction = 0.5f;
+   contact.restitution = 0.0f;
+   return contact;
+}
+
+korin::EntityID addBox(korin::EntityAdmin& world, float x, float y, float halfWidth, bool dynamic)
+{
+   auto entity = world.createEntity("box");
+   world.addComponent(entity->entityID(), std::make_shared<korin::TransformComponent>(x, y, 0.0f));
+   world.addComponent(entity->entityID(), std::make_shared<korin::ColliderComponent>(halfWidth, 0.5f));
+   if (dynamic)
+   {
+      world.addComponent(entity->entityID(), std::make_shared<korin::PhysicsComponent>(0.0f, 0.0f, 0.0f, -10.0f));
+   }
+   return entity->entityID();
+}
+} // namespace
+
+void test_narrow_phase() {
+   korin::Manifold manifold;
+
+   // Test collideAABBs() separates along the shallowest axis with two contact points
+   KORIN_ASSERT(korin::collideAABBs(korin::AABB(0.0f, 0.0f, 2.0f, 2.0f), korin::AABB(1.0f, 1.8f, 3.0f, 3.8f), manifold));
+   KORIN_ASSERT(manifold.normal == korin::Vector2D(0.0f, 1.0f));
+   KORIN_ASSERT(manifold.pointCount == 2);
+   KORIN_ASSERT(nearlyEqual(manifold.penetration(), 0.2f));
+
+   // Test collideAABBs() rejects separated boxes
+   KORIN_ASSERT(!korin::collideAABBs(korin::AABB(0.0f, 0.0f, 1.0f, 1.0f), korin::AABB(1.5f, 0.0f, 2.5f, 1.0f), manifold));
+
+   // Test collideCircles() normal and penetration
+   KORIN_ASSERT(korin::collideCircles({korin::Vector2D(0.0f, 0.0f), 1.0f}, {korin::Vector2D(1.5f, 0.0f), 1.0f}, manifold));
+   KORIN_ASSERT(manifold.normal == korin::Vector2D(1.0f, 0.0f));
+   KORIN_ASSERT(nearlyEqual(manifold.penetration(), 0.5f));
+   KORIN_ASSERT(!korin::collideCircles({korin::Vector2D(0.0f, 0.0f), 1.0f}, {korin::Vector2D(3.0f, 0.0f), 1.0f}, manifold));
+
+   // Test collideCircleAABB() from outside and from inside the box
+   KORIN_ASSERT(korin::collideCircleAABB({korin::Vector2D(0.0f, 2.5f), 1.0f}, korin::AABB(-1.0f, 0.0f, 1.0f, 2.0f), manifold));
+   KORIN_ASSERT(manifold.normal == korin::Vector2D(0.0f, -1.0f));
+   KORIN_ASSERT(nearlyEqual(manifold.penetration(), 0.5f));
+   KORIN_ASSERT(korin::collideCircleAABB({korin::Vector2D(0.9f, 1.0f), 0.5f}, korin::AABB(-1.0f, 0.0f, 1.0f, 2.0f), manifold));
+   KORIN_ASSERT(manifold.normal == korin::Vector2D(-1.0f, 0.0f));
+   KORIN_ASSERT(nearlyEqual(manifold.penetration(), 0.6f));
+
+   // Test sweepAABBs() finds the time of impact of a box moving through a thin wall
+   float timeOfImpact = 0.0f;
+   korin::Vector2D normal;
+   KORIN_ASSERT(korin::sweepAABBs(korin::AABB(0.0f, 0.0f, 1.0f, 1.0f), korin::Vector2D(10.0f, 0.0f), 
+      korin::AABB(5.0f, -1.0f, 5.1f, 2.0f), timeOfImpact, normal));
+   KORIN_ASSERT(nearlyEqual(timeOfImpact, 0.4f));
+   KORIN_ASSERT(normal == korin::Vector2D(-1.0f, 0.0f));
+   KORIN_ASSERT(!korin::sweepAABBs(korin::AABB(0.0f, 0.0f, 1.0f, 1.0f), korin::Vector2D(10.0f, 0.0f), 
+      korin::AABB(5.0f, 3.0f, 5.1f, 4.0f), timeOfImpact, normal));
+}
+
+void test_contact_solver() {
+   korin::ContactSolver solver;
+   korin::Manifold manifold;
+
+   // Test a falling box lands on a static floor without bouncing or sinking
+   std::vector<korin::SolverBody> bodies = {
+      {korin::Vector2D(0.0f, 0.0f), korin::Vector2D(), 0.0f},
+      {korin::Vector2D(0.0f, -5.0f), korin::Vector2D(), 1.0f},
+   };
+   KORIN_ASSERT(korin::collideAABBs(korin::AABB(-5.0f, -1.0f, 5.0f, 0.0f), korin::AABB(-0.5f, -0.1f, 0.5f, 0.9f), manifold));
+   std::vector<korin::ContactConstraint> contacts = {makeContact(0, 1, manifold)};
+   solver.solve(bodies, contacts);
+   KORIN_ASSERT(nearlyEqual(bodies[1].velocity.y, 0.0f));
+   KORIN_ASSERT(bodies[1].positionCorrection.y > 0.0f);
+   KORIN_ASSERT(bodies[0].velocity == korin::Vector2D(0.0f, 0.0f));
+   KORIN_ASSERT(contacts[0].normalImpulse > 0.0f);
+
+   // Test the impulse is warm started from the previous solve of the same pair
+   const float landingImpulse = contacts[0].normalImpulse;
+   bodies[1].velocity = korin::Vector2D(0.0f, 0.0f);
+   contacts[0] = makeContact(0, 1, manifold);
+   solver.velocityIterations = 0;
+   solver.solve(bodies, contacts);
+   KORIN_ASSERT(nearlyEqual(contacts[0].normalImpulse, landingImpulse));
+   solver.velocityIterations = 8;
+
+   // Test forget() clears the cached impulse
+   solver.forget(contacts[0].key);
+   contacts[0] = makeContact(0, 1, manifold);
+   solver.velocityIterations = 0;
+   solver.solve(bodies, contacts);
+   KORIN_ASSERT(contacts[0].normalImpulse == 0.0f);
+   solver.velocityIterations = 8;
+
+   // Test equal bodies colliding head on exchange momentum and split into separate islands from others
+   solver.clearCache();
+   bodies = {
+      {korin::Vector2D(2.0f, 0.0f), korin::Vector2D(), 1.0f},
+      {korin::Vector2D(-2.0f, 0.0f), korin::Vector2D(), 1.0f},
+      {korin::Vector2D(0.0f, 1.0f), korin::Vector2D(), 1.0f},
+      {korin::Vector2D(0.0f, -1.0f), korin::Vector2D(), 1.0f},
+   };
+   korin::Manifold side;
+   KORIN_ASSERT(korin::collideAABBs(korin::AABB(0.0f, 0.0f, 1.0f, 1.0f), korin::AABB(0.9f, 0.0f, 1.9f, 1.0f), side));
+   korin::Manifold stacked;
+   KORIN_ASSERT(korin::collideAABBs(korin::AABB(10.0f, 0.0f, 11.0f, 1.0f), korin::AABB(10.0f, 0.9f, 11.0f, 1.9f), stacked));
+   contacts = {makeContact(0, 1, side), makeContact(2, 3, stacked)};
+   solver.solve(bodies, contacts);
+   KORIN_ASSERT(solver.islandCount() == 2);
+   KORIN_ASSERT(nearlyEqual(bodies[0].velocity.x, 0.0f) && nearlyEqual(bodies[1].velocity.x, 0.0f));
+   KORIN_ASSERT(nearlyEqual(bodies[2].velocity.y, 0.0f) && nearlyEqual(bodies[3].velocity.y, 0.0f));
+   KORIN_ASSERT(bodies[0].positionCorrection.x < 0.0f && bodies[1].positionCorrection.x > 0.0f);
+}
+
+void test_collision_system() {
+   korin::EntityAdmin world;
+   auto collisionSystem = std::make_shared<korin::CollisionSystem>();
+   world.addSystem(std::make_shared<korin::PhysicsSystem>(), {"Physics", korin::SystemPhase::Simulation, {}, {}});
+   world.addSystem(collisionSystem, {"Collision", korin::SystemPhase::Simulation, {"Physics"}, {}});
+
+   // Two boxes resting on a floor each make one contact every tick
+   addBox(world, 0.0f, -0.5f, 10.0f, false);
+   const korin::EntityID left = addBox(world, -2.0f, 0.45f, 0.5f, true);
+   const korin::EntityID right = addBox(world, 2.0f, 0.45f, 0.5f, true);
+   for (int tick = 0; tick < 5; tick++)
+   {
+      world.updateSystems(1.0f / 60.0f);
+      KORIN_ASSERT(collisionSystem->contacts().size() == 2);
+   }
+
+   // Destroying a body while it touches the floor leaves one contact for the pair that is left
+   world.removeEntity(world.entities().at(left));
+   for (int tick = 0; tick < 5; tick++)
+   {
+      world.updateSystems(1.0f / 60.0f);
+      KORIN_ASSERT(collisionSystem->contacts().size() == 1);
+   }
+
+   // A body that loses its physics is static from the next tick and isn't pushed out anymore
+   auto transform = std::static_pointer_cast<korin::TransformComponent>(
+      world.findComponent(right, korin::Component::typeID<korin::TransformComponent>()));
+   transform->y = 0.4f;
+   world.removeComponent(right, korin::Component::typeID<korin::PhysicsComponent>());
+   world.updateSystems(1.0f / 60.0f);
+   KORIN_ASSERT(transform->y == 0.4f && collisionSystem->contacts().empty());
+
+   // Giving it physics again makes it dynamic again
+   world.addComponent(right, std::make_shared<korin::PhysicsComponent>(0.0f, 0.0f, 0.0f, -10.0f));
+   world.updateSystems(1.0f / 60.0f);
+   KORIN_ASSERT(transform->y > 0.4f && collisionSystem->contacts().size() == 1);
+}
+
+void test_swept_collision() {
+   korin::EntityAdmin world;
+   world.addSystem(std::make_shared<korin::PhysicsSystem>(), {"Physics", korin::SystemPhase::Simulation, {}, {}});
+   world.addSystem(std::make_shared<korin::CollisionSystem>(), {"Collision", korin::SystemPhase::Simulation, {"Physics"}, {}});
+
+   // A bullet moving 10 units in one tick passes a wall ahead of it, and touches 
+   // a second wall behind where it started
+   const korin::EntityID bullet = addBox(world, 0.0f, 0.0f, 0.5f, true);
+   addBox(world, 3.0f, 0.0f, 0.5f, false);
+   addBox(world, -1.0f, 0.0f, 0.5f, false);
+   auto physics = std::static_pointer_cast<korin::PhysicsComponent>(
+      world.findComponent(bullet, korin::Component::typeID<korin::PhysicsComponent>()));
+   auto transform = std::static_pointer_cast<korin::TransformComponent>(
+      world.findComponent(bullet, korin::Component::typeID<korin::TransformComponent>()));
+   physics->dx = 600.0f;
+   physics->accelerationY = 0.0f;
+
+   // Test the bullet is moved back once, to the wall ahead, and not behind where it started
+   world.updateSystems(1.0f / 60.0f);
+   KORIN_ASSERT(nearlyEqual(transform->x, 2.0f, 0.05f));
+   KORIN_ASSERT(physics->dx <= 0.0f);
+}
+
+int main() {
+   korin::Log::init();
+   test_narrow_phase();
+   test_contact_solver();
+   test_collision_system();
+   test_swept_collision();
+   KORIN_INFO("Collision tests passed!");
+   return 0;
+}
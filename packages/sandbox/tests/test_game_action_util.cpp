@@ -0,0 +1,83 @@
+// test_game_action_util.cpp
+//
+// This file contains unit tests for the GameActionUtil binding table.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/util/game_action_util.h"
+#include "korin/input/input_event.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+korin::InputState pressed(std::initializer_list<std::uint16_t> codes)
+{
+   korin::InputState state;
+   for (const std::uint16_t code : codes)
+   {
+      state.set(code);
+   }
+   return state;
+}
+
+uint64_t bit(korin::GameAction action)
+{
+   return static_cast<uint64_t>(action);
+}
+} // namespace
+
+void test_game_action_util() {
+   korin::GameActionUtil& actions = korin::GameActionUtil::instance();
+   actions.clearMappings();
+
+   actions.mapInputToAction(13, korin::GameAction::MoveForward);
+   actions.mapInputToAction(126, korin::GameAction::MoveForward);
+   actions.mapInputToAction(49, korin::GameAction::Jump);
+   actions.mapInputToAction(49, korin::GameAction::Confirm);
+   actions.mapInputToAction(1023, korin::GameAction::Menu);
+
+   // Test nothing pressed maps to no actions
+   KORIN_ASSERT(actions.getActionsForInput(korin::InputState()) == 0);
+
+   // Test several keys bound to the same action
+   KORIN_ASSERT(actions.getActionsForInput(pressed({13})) == bit(korin::GameAction::MoveForward));
+   KORIN_ASSERT(actions.getActionsForInput(pressed({126})) == bit(korin::GameAction::MoveForward));
+
+   // Test one key bound to several actions
+   KORIN_ASSERT(actions.getActionsForInput(pressed({49})) == (bit(korin::GameAction::Jump) | bit(korin::GameAction::Confirm)));
+
+   // Test the edges of the input code range
+   KORIN_ASSERT(actions.getActionsForInput(pressed({1023, 64, 0})) == bit(korin::GameAction::Menu));
+   actions.mapInputToAction(korin::INPUT_CODE_COUNT, korin::GameAction::Cancel);
+   KORIN_ASSERT(actions.getActionsForInputCode(korin::INPUT_CODE_COUNT) == 0);
+
+   // Test a held chord replaces the actions of its keys
+   KORIN_ASSERT(actions.mapChordToAction({56, 13}, korin::GameAction::Sprint));
+   KORIN_ASSERT(actions.getActionsForInput(pressed({13})) == bit(korin::GameAction::MoveForward));
+   KORIN_ASSERT(actions.getActionsForInput(pressed({13, 56})) == bit(korin::GameAction::Sprint));
+   KORIN_ASSERT(actions.getActionsForInput(pressed({13, 56, 126})) == (bit(korin::GameAction::Sprint) | bit(korin::GameAction::MoveForward)));
+
+   // Test chords sharing keys and chords past 64
+   KORIN_ASSERT(actions.mapChordToAction({56, 13, 700}, korin::GameAction::PrimaryAbility));
+   KORIN_ASSERT(actions.getActionsForInput(pressed({13, 56, 700})) == (bit(korin::GameAction::Sprint) | bit(korin::GameAction::PrimaryAbility)));
+
+   // Test invalid chords are refused
+   KORIN_ASSERT(!actions.mapChordToAction({13}, korin::GameAction::Cancel));
+   KORIN_ASSERT(!actions.mapChordToAction({1, 2, 3, 4, 5}, korin::GameAction::Cancel));
+   KORIN_ASSERT(!actions.mapChordToAction({1, 2000}, korin::GameAction::Cancel));
+
+   // Test unmapInput() and clearMappings()
+   actions.unmapInput(49);
+   KORIN_ASSERT(actions.getActionsForInput(pressed({49})) == 0);
+   actions.clearMappings();
+   KORIN_ASSERT(actions.getActionsForInput(pressed({13, 56, 126, 700, 1023})) == 0);
+}
+
+int main() {
+   korin::Log::init();
+   test_game_action_util();
+   KORIN_INFO("GameActionUtil tests passed!");
+   return 0;
+}
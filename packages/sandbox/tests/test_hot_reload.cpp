@@ -0,0 +1,230 @@
+// test_hot_reload.cpp
+//
+// This file contains unit tests for the FileWatcher, Prefab::applyChanges, HotReloader and SystemModule.
+// test_system_module_swap needs the slide_module builds from the sandbox premake script.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/reload/hot_reloader.h"
+#include "korin/reload/system_module.h"
+#include "korin/serialization/prefab.h"
+#include "korin/serialization/scene_file.h"
+#include "korin/assets/pack_file.h"
+#include "korin/util/file_watcher.h"
+#include "korin/components/transform_component.h"
+#include "korin/components/physics_component.h"
+#include "korin/components/sprite_component.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+constexpr const char* WATCHED_PATH = "test_hot_reload.txt";
+constexpr const char* PACK_PATH = "test_hot_reload.kpak";
+constexpr const char* SCENE_PATH = "test_hot_reload.kscn";
+
+// Two builds of tests/modules/slide_module.cpp from the sandbox premake script, next to 
+// the test unless the build says where they are
+#ifndef TEST_MODULE_DIR
+#define TEST_MODULE_DIR "."
+#endif
+
+#if defined(KORIN_PLATFORM_MACOSX)
+constexpr const char* MODULE_EXTENSION = ".dylib";
+#else
+constexpr const char* MODULE_EXTENSION = ".so";
+#endif
+
+const std::string SLOW_MODULE_PATH = std::string(TEST_MODULE_DIR) + "/libslide_module" + MODULE_EXTENSION;
+const std::string FAST_MODULE_PATH = std::string(TEST_MODULE_DIR) + "/libslide_module_fast" + MODULE_EXTENSION;
+const std::string MODULE_PATH = std::string("test_hot_reload_module") + MODULE_EXTENSION;
+
+void writeText(const std::string& path, const std::string& text)
+{
+   std::ofstream file(path, std::ios::trunc);
+   file << text;
+}
+
+// A crate that slides right, tuned by changing its speed
+void writeCratePack(float speed, bool drawn)
+{
+   korin::Prefab prefab("crate");
+   prefab.add(std::make_shared<korin::TransformComponent>(0.0f, 0.0f, 0.0f));
+   prefab.add(std::make_shared<korin::PhysicsComponent>(speed, 0.0f, 0.0f, 0.0f));
+   if (drawn)
+   {
+      prefab.add(std::make_shared<korin::SpriteComponent>(4, 1.0f, 1.0f, 0));
+   }
+
+   std::vector<std::uint8_t> data;
+   prefab.serialize(data);
+   korin::PackWriter writer;
+   writer.add("crate", korin::PackBlobType::Prefab, data.data(), data.size());
+   KORIN_ASSERT(writer.write(PACK_PATH));
+}
+
+template<typename T>
+std::shared_ptr<T> find(const korin::EntityAdmin& world, korin::EntityID entityID)
+{
+   return std::static_pointer_cast<T>(world.findComponent(entityID, korin::Component::typeID<T>()));
+}
+} // namespace
+
+void test_file_watcher() {
+   writeText(WATCHED_PATH, "speed 1");
+   korin::FileWatcher watcher;
+   std::vector<std::string> changed;
+   watcher.watch(WATCHED_PATH, [&changed](const std::string& path) { changed.push_back(path); });
+   watcher.watch("test_hot_reload.missing", [&changed](const std::string& path) { changed.push_back(path); });
+   KORIN_ASSERT(watcher.size() == 2);
+
+   // Only changes after watching count, once each
+   KORIN_ASSERT(watcher.poll() == 0);
+   writeText(WATCHED_PATH, "speed 20");
+   KORIN_ASSERT(watcher.poll() == 1 && watcher.poll() == 0);
+   KORIN_ASSERT(changed == std::vector<std::string>({WATCHED_PATH}));
+
+   // A file that goes missing is picked up again when it comes back
+   std::remove(WATCHED_PATH);
+   KORIN_ASSERT(watcher.poll() == 0);
+   writeText(WATCHED_PATH, "speed 300");
+   KORIN_ASSERT(watcher.poll() == 1);
+
+   watcher.unwatch(WATCHED_PATH);
+   writeText(WATCHED_PATH, "speed 4000");
+   KORIN_ASSERT(watcher.poll() == 0 && watcher.size() == 1);
+   std::remove(WATCHED_PATH);
+}
+
+void test_prefab_reload() {
+   writeCratePack(1.0f, false);
+   korin::PackFile pack;
+   KORIN_ASSERT(pack.open(PACK_PATH));
+   korin::PrefabLibrary library;
+   library.load(pack);
+   pack.close();
+
+   korin::EntityAdmin world;
+   world.createEntity("player");
+   const korin::EntityID first = world.instantiate(*library.find("crate"), 10);
+   find<korin::TransformComponent>(world, first)->x = 5.0f;
+
+   korin::HotReloader reloader(world);
+   reloader.watchPrefabs(PACK_PATH, library);
+   KORIN_ASSERT(reloader.update() == 0);
+
+   // Tuned fields reach every crate while the fields that weren't touched keep their live values
+   writeCratePack(3.0f, true);
+   KORIN_ASSERT(reloader.update() == 1 && reloader.reloadCount() == 1);
+   for (korin::EntityID entityID = first; entityID < first + 10; entityID++)
+   {
+      KORIN_ASSERT(find<korin::PhysicsComponent>(world, entityID)->dx == 3.0f);
+      auto sprite = find<korin::SpriteComponent>(world, entityID);
+      KORIN_ASSERT(sprite && sprite->textureID == 4 && sprite->sibling<korin::TransformComponent>().lock());
+   }
+   KORIN_ASSERT(find<korin::TransformComponent>(world, first)->x == 5.0f);
+   KORIN_ASSERT(world.components(0).empty());
+   KORIN_ASSERT(library.find("crate")->componentCount() == 3);
+
+   // Components the prefab drops are removed
+   writeCratePack(3.0f, false);
+   KORIN_ASSERT(reloader.update() == 1 && reloader.reloadCount() == 2);
+   KORIN_ASSERT(!find<korin::SpriteComponent>(world, first) && find<korin::PhysicsComponent>(world, first));
+
+   // A broken pack changes nothing
+   writeText(PACK_PATH, "half written");
+   KORIN_ASSERT(reloader.update() == 1 && reloader.reloadCount() == 2);
+   KORIN_ASSERT(library.find("crate")->componentCount() == 2);
+   std::remove(PACK_PATH);
+}
+
+void test_scene_reload() {
+   korin::EntityAdmin level;
+   for (int i = 0; i < 3; i++)
+   {
+      auto wall = level.createEntity("wall");
+      level.addComponent(wall->entityID(), std::make_shared<korin::TransformComponent>(static_cast<float>(i), 0.0f, 0.0f));
+   }
+   korin::SceneWriter writer;
+   writer.capture(level);
+   KORIN_ASSERT(writer.write(SCENE_PATH));
+
+   korin::EntityAdmin world;
+   korin::HotReloader reloader(world);
+   reloader.watchScene(SCENE_PATH);
+   KORIN_ASSERT(reloader.update() == 0 && world.entityCount() == 0);
+
+   level.createEntity("wall");
+   writer.capture(level);
+   KORIN_ASSERT(writer.write(SCENE_PATH));
+   KORIN_ASSERT(reloader.update() == 1 && reloader.reloadCount() == 1);
+   KORIN_ASSERT(world.entityCount() == 4 && find<korin::TransformComponent>(world, 2)->x == 2.0f);
+   std::remove(SCENE_PATH);
+}
+
+void test_system_module_failures() {
+   korin::EntityAdmin world;
+   korin::SystemModule module(world);
+   KORIN_ASSERT(!module.reload());
+
+   // A missing or foreign library leaves the module unloaded
+   KORIN_ASSERT(!module.load("test_hot_reload.missing"));
+   writeText(WATCHED_PATH, "not a library");
+   KORIN_ASSERT(!module.load(WATCHED_PATH));
+   KORIN_ASSERT(!module.isLoaded() && module.systems().empty() && module.loadCount() == 0);
+   std::remove(WATCHED_PATH);
+
+   korin::HotReloader reloader(world);
+   KORIN_ASSERT(!reloader.watchSystemModule("test_hot_reload.missing"));
+   KORIN_ASSERT(reloader.update() == 0);
+}
+
+void test_system_module_swap() {
+   korin::EntityAdmin world;
+   auto crate = world.createEntity("crate");
+   auto transform = std::make_shared<korin::TransformComponent>(0.0f, 0.0f, 0.0f);
+   world.addComponent(crate->entityID(), transform);
+
+   // The game's build writes over the library the reloader watches
+   std::filesystem::copy_file(SLOW_MODULE_PATH, MODULE_PATH, std::filesystem::copy_options::overwrite_existing);
+   korin::HotReloader reloader(world);
+   KORIN_ASSERT(reloader.watchSystemModule(MODULE_PATH));
+   KORIN_ASSERT(world.schedule().size() == 1);
+   world.updateSystems(1.0f);
+   KORIN_ASSERT(transform->x == 1.0f);
+
+   // The rebuilt systems take over while the entity and its components carry on
+   std::filesystem::copy_file(FAST_MODULE_PATH, MODULE_PATH, std::filesystem::copy_options::overwrite_existing);
+   KORIN_ASSERT(reloader.update() == 1 && reloader.reloadCount() == 1);
+   KORIN_ASSERT(reloader.systemModule()->loadCount() == 2 && world.schedule().size() == 1);
+   world.updateSystems(1.0f);
+   KORIN_ASSERT(world.entityCount() == 1);
+   KORIN_ASSERT(find<korin::TransformComponent>(world, crate->entityID()) == transform && transform->x == 11.0f);
+
+   // Unloading takes the systems out of the world
+   reloader.systemModule()->unload();
+   KORIN_ASSERT(world.schedule().size() == 0);
+   world.updateSystems(1.0f);
+   KORIN_ASSERT(transform->x == 11.0f);
+   std::remove(MODULE_PATH.c_str());
+}
+
+int main() {
+   korin::Log::init();
+   test_file_watcher();
+   test_prefab_reload();
+   test_scene_reload();
+   test_system_module_failures();
+   test_system_module_swap();
+   KORIN_INFO("Hot reload tests passed!");
+   return 0;
+}
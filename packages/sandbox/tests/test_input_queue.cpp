@@ -0,0 +1,152 @@
+// test_input_queue.cpp
+//
+// This file contains unit tests for the SPSCQueue class and the event-driven GameInputSystem.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <memory>
+#include <thread>
+
+#include "korin/util/spsc_queue.h"
+#include "korin/input/input_backend.h"
+#include "korin/systems/game_input_system.h"
+#include "korin/components/input_stream_component.h"
+#include "korin/util/game_action_util.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+// Backend driven by the test instead of a device
+class TestInputBackend : public korin::InputBackend
+{
+public:
+   virtual bool start() override { return true; }
+   virtual void stop() override {}
+
+   void send(korin::InputEventType type, std::uint16_t code, float value = 0.0f)
+   {
+      pushEvent({now(), type, code, value});
+   }
+};
+} // namespace
+
+void test_spsc_queue() {
+   korin::SPSCQueue<int, 4> queue;
+   int value = 0;
+
+   // Test tryPop() on an empty queue
+   KORIN_ASSERT(queue.empty());
+   KORIN_ASSERT(!queue.tryPop(value));
+
+   // Test tryPush() fills up to the capacity and then refuses
+   for (int i = 0; i < 4; i++)
+   {
+      KORIN_ASSERT(queue.tryPush(i));
+   }
+   KORIN_ASSERT(!queue.tryPush(4));
+   KORIN_ASSERT(queue.sizeApprox() == 4);
+
+   // Test values come out in order and the freed slots are reused
+   KORIN_ASSERT(queue.tryPop(value) && value == 0);
+   KORIN_ASSERT(queue.tryPush(4));
+   for (int i = 1; i <= 4; i++)
+   {
+      KORIN_ASSERT(queue.tryPop(value) && value == i);
+   }
+   KORIN_ASSERT(!queue.tryPop(value));
+
+   // Test a producer thread and a consumer thread hand over every value in order
+   auto shared = std::make_unique<korin::SPSCQueue<int, 64>>();
+   const int count = 100000;
+   std::thread producer([&shared, count]()
+   {
+      for (int i = 0; i < count; i++)
+      {
+         while (!shared->tryPush(i))
+         {
+            std::this_thread::yield();
+         }
+      }
+   });
+
+   int expected = 0;
+   while (expected < count)
+   {
+      if (shared->tryPop(value))
+      {
+         KORIN_ASSERT(value == expected);
+         expected++;
+      }
+      else
+      {
+         std::this_thread::yield();
+      }
+   }
+   producer.join();
+   KORIN_ASSERT(shared->empty());
+}
+
+void test_game_input_system() {
+   korin::GameActionUtil::instance().mapInputToAction(13, korin::GameAction::Jump);
+   korin::GameActionUtil::instance().mapInputToAction(700, korin::GameAction::Sprint);
+   korin::GameActionUtil::instance().mapInputToAction(korin::BUTTON_INPUT_CODE_BASE, korin::GameAction::PrimaryAbility);
+
+   korin::GameInputSystem inputSystem;
+   auto ownedBackend = std::make_unique<TestInputBackend>();
+   TestInputBackend* backend = ownedBackend.get();
+   inputSystem.setBackend(std::move(ownedBackend));
+
+   auto inputStream = std::make_shared<korin::InputStreamComponent>();
+   const std::vector<korin::ComponentPtr> streams = {inputStream};
+   const auto jump = korin::toMask(korin::GameAction::Jump);
+   const auto sprint = korin::toMask(korin::GameAction::Sprint);
+   const auto primary = korin::toMask(korin::GameAction::PrimaryAbility);
+
+   // Test a key press begins its action and holding it keeps the action active
+   backend->send(korin::InputEventType::KeyDown, 13);
+   inputSystem.updateBatch(0.016f, streams);
+   KORIN_ASSERT(inputStream->currentActionStates == jump);
+   KORIN_ASSERT(inputStream->actionsBegun == jump);
+   inputSystem.updateBatch(0.016f, streams);
+   KORIN_ASSERT(inputStream->currentActionStates == jump);
+   KORIN_ASSERT(inputStream->actionsBegun == 0);
+
+   // Test releasing the key ends its action
+   backend->send(korin::InputEventType::KeyUp, 13);
+   inputSystem.updateBatch(0.016f, streams);
+   KORIN_ASSERT(inputStream->currentActionStates == 0);
+   KORIN_ASSERT(inputStream->actionsEnded == jump);
+
+   // Test a tap shorter than a frame is not lost
+   backend->send(korin::InputEventType::ButtonDown, 0);
+   backend->send(korin::InputEventType::ButtonUp, 0);
+   inputSystem.updateBatch(0.016f, streams);
+   KORIN_ASSERT(inputStream->currentActionStates == 0);
+   KORIN_ASSERT(inputStream->actionsBegun == primary);
+   KORIN_ASSERT(inputStream->actionsEnded == primary);
+
+   // Test key codes past 64 map to their actions
+   backend->send(korin::InputEventType::KeyDown, 700);
+   inputSystem.updateBatch(0.016f, streams);
+   KORIN_ASSERT(inputStream->currentActionStates == sprint);
+
+   // Test axis values and per frame deltas
+   backend->send(korin::InputEventType::Axis, 0, 2.0f);
+   backend->send(korin::InputEventType::Axis, 0, 3.0f);
+   inputSystem.updateBatch(0.016f, streams);
+   KORIN_ASSERT(inputSystem.axisValue(0) == 3.0f);
+   KORIN_ASSERT(inputSystem.axisDelta(0) == 5.0f);
+   inputSystem.updateBatch(0.016f, streams);
+   KORIN_ASSERT(inputSystem.axisDelta(0) == 0.0f);
+   KORIN_ASSERT(backend->droppedEventCount() == 0);
+}
+
+int main() {
+   korin::Log::init();
+   test_spsc_queue();
+   test_game_input_system();
+   KORIN_INFO("Input queue tests passed!");
+   return 0;
+}
@@ -0,0 +1,121 @@
+// test_input_recording.cpp
+//
+// This file contains unit tests for recording and replaying input through the GameInputSystem.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/input/input_backend.h"
+#include "korin/input/input_recording.h"
+#include "korin/systems/game_input_system.h"
+#include "korin/components/input_stream_component.h"
+#include "korin/util/game_action_util.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+class TestInputBackend : public korin::InputBackend
+{
+public:
+   virtual bool start() override { return true; }
+   virtual void stop() override {}
+
+   void send(korin::InputEventType type, std::uint16_t code)
+   {
+      pushEvent({now(), type, code, 0.0f});
+   }
+};
+
+struct TickStates
+{
+   korin::ActionMask current;
+   korin::ActionMask begun;
+   korin::ActionMask ended;
+};
+} // namespace
+
+void test_input_recording() {
+   korin::GameActionUtil::instance().mapInputToAction(1, korin::GameAction::Jump);
+   korin::GameActionUtil::instance().mapInputToAction(2, korin::GameAction::MoveLeft);
+
+   korin::EntityAdmin admin;
+   auto player = admin.createEntity("player");
+   auto inputStream = std::make_shared<korin::InputStreamComponent>();
+   KORIN_ASSERT(admin.addComponent(player->entityID(), inputStream));
+   const std::vector<korin::ComponentPtr> streams = {inputStream};
+
+   korin::GameInputSystem inputSystem;
+   auto ownedBackend = std::make_unique<TestInputBackend>();
+   TestInputBackend* backend = ownedBackend.get();
+   inputSystem.setBackend(std::move(ownedBackend));
+
+   // Record a session with a hold, a tap inside one tick and some idle ticks
+   inputSystem.startRecording();
+   KORIN_ASSERT(inputSystem.mode() == korin::InputMode::Recording);
+   std::vector<TickStates> live;
+   for (std::uint32_t tick = 0; tick < 200; tick++)
+   {
+      if (tick == 3) backend->send(korin::InputEventType::KeyDown, 2);
+      if (tick == 40) backend->send(korin::InputEventType::KeyUp, 2);
+      if (tick == 50)
+      {
+         backend->send(korin::InputEventType::KeyDown, 1);
+         backend->send(korin::InputEventType::KeyUp, 1);
+      }
+      if (tick == 120) backend->send(korin::InputEventType::KeyDown, 1);
+
+      inputSystem.updateBatch(1.0f / 60.0f, streams);
+      live.push_back({inputStream->currentActionStates, inputStream->actionsBegun, inputStream->actionsEnded});
+   }
+   inputSystem.resumeLiveInput();
+
+   // Test the recording covers every tick and only stores the ticks that changed
+   const korin::InputRecorder& recorder = inputSystem.recorder();
+   KORIN_ASSERT(recorder.tickCount() == 200);
+   KORIN_ASSERT(recorder.data().size() < 64);
+
+   // Test the replay reproduces every tick exactly while live input is ignored
+   inputStream->currentActionStates = 0;
+   KORIN_ASSERT(inputSystem.startReplay(recorder.data()));
+   for (std::uint32_t tick = 0; tick < 200; tick++)
+   {
+      backend->send(korin::InputEventType::KeyDown, 2);
+      inputSystem.updateBatch(1.0f / 60.0f, streams);
+      KORIN_ASSERT(inputStream->currentActionStates == live[tick].current);
+      KORIN_ASSERT(inputStream->actionsBegun == live[tick].begun);
+      KORIN_ASSERT(inputStream->actionsEnded == live[tick].ended);
+   }
+   KORIN_ASSERT(inputSystem.player().finished());
+
+   // Test live input resumes once the recording runs out
+   inputSystem.updateBatch(1.0f / 60.0f, streams);
+   KORIN_ASSERT(inputSystem.mode() == korin::InputMode::Live);
+
+   // Test a recording survives a round trip through a file
+   const char* path = "test_input_recording.kinp";
+   KORIN_ASSERT(recorder.saveToFile(path));
+   korin::InputPlayer filePlayer;
+   KORIN_ASSERT(filePlayer.loadFromFile(path));
+   KORIN_ASSERT(filePlayer.tickCount() == 200);
+   std::remove(path);
+
+   // Test invalid recordings are refused
+   KORIN_ASSERT(!inputSystem.startReplay({1, 2, 3}));
+   std::vector<std::uint8_t> wrongVersion = recorder.data();
+   wrongVersion[4] = 99;
+   KORIN_ASSERT(!inputSystem.startReplay(wrongVersion));
+   KORIN_ASSERT(inputSystem.mode() == korin::InputMode::Live);
+}
+
+int main() {
+   korin::Log::init();
+   test_input_recording();
+   KORIN_INFO("Input recording tests passed!");
+   return 0;
+}
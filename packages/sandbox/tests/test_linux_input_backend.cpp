@@ -0,0 +1,166 @@
+// test_linux_input_backend.cpp
+//
+// This file contains unit tests for the LinuxInputBackend reading a virtual uinput keyboard.
+// They are skipped where /dev/uinput can't be opened.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include "korin/log.h"
+
+#ifdef KORIN_PLATFORM_LINUX
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <linux/uinput.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include "korin/input/linux_input_backend.h"
+#include "korin/util/assert.h"
+
+namespace
+{
+// A virtual keyboard with one key, or -1 if uinput isn't available
+int createKeyboard()
+{
+   const int fileDescriptor = open("/dev/uinput", O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+   if (fileDescriptor < 0)
+   {
+      return -1;
+   }
+
+   uinput_setup setup = {};
+   setup.id.bustype = BUS_VIRTUAL;
+   std::strncpy(setup.name, "korin test keyboard", UINPUT_MAX_NAME_SIZE - 1);
+   if (ioctl(fileDescriptor, UI_SET_EVBIT, EV_KEY) < 0 || ioctl(fileDescriptor, UI_SET_KEYBIT, KEY_A) < 0
+      || ioctl(fileDescriptor, UI_DEV_SETUP, &setup) < 0 || ioctl(fileDescriptor, UI_DEV_CREATE) < 0)
+   {
+      close(fileDescriptor);
+      return -1;
+   }
+   return fileDescriptor;
+}
+
+// The /dev/input/event* node the kernel made for the virtual keyboard
+std::string eventPath(int keyboard)
+{
+   char sysName[64] = {};
+   if (ioctl(keyboard, UI_GET_SYSNAME(sizeof(sysName)), sysName) < 0)
+   {
+      return "";
+   }
+
+   std::string path;
+   if (DIR* directory = opendir(("/sys/devices/virtual/input/" + std::string(sysName)).c_str()))
+   {
+      while (dirent* entry = readdir(directory))
+      {
+         const std::string name = entry->d_name;
+         if (name.rfind("event", 0) == 0)
+         {
+            path = "/dev/input/" + name;
+         }
+      }
+      closedir(directory);
+   }
+   return path;
+}
+
+void emit(int keyboard, std::uint16_t type, std::uint16_t code, std::int32_t value)
+{
+   input_event event = {};
+   event.type = type;
+   event.code = code;
+   event.value = value;
+   KORIN_ASSERT(write(keyboard, &event, sizeof(event)) == static_cast<ssize_t>(sizeof(event)));
+}
+
+// Pops events until one with the type and code arrives, giving up after a second
+bool waitForEvent(korin::InputBackend& backend, korin::InputEventType type, std::uint16_t code)
+{
+   const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+   while (std::chrono::steady_clock::now() < deadline)
+   {
+      korin::InputEvent event;
+      while (backend.pollEvent(event))
+      {
+         if (event.type == type && event.code == code)
+         {
+            return true;
+         }
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+   }
+   return false;
+}
+} // namespace
+
+void test_device_removal() {
+   const int keyboard = createKeyboard();
+   if (keyboard < 0)
+   {
+      KORIN_WARN("Skipping LinuxInputBackend tests, /dev/uinput can't be opened.");
+      return;
+   }
+
+   // udev may take a moment to make the device node readable
+   const std::string path = eventPath(keyboard);
+   korin::LinuxInputBackend backend({path});
+   bool started = false;
+   for (int attempt = 0; attempt < 100 && !started; attempt++)
+   {
+      started = !path.empty() && access(path.c_str(), R_OK) == 0 && backend.start();
+      if (!started)
+      {
+         std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+   }
+   if (!started)
+   {
+      KORIN_WARN("Skipping LinuxInputBackend tests, the uinput device can't be read.");
+      ioctl(keyboard, UI_DEV_DESTROY);
+      close(keyboard);
+      return;
+   }
+
+   // Test a key pressed on the device is reported
+   emit(keyboard, EV_KEY, KEY_A, 1);
+   emit(keyboard, EV_SYN, SYN_REPORT, 0);
+   KORIN_ASSERT(waitForEvent(backend, korin::InputEventType::KeyDown, KEY_A));
+
+   // Test unplugging the device while the key is held releases it
+   ioctl(keyboard, UI_DEV_DESTROY);
+   close(keyboard);
+   KORIN_ASSERT(waitForEvent(backend, korin::InputEventType::KeyUp, KEY_A));
+
+   backend.stop();
+}
+
+int main() {
+   korin::Log::init();
+
+   test_device_removal();
+
+   KORIN_INFO("LinuxInputBackend tests passed!");
+
+   return 0;
+}
+
+#else
+
+int main() {
+   korin::Log::init();
+
+   KORIN_INFO("LinuxInputBackend tests only run on Linux.");
+
+   return 0;
+}
+
+#endif // KORIN_PLATFORM_LINUX
@@ -0,0 +1,146 @@
+// test_physics_system.cpp
+//
+// This file contains unit tests for the PhysicsSystem class.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <memory>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/systems/physics_system.h"
+#include "korin/components/physics_component.h"
+#include "korin/components/transform_component.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+struct BodyRef
+{
+   std::shared_ptr<korin::TransformComponent> transform;
+   std::shared_ptr<korin::PhysicsComponent> physics;
+};
+
+BodyRef addBody(korin::EntityAdmin& world, float x, float y, float dx, float dy, float accelerationX, float accelerationY)
+{
+   auto entity = world.createEntity("body");
+   BodyRef body = {
+      std::make_shared<korin::TransformComponent>(x, y, 0.0f),
+      std::make_shared<korin::PhysicsComponent>(dx, dy, accelerationX, accelerationY)
+   };
+   world.addComponent(entity->entityID(), body.transform);
+   world.addComponent(entity->entityID(), body.physics);
+   return body;
+}
+} // namespace
+
+void test_physics_integration() {
+   korin::EntityAdmin world;
+   world.addSystem(std::make_shared<korin::PhysicsSystem>());
+
+   // Test a step matches semi-implicit Euler by hand: the new velocity moves the position.
+   // Half a second keeps every value exact in floating point.
+   BodyRef body = addBody(world, 1.0f, 2.0f, 3.0f, -1.0f, 2.0f, 4.0f);
+   world.updateSystems(0.5f);
+   KORIN_ASSERT(body.physics->dx == 4.0f && body.physics->dy == 1.0f);
+   KORIN_ASSERT(body.transform->x == 3.0f && body.transform->y == 2.5f);
+
+   // Test a disabled body doesn't move
+   BodyRef disabled = addBody(world, 5.0f, 5.0f, 1.0f, 1.0f, 1.0f, 1.0f);
+   disabled.physics->enabled = false;
+   world.updateSystems(0.5f);
+   KORIN_ASSERT(disabled.transform->x == 5.0f && disabled.transform->y == 5.0f);
+   KORIN_ASSERT(disabled.physics->dx == 1.0f && disabled.physics->dy == 1.0f);
+   KORIN_ASSERT(!disabled.physics->sleeping);
+}
+
+void test_physics_sleep() {
+   korin::EntityAdmin world;
+   auto physicsSystem = std::make_shared<korin::PhysicsSystem>();
+   physicsSystem->timeToSleep = 0.5f;
+   world.addSystem(physicsSystem);
+
+   // Test a body at rest falls asleep once it has been slow for timeToSleep
+   BodyRef body = addBody(world, 0.0f, 0.0f, 0.001f, 0.0f, 0.0f, 0.0f);
+   world.updateSystems(0.25f);
+   KORIN_ASSERT(!body.physics->sleeping && body.physics->sleepTime == 0.25f);
+   world.updateSystems(0.25f);
+   KORIN_ASSERT(body.physics->sleeping);
+   KORIN_ASSERT(body.physics->dx == 0.0f && body.physics->dy == 0.0f);
+
+   // Test a sleeping body is skipped even when given a velocity
+   body.physics->dx = 2.0f;
+   const float sleepingX = body.transform->x;
+   world.updateSystems(0.25f);
+   KORIN_ASSERT(body.transform->x == sleepingX);
+
+   // Test wake() integrates it again and restarts the countdown
+   body.physics->wake();
+   KORIN_ASSERT(!body.physics->sleeping && body.physics->sleepTime == 0.0f);
+   world.updateSystems(0.25f);
+   KORIN_ASSERT(body.transform->x == sleepingX + 0.5f);
+   KORIN_ASSERT(!body.physics->sleeping);
+
+   // Test acceleration keeps a slow body awake
+   BodyRef accelerating = addBody(world, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0001f);
+   for (int tick = 0; tick < 4; tick++)
+   {
+      world.updateSystems(0.25f);
+   }
+   KORIN_ASSERT(!accelerating.physics->sleeping && accelerating.physics->sleepTime == 0.0f);
+}
+
+void test_physics_batch_matches_scalar() {
+   // Seven bodies fill one four-wide SIMD batch and leave three for the scalar tail
+   korin::EntityAdmin batchWorld;
+   korin::EntityAdmin scalarWorld;
+   batchWorld.addSystem(std::make_shared<korin::PhysicsSystem>());
+   korin::PhysicsSystem scalarSystem;
+
+   std::vector<BodyRef> batched;
+   std::vector<BodyRef> scalar;
+   for (int i = 0; i < 7; i++)
+   {
+      const float x = 0.1f * static_cast<float>(i);
+      const float y = 3.7f - 0.3f * static_cast<float>(i);
+      const float dx = 1.3f * static_cast<float>(i % 3) - 0.7f;
+      const float dy = 0.9f - 0.2f * static_cast<float>(i);
+      const float accelerationX = 0.11f * static_cast<float>(i);
+      const float accelerationY = -9.8f;
+      batched.push_back(addBody(batchWorld, x, y, dx, dy, accelerationX, accelerationY));
+      scalar.push_back(addBody(scalarWorld, x, y, dx, dy, accelerationX, accelerationY));
+   }
+
+   // Test every body ends up bit for bit where integrating it alone puts it
+   const float timeStep = 1.0f / 60.0f;
+   for (int tick = 0; tick < 30; tick++)
+   {
+      batchWorld.updateSystems(timeStep);
+      for (const BodyRef& body : scalar)
+      {
+         scalarSystem.update(timeStep, body.physics);
+      }
+   }
+
+   for (std::size_t i = 0; i < batched.size(); i++)
+   {
+      KORIN_ASSERT(batched[i].transform->x == scalar[i].transform->x);
+      KORIN_ASSERT(batched[i].transform->y == scalar[i].transform->y);
+      KORIN_ASSERT(batched[i].physics->dx == scalar[i].physics->dx);
+      KORIN_ASSERT(batched[i].physics->dy == scalar[i].physics->dy);
+   }
+}
+
+int main() {
+   korin::Log::init();
+
+   test_physics_integration();
+   test_physics_sleep();
+   test_physics_batch_matches_scalar();
+
+   KORIN_INFO("PhysicsSystem tests passed!");
+
+   return 0;
+}
@@ -0,0 +1,154 @@
+// test_prefab.cpp
+//
+// This file contains unit tests for the Prefab, PrefabLibrary and EntityAdmin::instantiate.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/serialization/prefab.h"
+#include "korin/assets/pack_file.h"
+#include "korin/systems/physics_system.h"
+#include "korin/components/transform_component.h"
+#include "korin/components/physics_component.h"
+#include "korin/components/sprite_component.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+constexpr const char* PACK_PATH = "test_prefab.kpak";
+
+// A falling crate drawn with texture 3
+korin::Prefab cratePrefab()
+{
+   korin::Prefab prefab("crate");
+   prefab.add(std::make_shared<korin::TransformComponent>(2.0f, 10.0f, 0.0f));
+   prefab.add(std::make_shared<korin::PhysicsComponent>(1.0f, 0.0f, 0.0f, 0.0f));
+   prefab.add(std::make_shared<korin::SpriteComponent>(3, 1.0f, 1.0f, 0));
+   return prefab;
+}
+
+template<typename T>
+std::shared_ptr<T> find(const korin::EntityAdmin& world, korin::EntityID entityID)
+{
+   return std::static_pointer_cast<T>(world.findComponent(entityID, korin::Component::typeID<T>()));
+}
+} // namespace
+
+void test_prefab_serialization() {
+   korin::Prefab prefab = cratePrefab();
+   KORIN_ASSERT(prefab.componentCount() == 3);
+
+   // Adding a type again replaces it
+   prefab.add(std::make_shared<korin::TransformComponent>(4.0f, 10.0f, 0.0f));
+   KORIN_ASSERT(prefab.componentCount() == 3);
+
+   std::vector<std::uint8_t> data;
+   prefab.serialize(data);
+   korin::Prefab copy;
+   KORIN_ASSERT(copy.deserialize(data.data(), data.size()));
+   KORIN_ASSERT(copy.componentCount() == 3);
+
+   std::vector<std::uint8_t> copyData;
+   copy.serialize(copyData);
+   KORIN_ASSERT(copyData == data);
+
+   // Truncated or foreign data is rejected
+   KORIN_ASSERT(!copy.deserialize(data.data(), data.size() - 1) && copy.empty());
+   data[0] ^= 0xFF;
+   KORIN_ASSERT(!copy.deserialize(data.data(), data.size()));
+
+   // An entity can be captured into a prefab
+   korin::EntityAdmin world;
+   auto entity = world.createEntity("barrel");
+   world.addComponent(entity->entityID(), std::make_shared<korin::TransformComponent>(1.0f, 2.0f, 0.0f));
+   korin::Prefab captured;
+   KORIN_ASSERT(captured.capture(world, entity->entityID()));
+   KORIN_ASSERT(captured.handle() == korin::StringID("barrel") && captured.componentCount() == 1);
+   KORIN_ASSERT(!captured.capture(world, 42));
+}
+
+void test_prefab_library() {
+   std::vector<std::uint8_t> data;
+   cratePrefab().serialize(data);
+
+   korin::PackWriter writer;
+   writer.add("crate", korin::PackBlobType::Prefab, data.data(), data.size());
+   writer.add("notes", korin::PackBlobType::Raw, "not a prefab", 12);
+   KORIN_ASSERT(writer.write(PACK_PATH));
+
+   korin::PackFile pack;
+   KORIN_ASSERT(pack.open(PACK_PATH));
+   korin::PrefabLibrary library;
+   KORIN_ASSERT(library.load(pack) == 1 && library.size() == 1);
+   pack.close();
+   std::remove(PACK_PATH);
+
+   // Prefabs are copied out of the pack, so they outlive it
+   const korin::Prefab* crate = library.find("crate");
+   KORIN_ASSERT(crate && crate->componentCount() == 3);
+   KORIN_ASSERT(!library.find("notes"));
+
+   korin::EntityAdmin world;
+   KORIN_ASSERT(world.instantiate(*crate, 1) == 0);
+   KORIN_ASSERT(find<korin::SpriteComponent>(world, 0)->textureID == 3);
+}
+
+void test_instantiate() {
+   korin::EntityAdmin world;
+   world.addSystem(std::make_shared<korin::PhysicsSystem>());
+   world.createEntity("player");
+
+   // A wave of crates gets contiguous IDs after the existing entities
+   const korin::Prefab prefab = cratePrefab();
+   const korin::EntityID first = world.instantiate(prefab, 1000);
+   KORIN_ASSERT(first == 1);
+   KORIN_ASSERT(world.entityCount() == 1001 && world.nextEntityID() == 1001);
+
+   for (korin::EntityID entityID = first; entityID < first + 1000; entityID++)
+   {
+      KORIN_ASSERT(world.entities().at(entityID)->getResourceHandle() == korin::StringID("crate"));
+      KORIN_ASSERT(world.components(entityID).size() == 3);
+      auto sprite = find<korin::SpriteComponent>(world, entityID);
+      KORIN_ASSERT(sprite->entityID() == entityID && sprite->textureID == 3);
+
+      // Siblings are the components of the same entity
+      auto transform = sprite->sibling<korin::TransformComponent>().lock();
+      KORIN_ASSERT(transform == find<korin::TransformComponent>(world, entityID));
+      KORIN_ASSERT(transform->x == 2.0f && transform->y == 10.0f);
+   }
+
+   // The copies are independent and systems see them
+   find<korin::PhysicsComponent>(world, first)->dx = 0.0f;
+   world.updateSystems(1.0f);
+   KORIN_ASSERT(find<korin::TransformComponent>(world, first)->x == 2.0f);
+   KORIN_ASSERT(find<korin::TransformComponent>(world, first + 1)->x == 3.0f);
+
+   // Removed entities release their share of the block while the rest keep working
+   world.removeEntity(world.entities().at(first + 1));
+   KORIN_ASSERT(!world.findComponent(first + 1, korin::Component::typeID<korin::TransformComponent>()));
+   world.updateSystems(1.0f);
+   KORIN_ASSERT(find<korin::TransformComponent>(world, first + 2)->x == 4.0f);
+
+   // A wave that doesn't fit is refused as a whole
+   KORIN_ASSERT(world.instantiate(prefab, korin::EntityAdmin::MAX_ENTITIES) == korin::INVALID_ENTITY_ID);
+   KORIN_ASSERT(world.instantiate(prefab, std::numeric_limits<std::uint32_t>::max() - 500) == korin::INVALID_ENTITY_ID);
+   KORIN_ASSERT(world.instantiate(korin::Prefab("empty"), 10) == korin::INVALID_ENTITY_ID);
+   KORIN_ASSERT(world.entityCount() == 1000);
+   KORIN_ASSERT(world.createEntity("player")->entityID() == 1001);
+}
+
+int main() {
+   korin::Log::init();
+   test_prefab_serialization();
+   test_prefab_library();
+   test_instantiate();
+   KORIN_INFO("Prefab tests passed!");
+   return 0;
+}
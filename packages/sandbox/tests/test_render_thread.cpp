@@ -0,0 +1,145 @@
+// test_render_thread.cpp
+//
+// This file contains unit tests for the RenderCommandBuffer and RenderThread.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/systems/render_system.h"
+#include "korin/render/render_thread.h"
+#include "korin/render/software_render_backend.h"
+#include "korin/components/sprite_component.h"
+#include "korin/components/transform_component.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+// Holds every present until it is opened, like a display stuck waiting on vsync
+class GatedBackend : public korin::RenderBackend
+{
+public:
+   GatedBackend()
+      : drawCalls(0), presenting(false), open(false) {}
+
+   void beginFrame(const korin::RenderView& view) override {}
+
+   void drawInstances(korin::TextureID textureID, const korin::SpriteInstance* instances, std::size_t count) override
+   {
+      drawCalls++;
+   }
+
+   void endFrame() override
+   {
+      presenting = true;
+      while (!open)
+      {
+         std::this_thread::yield();
+      }
+      presenting = false;
+   }
+
+   std::uint32_t width() const override { return 64; }
+   std::uint32_t height() const override { return 64; }
+
+public:
+   std::atomic<std::uint32_t> drawCalls;
+   std::atomic<bool> presenting;
+   std::atomic<bool> open;
+};
+
+void recordFrame(korin::RenderThread& renderThread, korin::RenderCommandBuffer* frame)
+{
+   const korin::SpriteInstance instance = {0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, korin::WHITE};
+   frame->beginFrame({0.0f, 0.0f, 8.0f});
+   frame->drawInstances(1, &instance, 1);
+   frame->endFrame();
+   renderThread.submitFrame(frame);
+}
+} // namespace
+
+void test_slow_present_never_blocks() {
+   auto backend = std::make_unique<GatedBackend>();
+   GatedBackend* gated = backend.get();
+   korin::RenderThread renderThread(std::move(backend));
+   KORIN_ASSERT(renderThread.start());
+   KORIN_ASSERT(!renderThread.start());
+
+   // Wait for the render thread to get stuck presenting the first frame
+   recordFrame(renderThread, renderThread.acquireFrame());
+   while (!gated->presenting)
+   {
+      std::this_thread::yield();
+   }
+
+   // The other two buffers fill up and the rest of the frames are dropped without waiting
+   for (int frame = 0; frame < 9; frame++)
+   {
+      korin::RenderCommandBuffer* buffer = renderThread.acquireFrame();
+      if (buffer)
+      {
+         recordFrame(renderThread, buffer);
+      }
+   }
+   KORIN_ASSERT(renderThread.framesDropped() == 7);
+
+   // Once the display catches up only the newest waiting frame is drawn
+   gated->open = true;
+   renderThread.stop();
+   KORIN_ASSERT(renderThread.framesRendered() == 2);
+   KORIN_ASSERT(renderThread.framesSkipped() == 1);
+   KORIN_ASSERT(gated->drawCalls == 2);
+   KORIN_ASSERT(renderThread.acquireFrame() != nullptr);
+}
+
+void test_threaded_frames_match() {
+   // The same scene drawn on the render thread and directly ends up with the same pixels
+   std::vector<std::uint32_t> pixels[2];
+   for (int threaded = 0; threaded < 2; threaded++)
+   {
+      korin::EntityAdmin world;
+      auto renderSystem = std::make_shared<korin::RenderSystem>();
+      renderSystem->view = {0.0f, 0.0f, 4.0f};
+      renderSystem->setBackend(std::make_unique<korin::SoftwareRenderBackend>(32, 32));
+      world.addSystem(renderSystem, {"Render", korin::SystemPhase::Render});
+
+      for (int i = 0; i < 20; i++)
+      {
+         auto entity = world.createEntity("sprite");
+         auto sprite = std::make_shared<korin::SpriteComponent>(static_cast<korin::TextureID>(i % 2), 1.5f, 1.0f,
+            static_cast<std::int16_t>(i % 3));
+         sprite->color = korin::rgba(static_cast<std::uint8_t>(i * 12), 80, 200, 160);
+         world.addComponent(entity->entityID(), std::make_shared<korin::TransformComponent>(
+            static_cast<float>(i % 5) - 2.0f, static_cast<float>(i / 5) - 2.0f, static_cast<float>(i * 17)));
+         world.addComponent(entity->entityID(), sprite);
+      }
+
+      if (threaded)
+      {
+         KORIN_ASSERT(renderSystem->startRenderThread());
+         KORIN_ASSERT(!renderSystem->startRenderThread());
+      }
+      world.updateFrame(1.0f / 60.0f);
+      renderSystem->stopRenderThread();
+      KORIN_ASSERT(renderSystem->renderThread() == nullptr);
+
+      auto software = static_cast<korin::SoftwareRenderBackend*>(renderSystem->backend());
+      KORIN_ASSERT(software->drawCalls() == 6);
+      pixels[threaded] = software->pixels();
+   }
+   KORIN_ASSERT(pixels[0] == pixels[1]);
+}
+
+int main() {
+   korin::Log::init();
+   test_slow_present_never_blocks();
+   test_threaded_frames_match();
+   KORIN_INFO("Render thread tests passed!");
+   return 0;
+}
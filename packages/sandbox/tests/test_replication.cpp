@@ -0,0 +1,213 @@
+// test_replication.cpp
+//
+// This file contains unit tests for the bit streams, ReplicationServer and ReplicationClient.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/netcode/loopback_transport.h"
+#include "korin/netcode/replication_client.h"
+#include "korin/netcode/replication_schema.h"
+#include "korin/netcode/replication_server.h"
+#include "korin/components/transform_component.h"
+#include "korin/components/physics_component.h"
+#include "korin/components/collider_component.h"
+#include "korin/util/bit_stream.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+constexpr std::uint32_t ENTITY_COUNT = 300;
+
+std::shared_ptr<korin::TransformComponent> transformOf(korin::EntityAdmin& admin, korin::EntityID entityID)
+{
+   return std::static_pointer_cast<korin::TransformComponent>(
+      admin.findComponent(entityID, korin::Component::typeID<korin::TransformComponent>()));
+}
+
+// Whether the client rebuilt exactly what the server sees now
+bool clientMatchesWorld(const korin::ReplicationSchema& schema, korin::EntityAdmin& admin, const korin::ReplicationClient& client)
+{
+   korin::ReplicatedState expected;
+   schema.capture(admin, 0, expected);
+   const korin::ReplicatedState* received = client.latestState();
+   return received && received->entityIDs == expected.entityIDs && received->typeMasks == expected.typeMasks
+      && received->rows == expected.rows;
+}
+} // namespace
+
+void test_bit_stream() {
+   std::vector<std::uint8_t> buffer;
+   korin::BitWriter writer(buffer);
+   writer.writeBits(5, 3);
+   writer.writeBool(true);
+   writer.writeVarBits(9);
+   writer.writeVarBits(70000);
+   writer.writeSignedVarBits(-3);
+   writer.writeBits(0xDEADBEEFCAFEF00DULL, 64);
+   writer.flush();
+   KORIN_ASSERT(buffer.size() == (writer.bitCount() + 7) / 8);
+
+   korin::BitReader reader(buffer.data(), buffer.size());
+   std::uint64_t value = 0;
+   bool flag = false;
+   std::int64_t signedValue = 0;
+   KORIN_ASSERT(reader.readBits(value, 3) && value == 5);
+   KORIN_ASSERT(reader.readBool(flag) && flag);
+   KORIN_ASSERT(reader.readVarBits(value) && value == 9);
+   KORIN_ASSERT(reader.readVarBits(value) && value == 70000);
+   KORIN_ASSERT(reader.readSignedVarBits(signedValue) && signedValue == -3);
+   KORIN_ASSERT(reader.readBits(value, 64) && value == 0xDEADBEEFCAFEF00DULL);
+   KORIN_ASSERT(!reader.readBits(value, 32) && reader.failed());
+}
+
+void test_replication_sends_only_changes() {
+   korin::EntityAdmin admin;
+
+   std::vector<korin::EntityID> entities;
+   for (std::uint32_t i = 0; i < ENTITY_COUNT; i++)
+   {
+      auto entity = admin.createEntity("crate");
+      admin.addComponent(entity->entityID(), std::make_shared<korin::TransformComponent>(static_cast<float>(i), 2.0f, 0.0f));
+      if (i % 2 == 0)
+      {
+         admin.addComponent(entity->entityID(), std::make_shared<korin::PhysicsComponent>());
+      }
+      entities.push_back(entity->entityID());
+   }
+
+   // Not replicated, so it's left out
+   admin.createEntity("marker");
+
+   auto transports = korin::LoopbackTransport::createPair(0);
+   korin::LoopbackTransport& serverEnd = *transports.first;
+   korin::LoopbackTransport& clientEnd = *transports.second;
+
+   korin::ReplicationSchema schema;
+   korin::ReplicationServer server(admin, schema);
+   korin::ReplicationClient client(schema);
+   server.addClient(&serverEnd);
+   client.setTransport(&clientEnd);
+
+   server.update();
+   KORIN_ASSERT(client.receive());
+   const std::uint32_t fullBytes = server.stats().lastBytesSent;
+   KORIN_ASSERT(server.stats().fullUpdates == 1);
+   KORIN_ASSERT(client.latestState()->entityCount() == ENTITY_COUNT);
+   KORIN_ASSERT(clientMatchesWorld(schema, admin, client));
+
+   // A few entities move each tick
+   for (std::uint32_t tick = 0; tick < 10; tick++)
+   {
+      for (std::uint32_t i = 0; i < 5; i++)
+      {
+         transformOf(admin, entities[(tick * 7 + i * 31) % ENTITY_COUNT])->x += 0.25f;
+      }
+      server.update();
+      KORIN_ASSERT(client.receive());
+      KORIN_ASSERT(clientMatchesWorld(schema, admin, client));
+   }
+   KORIN_ASSERT(server.stats().fullUpdates == 1);
+   KORIN_ASSERT(server.stats().lastChangedEntities <= 10);
+   KORIN_ASSERT(server.stats().lastBytesSent * 20 < fullBytes);
+   KORIN_ASSERT(server.acknowledgedTick(0) + 2 == server.currentTick());
+
+   // Nothing changed since the acknowledged state, so only the header goes out
+   server.update();
+   server.update();
+   KORIN_ASSERT(server.stats().lastChangedEntities == 0);
+   KORIN_ASSERT(server.stats().lastBytesSent < 24);
+
+   // With a lost packet every few ticks the deltas stay against the last acknowledged state
+   serverEnd.setDropEvery(3);
+   for (std::uint32_t tick = 0; tick < 12; tick++)
+   {
+      transformOf(admin, entities[tick])->y -= 1.0f;
+      transformOf(admin, entities[tick])->rotation += 45.0f;
+      server.update();
+      client.receive();
+   }
+   serverEnd.setDropEvery(0);
+   server.update();
+   KORIN_ASSERT(client.receive());
+   KORIN_ASSERT(clientMatchesWorld(schema, admin, client));
+
+   // Removed entities and components are removed on the client too
+   admin.removeEntity(admin.entities().at(entities[3]));
+   admin.removeComponent(entities[4], korin::Component::typeID<korin::PhysicsComponent>());
+   admin.addComponent(entities[5], std::make_shared<korin::ColliderComponent>(1.0f, 1.0f));
+   server.update();
+   KORIN_ASSERT(client.receive());
+   KORIN_ASSERT(client.latestState()->entityCount() == ENTITY_COUNT - 1);
+   KORIN_ASSERT(clientMatchesWorld(schema, admin, client));
+   KORIN_ASSERT(client.droppedPackets() == 0);
+}
+
+void test_replication_applies_to_world() {
+   korin::EntityAdmin admin;
+   auto entity = admin.createEntity("ship");
+   const korin::EntityID entityID = entity->entityID();
+   admin.addComponent(entityID, std::make_shared<korin::TransformComponent>(10.3f, -4.71f, 370.0f));
+   admin.addComponent(entityID, std::make_shared<korin::PhysicsComponent>());
+
+   auto transports = korin::LoopbackTransport::createPair(0);
+   korin::ReplicationSchema schema;
+   korin::ReplicationServer server(admin, schema);
+   korin::ReplicationClient client(schema);
+   server.addClient(transports.first.get());
+   client.setTransport(transports.second.get());
+   server.update();
+   KORIN_ASSERT(client.receive());
+
+   // The client's world is built from nothing but the replicated state
+   korin::EntityAdmin clientWorld;
+   client.apply(clientWorld);
+   KORIN_ASSERT(clientWorld.entityCount() == 1);
+   KORIN_ASSERT(clientWorld.entities().at(entityID)->getResourceHandle() == "ship");
+   KORIN_ASSERT(clientWorld.findComponent(entityID, korin::Component::typeID<korin::PhysicsComponent>()));
+
+   auto transform = transformOf(clientWorld, entityID);
+   KORIN_ASSERT(std::fabs(transform->x - 10.3f) <= schema.positionStep);
+   KORIN_ASSERT(std::fabs(transform->y + 4.71f) <= schema.positionStep);
+   KORIN_ASSERT(std::fabs(transform->rotation - 10.0f) < 0.01f);
+   KORIN_ASSERT(transform->scaleX == 1.0f);
+
+   // Removals on the server are applied on the next update
+   admin.removeComponent(entityID, korin::Component::typeID<korin::PhysicsComponent>());
+   server.update();
+   KORIN_ASSERT(client.receive());
+   client.apply(clientWorld);
+   KORIN_ASSERT(!clientWorld.findComponent(entityID, korin::Component::typeID<korin::PhysicsComponent>()));
+   admin.removeEntity(admin.entities().at(entityID));
+   server.update();
+   KORIN_ASSERT(client.receive());
+   client.apply(clientWorld);
+   KORIN_ASSERT(clientWorld.entityCount() == 0);
+
+   // A client with a different schema can't read the packets
+   korin::ReplicationSchema coarse;
+   coarse.positionStep = 0.5f;
+   auto otherTransports = korin::LoopbackTransport::createPair(0);
+   korin::ReplicationServer coarseServer(admin, coarse);
+   korin::ReplicationClient mismatched(schema);
+   coarseServer.addClient(otherTransports.first.get());
+   mismatched.setTransport(otherTransports.second.get());
+   coarseServer.update();
+   KORIN_ASSERT(!mismatched.receive());
+   KORIN_ASSERT(mismatched.droppedPackets() == 1);
+}
+
+int main() {
+   korin::Log::init();
+   test_bit_stream();
+   test_replication_sends_only_changes();
+   test_replication_applies_to_world();
+   KORIN_INFO("Replication tests passed!");
+   return 0;
+}
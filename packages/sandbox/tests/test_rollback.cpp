@@ -0,0 +1,238 @@
+// test_rollback.cpp
+//
+// This file contains unit tests for the RollbackSession and LoopbackTransport.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/netcode/loopback_transport.h"
+#include "korin/netcode/rollback_session.h"
+#include "korin/serialization/world_snapshot.h"
+#include "korin/components/transform_component.h"
+#include "korin/components/physics_component.h"
+#include "korin/components/bounds_component.h"
+#include "korin/components/collider_component.h"
+#include "korin/components/input_stream_component.h"
+#include "korin/input/scripted_input_backend.h"
+#include "korin/systems/game_input_system.h"
+#include "korin/util/game_action_util.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+constexpr float TIME_STEP = 1.0f / 60.0f;
+constexpr std::uint32_t TICK_COUNT = 60;
+
+// Falling box moved by input, so the players collide with each other and the floor
+korin::EntityID createPlayer(korin::EntityAdmin& admin, float x, float y)
+{
+   auto player = admin.createEntity("player");
+   admin.addComponent(player->entityID(), std::make_shared<korin::TransformComponent>(x, y, 0.0f));
+   auto inputStream = std::make_shared<korin::InputStreamComponent>();
+   inputStream->source = korin::InputSource::External;
+   admin.addComponent(player->entityID(), inputStream);
+   admin.addComponent(player->entityID(), std::make_shared<korin::PhysicsComponent>(0.0f, 0.0f, 0.0f, -9.8f));
+   admin.addComponent(player->entityID(), std::make_shared<korin::ColliderComponent>(0.5f, 0.5f));
+   admin.addComponent(player->entityID(), std::make_shared<korin::BoundsComponent>(0.5f, 0.5f));
+   return player->entityID();
+}
+
+std::shared_ptr<korin::InputStreamComponent> streamOf(korin::EntityAdmin& admin, korin::EntityID entityID)
+{
+   return std::static_pointer_cast<korin::InputStreamComponent>(
+      admin.findComponent(entityID, korin::Component::typeID<korin::InputStreamComponent>()));
+}
+
+std::shared_ptr<korin::TransformComponent> transformOf(korin::EntityAdmin& admin, korin::EntityID entityID)
+{
+   return std::static_pointer_cast<korin::TransformComponent>(
+      admin.findComponent(entityID, korin::Component::typeID<korin::TransformComponent>()));
+}
+
+// Shuffles back and forth under the remote player
+korin::ActionMask localInput(std::uint32_t tick)
+{
+   return tick % 10 < 5 ? korin::toMask(korin::GameAction::MoveRight) : korin::toMask(korin::GameAction::MoveLeft);
+}
+
+// Changes often so predictions miss, keeping the remote player balanced on the local one
+korin::ActionMask remoteInput(std::uint32_t tick)
+{
+   return (tick / 3) % 2 == 0 ? korin::toMask(korin::GameAction::MoveLeft) : korin::toMask(korin::GameAction::MoveRight);
+}
+
+// Sends the remote input of the tick and the three before it, which arrive three ticks later
+void sendRemoteInput(korin::LoopbackTransport& remoteEnd, std::uint32_t tick)
+{
+   std::vector<korin::ActionMask> inputs;
+   const std::uint32_t firstTick = tick >= 3 ? tick - 3 : 0;
+   for (std::uint32_t sent = firstTick; sent <= tick; sent++)
+   {
+      inputs.push_back(remoteInput(sent));
+   }
+   std::vector<std::uint8_t> packet;
+   korin::RollbackSession::writeInputMessage(packet, 1, firstTick, inputs.data(), static_cast<std::uint8_t>(inputs.size()));
+   remoteEnd.send(packet);
+}
+} // namespace
+
+void test_loopback_transport() {
+   auto transports = korin::LoopbackTransport::createPair(2);
+   korin::LoopbackTransport& a = *transports.first;
+   korin::LoopbackTransport& b = *transports.second;
+
+   a.send({1, 2, 3});
+   std::vector<std::uint8_t> packet;
+   KORIN_ASSERT(!b.receive(packet));
+   b.step();
+   KORIN_ASSERT(!b.receive(packet));
+   b.step();
+   KORIN_ASSERT(b.receive(packet) && packet == std::vector<std::uint8_t>({1, 2, 3}));
+   KORIN_ASSERT(!a.receive(packet));
+
+   b.setLatency(0);
+   b.setDropEvery(2);
+   b.send({4});
+   b.send({5});
+   KORIN_ASSERT(a.receive(packet) && packet[0] == 4);
+   KORIN_ASSERT(!a.receive(packet));
+   KORIN_ASSERT(b.packetsSent() == 2 && b.bytesSent() == 2);
+}
+
+void test_rollback_matches_on_time_input() {
+   korin::EntityAdmin admin;
+   admin.addDefaultSystems(true);
+
+   // Headless worlds don't read the input devices
+   auto inputSystem = std::static_pointer_cast<korin::GameInputSystem>(admin.schedule().phase(korin::SystemPhase::Input).front());
+   KORIN_ASSERT(inputSystem->backend() == nullptr);
+   const korin::EntityID local = createPlayer(admin, 0.0f, 0.5f);
+   const korin::EntityID remote = createPlayer(admin, 0.2f, 1.6f);
+
+   // Static floor under the players. Its input stream keeps the movement system from warning.
+   auto floor = admin.createEntity("floor");
+   admin.addComponent(floor->entityID(), std::make_shared<korin::TransformComponent>(0.0f, -0.5f, 0.0f));
+   auto floorPhysics = std::make_shared<korin::PhysicsComponent>();
+   floorPhysics->inverseMass = 0.0f;
+   floorPhysics->enabled = false;
+   admin.addComponent(floor->entityID(), floorPhysics);
+   admin.addComponent(floor->entityID(), std::make_shared<korin::ColliderComponent>(100.0f, 0.5f));
+   admin.addComponent(floor->entityID(), std::make_shared<korin::BoundsComponent>(100.0f, 0.5f));
+   admin.addComponent(floor->entityID(), std::make_shared<korin::InputStreamComponent>());
+
+   korin::WorldSnapshot start;
+   start.capture(admin);
+
+   // Reference run where every input is known on time
+   for (std::uint32_t tick = 0; tick < TICK_COUNT; tick++)
+   {
+      streamOf(admin, local)->externalActionStates = localInput(tick);
+      streamOf(admin, remote)->externalActionStates = remoteInput(tick);
+      admin.updateSystems(TIME_STEP);
+   }
+   korin::WorldSnapshot reference;
+   reference.capture(admin);
+
+   // The remote player landed on the local one, which stands on the floor
+   KORIN_ASSERT(std::fabs(transformOf(admin, local)->y - 0.5f) < 0.1f);
+   KORIN_ASSERT(std::fabs(transformOf(admin, remote)->y - 1.5f) < 0.1f);
+
+   // The same inputs with the remote ones arriving three ticks late over a lossy link
+   KORIN_ASSERT(start.restore(admin));
+   auto transports = korin::LoopbackTransport::createPair(3);
+   korin::LoopbackTransport& sessionEnd = *transports.first;
+   korin::LoopbackTransport& remoteEnd = *transports.second;
+   remoteEnd.setDropEvery(3);
+
+   korin::RollbackSession session(admin, 8);
+   session.setTransport(&sessionEnd);
+   KORIN_ASSERT(session.addPlayer(0, local, true));
+   KORIN_ASSERT(session.addPlayer(1, remote, false));
+   KORIN_ASSERT(!session.addPlayer(1, remote, false));
+
+   for (std::uint32_t tick = 0; tick < TICK_COUNT; tick++)
+   {
+      sendRemoteInput(remoteEnd, tick);
+      sessionEnd.step();
+      session.setLocalInput(0, localInput(tick));
+      session.advance(TIME_STEP);
+   }
+
+   KORIN_ASSERT(session.currentTick() == TICK_COUNT);
+   KORIN_ASSERT(session.confirmedTick() < TICK_COUNT);
+   KORIN_ASSERT(session.stats().rollbacks > 0);
+   KORIN_ASSERT(session.stats().resimulatedTicks >= session.stats().rollbacks);
+   KORIN_ASSERT(session.stats().lastResimulatedTicks <= session.maxRollbackTicks());
+
+   korin::WorldSnapshot rolledBack;
+   rolledBack.capture(admin);
+   KORIN_ASSERT(rolledBack.data() == reference.data());
+
+   // The local input went out over the transport once per tick
+   KORIN_ASSERT(sessionEnd.packetsSent() == TICK_COUNT);
+
+   // Input too far in the past or future can't be used
+   KORIN_ASSERT(!session.addRemoteInput(1, session.currentTick() + 100, 0));
+   KORIN_ASSERT(session.stats().droppedInputs == 1);
+   KORIN_ASSERT(!session.addRemoteInput(0, session.currentTick(), 0));
+}
+
+void test_rollback_leaves_live_input_alone() {
+   korin::EntityAdmin admin;
+   admin.addDefaultSystems(true);
+   auto inputSystem = std::static_pointer_cast<korin::GameInputSystem>(admin.schedule().phase(korin::SystemPhase::Input).front());
+   auto ownedBackend = std::make_unique<korin::ScriptedInputBackend>();
+   korin::ScriptedInputBackend* backend = ownedBackend.get();
+   inputSystem->setBackend(std::move(ownedBackend));
+   korin::GameActionUtil::instance().mapInputToAction(57, korin::GameAction::Jump);
+   backend->tap(20, 57);
+
+   const korin::EntityID local = createPlayer(admin, 0.0f, 0.5f);
+   const korin::EntityID remote = createPlayer(admin, 0.2f, 1.6f);
+   auto keyboard = admin.createEntity("keyboard");
+   admin.addComponent(keyboard->entityID(), std::make_shared<korin::InputStreamComponent>());
+
+   auto transports = korin::LoopbackTransport::createPair(3);
+   korin::LoopbackTransport& sessionEnd = *transports.first;
+   korin::LoopbackTransport& remoteEnd = *transports.second;
+   korin::RollbackSession session(admin, 8);
+   session.setTransport(&sessionEnd);
+   KORIN_ASSERT(session.addPlayer(0, local, true));
+   KORIN_ASSERT(session.addPlayer(1, remote, false));
+
+   // Test resimulated ticks don't pull frames from the backend, so the scripted tap
+   // reaches the keyboard stream once, on the tick it was scheduled for
+   std::uint32_t jumps = 0;
+   for (std::uint32_t tick = 0; tick < TICK_COUNT; tick++)
+   {
+      sendRemoteInput(remoteEnd, tick);
+      sessionEnd.step();
+      session.setLocalInput(0, localInput(tick));
+      session.advance(TIME_STEP);
+      KORIN_ASSERT(backend->frame() == tick + 1);
+
+      if (streamOf(admin, keyboard->entityID())->actionsBegun & korin::toMask(korin::GameAction::Jump))
+      {
+         KORIN_ASSERT(tick == 20);
+         jumps++;
+      }
+   }
+   KORIN_ASSERT(session.stats().resimulatedTicks > 0);
+   KORIN_ASSERT(jumps == 1);
+   korin::GameActionUtil::instance().unmapInput(57);
+}
+
+int main() {
+   korin::Log::init();
+   test_loopback_transport();
+   test_rollback_matches_on_time_input();
+   test_rollback_leaves_live_input_alone();
+   KORIN_INFO("Rollback tests passed!");
+   return 0;
+}
@@ -0,0 +1,181 @@
+// test_scene_file.cpp
+//
+// This file contains unit tests for the SceneWriter and SceneFile.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/serialization/scene_file.h"
+#include "korin/serialization/world_snapshot.h"
+#include "korin/assets/pack_file.h"
+#include "korin/components/transform_component.h"
+#include "korin/components/physics_component.h"
+#include "korin/components/sprite_component.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+constexpr const char* SCENE_PATH = "test_scene_file.kscn";
+constexpr const char* PACK_PATH = "test_scene_file.kpak";
+
+// A level with a player and a row of crates, one of them already broken
+void buildLevel(korin::EntityAdmin& world)
+{
+   auto player = world.createEntity(korin::StringID::intern("player"));
+   world.addComponent(player->entityID(), std::make_shared<korin::TransformComponent>(0.0f, 1.0f, 0.0f));
+   world.addComponent(player->entityID(), std::make_shared<korin::PhysicsComponent>());
+
+   for (int i = 0; i < 20; i++)
+   {
+      auto crate = world.createEntity("crate");
+      world.addComponent(crate->entityID(), std::make_shared<korin::TransformComponent>(static_cast<float>(i), 0.0f, 0.0f));
+      world.addComponent(crate->entityID(), std::make_shared<korin::SpriteComponent>(2, 1.0f, 1.0f, 0));
+   }
+   world.removeEntity(world.entities().at(5));
+}
+
+std::uint32_t readU32(const std::vector<std::uint8_t>& bytes, std::size_t position)
+{
+   std::uint32_t value = 0;
+   std::memcpy(&value, bytes.data() + position, sizeof(value));
+   return value;
+}
+
+void writeU32(std::vector<std::uint8_t>& bytes, std::size_t position, std::uint32_t value)
+{
+   std::memcpy(bytes.data() + position, &value, sizeof(value));
+}
+
+std::vector<std::uint8_t> snapshotOf(const korin::EntityAdmin& world)
+{
+   korin::WorldSnapshot snapshot;
+   snapshot.capture(world);
+   return snapshot.data();
+}
+} // namespace
+
+void test_scene_round_trip() {
+   korin::EntityAdmin level;
+   buildLevel(level);
+   korin::SceneWriter writer;
+   writer.capture(level);
+   KORIN_ASSERT(writer.write(SCENE_PATH));
+
+   korin::SceneFile scene;
+   KORIN_ASSERT(scene.open(SCENE_PATH));
+   KORIN_ASSERT(scene.entityCount() == 20 && scene.columnCount() == 3);
+
+   // Loading replaces whatever was in the world, keeping IDs and the gap left by the broken crate
+   korin::EntityAdmin world;
+   world.createEntity("leftover");
+   KORIN_ASSERT(scene.load(world));
+   KORIN_ASSERT(world.entityCount() == 20 && world.nextEntityID() == 21);
+   KORIN_ASSERT(world.entities().find(5) == world.entities().end());
+   KORIN_ASSERT(snapshotOf(world) == snapshotOf(level));
+
+   // Loaded components are wired to their siblings
+   auto sprite = std::static_pointer_cast<korin::SpriteComponent>(
+      world.findComponent(3, korin::Component::typeID<korin::SpriteComponent>()));
+   KORIN_ASSERT(sprite->entityID() == 3 && sprite->sibling<korin::TransformComponent>().lock()->x == 2.0f);
+
+   // The scene can be loaded again after the world changed
+   world.removeEntity(world.entities().at(3));
+   KORIN_ASSERT(scene.load(world) && snapshotOf(world) == snapshotOf(level));
+   scene.close();
+   std::remove(SCENE_PATH);
+}
+
+void test_scene_text_export() {
+   korin::EntityAdmin level;
+   buildLevel(level);
+   korin::SceneWriter writer;
+   writer.capture(level);
+
+   korin::PackWriter packWriter;
+   packWriter.add("levels/dock", korin::PackBlobType::Raw, writer.data().data(), writer.data().size());
+   KORIN_ASSERT(packWriter.write(PACK_PATH));
+   korin::PackFile pack;
+   KORIN_ASSERT(pack.open(PACK_PATH));
+   const std::uint32_t entry = pack.find("levels/dock");
+
+   // Scenes are read in place from a pack too
+   korin::SceneFile scene;
+   KORIN_ASSERT(scene.open(pack.data(entry), writer.data().size()));
+   const std::string text = scene.exportText();
+   KORIN_ASSERT(text.find("scene 1\nnext 21\nentity 0 player\n") == 0);
+   KORIN_ASSERT(text.find("entity 1 #175e9a40\n") != std::string::npos);
+   KORIN_ASSERT(text.find("column Transform 1\n   0 00000000 0000803f 00000000 0000803f 0000803f\n") != std::string::npos);
+
+   // Changing one field changes one line
+   std::static_pointer_cast<korin::TransformComponent>(
+      level.findComponent(7, korin::Component::typeID<korin::TransformComponent>()))->y = 2.0f;
+   writer.capture(level);
+   KORIN_ASSERT(scene.open(writer.data().data(), writer.data().size()));
+   const std::string changedText = scene.exportText();
+   KORIN_ASSERT(changedText.size() == text.size());
+   std::size_t differentLines = 0;
+   for (std::size_t begin = 0; begin < text.size();)
+   {
+      const std::size_t end = text.find('\n', begin) + 1;
+      differentLines += text.compare(begin, end - begin, changedText, begin, end - begin) == 0 ? 0 : 1;
+      begin = end;
+   }
+   KORIN_ASSERT(differentLines == 1);
+
+   // Truncated or misaligned data is refused
+   KORIN_ASSERT(!scene.open(pack.data(entry), writer.data().size() - 1) && !scene.isOpen());
+   KORIN_ASSERT(!scene.open(pack.data(entry) + 4, writer.data().size()));
+   pack.close();
+   std::remove(PACK_PATH);
+}
+
+void test_scene_invalid_ids() {
+   korin::EntityAdmin level;
+   buildLevel(level);
+   korin::SceneWriter writer;
+   writer.capture(level);
+
+   // The header holds the next ID at 12 and the entity ID array offset at 16. The first
+   // column's directory entry starts at 24 with its entity ID array offset 16 bytes in.
+   const std::size_t entityIDs = readU32(writer.data(), 16);
+   const std::size_t rowEntityIDs = readU32(writer.data(), 40);
+   korin::SceneFile scene;
+   std::vector<std::uint8_t> bytes = writer.data();
+   KORIN_ASSERT(scene.open(bytes.data(), bytes.size()));
+
+   // Test IDs at or past the next ID are refused, since new entities would reuse them
+   writeU32(bytes, 12, 10);
+   KORIN_ASSERT(!scene.open(bytes.data(), bytes.size()) && !scene.isOpen());
+
+   // Test the invalid ID is refused
+   bytes = writer.data();
+   writeU32(bytes, entityIDs + 19 * 4, korin::INVALID_ENTITY_ID);
+   KORIN_ASSERT(!scene.open(bytes.data(), bytes.size()));
+
+   // Test an entity listed twice is refused
+   bytes = writer.data();
+   writeU32(bytes, entityIDs + 4, readU32(bytes, entityIDs));
+   KORIN_ASSERT(!scene.open(bytes.data(), bytes.size()));
+
+   // Test two rows of a column for the same entity are refused
+   bytes = writer.data();
+   writeU32(bytes, rowEntityIDs + 4, readU32(bytes, rowEntityIDs));
+   KORIN_ASSERT(!scene.open(bytes.data(), bytes.size()));
+}
+
+int main() {
+   korin::Log::init();
+   test_scene_round_trip();
+   test_scene_text_export();
+   test_scene_invalid_ids();
+   KORIN_INFO("Scene file tests passed!");
+   return 0;
+}
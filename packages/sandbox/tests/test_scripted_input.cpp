@@ -0,0 +1,124 @@
+// test_scripted_input.cpp
+//
+// This file contains unit tests for the ScriptedInputBackend driving the GameInputSystem.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <memory>
+#include <vector>
+
+#include "korin/input/scripted_input_backend.h"
+#include "korin/systems/game_input_system.h"
+#include "korin/components/input_stream_component.h"
+#include "korin/util/game_action_util.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+void test_scripted_input() {
+   korin::GameActionUtil::instance().mapInputToAction(30, korin::GameAction::MoveLeft);
+   korin::GameActionUtil::instance().mapInputToAction(57, korin::GameAction::Jump);
+   korin::GameActionUtil::instance().mapInputToAction(korin::BUTTON_INPUT_CODE_BASE + 1, korin::GameAction::SecondaryAbility);
+   const auto moveLeft = korin::toMask(korin::GameAction::MoveLeft);
+   const auto jump = korin::toMask(korin::GameAction::Jump);
+   const auto secondary = korin::toMask(korin::GameAction::SecondaryAbility);
+
+   auto ownedBackend = std::make_unique<korin::ScriptedInputBackend>();
+   korin::ScriptedInputBackend* backend = ownedBackend.get();
+
+   // Test a script is read and events land on their frames
+   KORIN_ASSERT(backend->loadScript(
+      "# walk left, jump while walking, then right click\n"
+      "1 down 30\n"
+      "\n"
+      "3 tap 57   # jump\n"
+      "5 up 30\n"
+      "6 button_down 1\n"
+      "7 button_up 1\n"
+      "7 axis 0 4.5\n"
+      "10 end\n"));
+   KORIN_ASSERT(backend->length() == 10);
+
+   korin::GameInputSystem inputSystem(std::move(ownedBackend));
+   KORIN_ASSERT(inputSystem.backend() == backend);
+   auto inputStream = std::make_shared<korin::InputStreamComponent>();
+   const std::vector<korin::ComponentPtr> streams = {inputStream};
+
+   std::vector<korin::ActionMask> states;
+   std::vector<korin::ActionMask> begun;
+   for (std::uint32_t frame = 0; frame < 10; frame++)
+   {
+      inputSystem.updateBatch(1.0f / 60.0f, streams);
+      states.push_back(inputStream->currentActionStates);
+      begun.push_back(inputStream->actionsBegun);
+   }
+
+   KORIN_ASSERT(states[0] == 0);
+   KORIN_ASSERT(states[1] == moveLeft && begun[1] == moveLeft);
+   KORIN_ASSERT(states[3] == moveLeft && begun[3] == jump);
+   KORIN_ASSERT(states[5] == 0);
+   KORIN_ASSERT(states[6] == secondary);
+   KORIN_ASSERT(states[7] == 0);
+   KORIN_ASSERT(inputSystem.axisValue(0) == 4.5f);
+   KORIN_ASSERT(backend->finished());
+
+   // Test a looping script starts over after its end frame
+   backend->setLooping(true);
+   inputSystem.updateBatch(1.0f / 60.0f, streams);
+   inputSystem.updateBatch(1.0f / 60.0f, streams);
+   KORIN_ASSERT(inputStream->currentActionStates == moveLeft);
+   KORIN_ASSERT(!backend->finished());
+
+   // Test events scheduled from code and out of order are sorted onto their frames
+   backend->clear();
+   backend->setLooping(false);
+   backend->release(4, 57);
+   backend->press(2, 57);
+   backend->release(0, 30);
+   for (std::uint32_t frame = 0; frame < 3; frame++)
+   {
+      inputSystem.updateBatch(1.0f / 60.0f, streams);
+   }
+   KORIN_ASSERT(inputStream->currentActionStates == jump);
+   inputSystem.updateBatch(1.0f / 60.0f, streams);
+   inputSystem.updateBatch(1.0f / 60.0f, streams);
+   KORIN_ASSERT(inputStream->currentActionStates == 0);
+
+   // Test an event for a frame that already passed is skipped and doesn't hold back later ones
+   backend->clear();
+   for (std::uint32_t frame = 0; frame < 3; frame++)
+   {
+      inputSystem.updateBatch(1.0f / 60.0f, streams);
+   }
+   backend->press(1, 30);
+   backend->press(4, 57);
+   inputSystem.updateBatch(1.0f / 60.0f, streams);
+   inputSystem.updateBatch(1.0f / 60.0f, streams);
+   KORIN_ASSERT(inputStream->currentActionStates == jump);
+   backend->release(5, 57);
+   inputSystem.updateBatch(1.0f / 60.0f, streams);
+   KORIN_ASSERT(inputStream->currentActionStates == 0);
+
+   // Test bad scripts are refused without adding anything
+   korin::ScriptedInputBackend rejected;
+   KORIN_ASSERT(!rejected.loadScript("1 down 30\n2 jump 57\n"));
+   KORIN_ASSERT(!rejected.loadScript("down 30\n"));
+   KORIN_ASSERT(!rejected.loadScript("1 down 5000\n"));
+   KORIN_ASSERT(!rejected.loadScript("1 down 800\n"));
+   KORIN_ASSERT(!rejected.loadScript("1 button_down 300\n"));
+   KORIN_ASSERT(rejected.loadScript("1 button_down 255\n"));
+   rejected.clear();
+   KORIN_ASSERT(rejected.length() == 0);
+
+   // Test the default bindings are only assigned once, so other input systems don't undo changes
+   korin::GameActionUtil::instance().clearMappings();
+   korin::GameInputSystem secondInputSystem(nullptr);
+   KORIN_ASSERT(korin::GameActionUtil::instance().getActionsForInput(~korin::InputState()) == 0);
+}
+
+int main() {
+   korin::Log::init();
+   test_scripted_input();
+   KORIN_INFO("Scripted input tests passed!");
+   return 0;
+}
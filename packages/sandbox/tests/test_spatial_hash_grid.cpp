@@ -0,0 +1,196 @@
+// test_spatial_hash_grid.cpp
+//
+// This file contains unit tests for the SpatialHashGrid class and the SpatialQuerySystem.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <utility>
+
+#include "korin/entity_admin.h"
+#include "korin/spatial/spatial_hash_grid.h"
+#include "korin/systems/spatial_query_system.h"
+#include "korin/components/bounds_component.h"
+#include "korin/components/transform_component.h"
+#include "korin/math/aabb.h"
+#include "korin/math/vector2d.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+void test_spatial_hash_grid() {
+   korin::SpatialHashGrid grid(1.0f);
+
+   // Test insert() and size()
+   grid.insert(0, korin::AABB(0.0f, 0.0f, 0.5f, 0.5f));
+   grid.insert(1, korin::AABB(0.25f, 0.25f, 2.5f, 2.5f));
+   grid.insert(2, korin::AABB(10.0f, 10.0f, 11.0f, 11.0f));
+   grid.insert(3, korin::AABB(-3.0f, -3.0f, -2.0f, -2.0f));
+   KORIN_ASSERT(grid.size() == 4);
+   KORIN_ASSERT(grid.contains(2));
+   KORIN_ASSERT(!grid.contains(4));
+
+   // Test queryRegion() reports each entity once even when it spans many cells
+   std::vector<korin::EntityID> results;
+   grid.queryRegion(korin::AABB(0.0f, 0.0f, 3.0f, 3.0f), results);
+   std::sort(results.begin(), results.end());
+   KORIN_ASSERT(results.size() == 2);
+   KORIN_ASSERT(results[0] == 0 && results[1] == 1);
+
+   // Test queryRegion() with negative coordinates
+   results.clear();
+   grid.queryRegion(korin::AABB(-2.5f, -2.5f, -2.4f, -2.4f), results);
+   KORIN_ASSERT(results.size() == 1 && results[0] == 3);
+
+   // Test queryPoint()
+   results.clear();
+   grid.queryPoint(korin::Vector2D(2.0f, 2.0f), results);
+   KORIN_ASSERT(results.size() == 1 && results[0] == 1);
+
+   // Test queryPairs() reports overlapping pairs once
+   std::vector<std::pair<korin::EntityID, korin::EntityID>> pairs;
+   grid.queryPairs(pairs);
+   KORIN_ASSERT(pairs.size() == 1);
+   KORIN_ASSERT(pairs[0] == std::make_pair(korin::EntityID(0), korin::EntityID(1)));
+
+   // Test update() moves an entity between cells
+   grid.update(2, korin::AABB(2.0f, 2.0f, 3.0f, 3.0f));
+   pairs.clear();
+   grid.queryPairs(pairs);
+   KORIN_ASSERT(pairs.size() == 2);
+
+   results.clear();
+   grid.queryRegion(korin::AABB(10.0f, 10.0f, 11.0f, 11.0f), results);
+   KORIN_ASSERT(results.empty());
+
+   // Test remove()
+   grid.remove(1);
+   KORIN_ASSERT(grid.size() == 3);
+   pairs.clear();
+   grid.queryPairs(pairs);
+   KORIN_ASSERT(pairs.empty());
+
+   // Test queryPairs() against brute force
+   korin::SpatialHashGrid denseGrid(2.0f);
+   std::vector<korin::AABB> boxes;
+   for (korin::EntityID id = 0; id < 200; id++)
+   {
+      const float x = static_cast<float>((id * 37) % 50);
+      const float y = static_cast<float>((id * 91) % 50);
+      const float extent = 0.5f + static_cast<float>(id % 5);
+      boxes.emplace_back(x, y, x + extent, y + extent);
+      denseGrid.insert(id, boxes.back());
+   }
+
+   std::size_t bruteForcePairs = 0;
+   for (std::size_t i = 0; i < boxes.size(); i++)
+   {
+      for (std::size_t j = i + 1; j < boxes.size(); j++)
+      {
+         bruteForcePairs += boxes[i].intersects(boxes[j]) ? 1 : 0;
+      }
+   }
+
+   pairs.clear();
+   denseGrid.queryPairs(pairs);
+   KORIN_ASSERT(pairs.size() == bruteForcePairs);
+}
+
+void test_spatial_hash_grid_churn() {
+   korin::SpatialHashGrid grid(1.0f);
+
+   // Test entities coming and going reuse the slots of removed ones, even with large IDs
+   korin::EntityID next = 1000000;
+   for (int tick = 0; tick < 100; tick++)
+   {
+      grid.insert(next, korin::AABB(0.0f, 0.0f, 1.0f, 1.0f));
+      grid.insert(next + 1, korin::AABB(0.5f, 0.5f, 1.5f, 1.5f));
+
+      std::vector<std::pair<korin::EntityID, korin::EntityID>> pairs;
+      grid.queryPairs(pairs);
+      KORIN_ASSERT(pairs.size() == 1);
+      KORIN_ASSERT(pairs[0] == std::make_pair(next, next + 1));
+
+      std::vector<korin::EntityID> results;
+      grid.queryPoint(korin::Vector2D(1.25f, 1.25f), results);
+      KORIN_ASSERT(results.size() == 1 && results[0] == next + 1);
+
+      grid.remove(next);
+      grid.remove(next + 1);
+      KORIN_ASSERT(!grid.contains(next));
+      next += 2;
+   }
+   KORIN_ASSERT(grid.size() == 0);
+
+   // Test bounds that are NaN or infinite are rejected
+   const float nan = std::numeric_limits<float>::quiet_NaN();
+   const float infinity = std::numeric_limits<float>::infinity();
+   grid.insert(1, korin::AABB(nan, 0.0f, 1.0f, 1.0f));
+   grid.insert(2, korin::AABB(0.0f, 0.0f, infinity, 1.0f));
+   KORIN_ASSERT(grid.size() == 0);
+
+   // Test update() keeps the old bounds when the new ones are not finite
+   grid.insert(3, korin::AABB(0.0f, 0.0f, 1.0f, 1.0f));
+   grid.update(3, korin::AABB(0.0f, -infinity, 1.0f, 1.0f));
+   std::vector<korin::EntityID> results;
+   grid.queryPoint(korin::Vector2D(0.5f, 0.5f), results);
+   KORIN_ASSERT(results.size() == 1 && results[0] == 3);
+
+   // Test queries that are not finite find nothing
+   results.clear();
+   grid.queryRegion(korin::AABB(nan, nan, nan, nan), results);
+   grid.queryPoint(korin::Vector2D(nan, 0.5f), results);
+   KORIN_ASSERT(results.empty());
+}
+
+void test_spatial_query_system() {
+   korin::EntityAdmin world;
+   auto spatialQuery = std::make_shared<korin::SpatialQuerySystem>(1.0f);
+   world.addSystem(spatialQuery, {"SpatialQuery", korin::SystemPhase::Simulation, {}, {}});
+
+   std::vector<korin::EntityID> entityIDs;
+   for (int i = 0; i < 3; i++)
+   {
+      auto entity = world.createEntity("box");
+      world.addComponent(entity->entityID(), std::make_shared<korin::TransformComponent>(static_cast<float>(i), 0.0f, 0.0f));
+      world.addComponent(entity->entityID(), std::make_shared<korin::BoundsComponent>(0.25f, 0.25f));
+      entityIDs.push_back(entity->entityID());
+   }
+
+   const korin::AABB region(-1.0f, -1.0f, 3.0f, 1.0f);
+   std::vector<korin::EntityID> results;
+   world.updateSystems(1.0f / 60.0f);
+   spatialQuery->grid().queryRegion(region, results);
+   KORIN_ASSERT(results.size() == 3);
+
+   // Destroyed entities are gone from the grid after the next update
+   world.removeEntity(world.entities().at(entityIDs[0]));
+   world.updateSystems(1.0f / 60.0f);
+   results.clear();
+   spatialQuery->grid().queryRegion(region, results);
+   std::sort(results.begin(), results.end());
+   KORIN_ASSERT(results.size() == 2 && results[0] == entityIDs[1] && results[1] == entityIDs[2]);
+
+   // So are entities that lost their bounds
+   world.removeComponent(entityIDs[1], korin::Component::typeID<korin::BoundsComponent>());
+   world.updateSystems(1.0f / 60.0f);
+   results.clear();
+   spatialQuery->grid().queryRegion(region, results);
+   KORIN_ASSERT(results.size() == 1 && results[0] == entityIDs[2]);
+   KORIN_ASSERT(spatialQuery->grid().size() == 1);
+}
+
+int main() {
+   korin::Log::init();
+
+   test_spatial_hash_grid();
+   test_spatial_hash_grid_churn();
+   test_spatial_query_system();
+
+   KORIN_INFO("SpatialHashGrid tests passed!");
+
+   return 0;
+}
@@ -0,0 +1,174 @@
+// test_sprite_batch.cpp
+//
+// This file contains unit tests for the SpriteBatcher, SoftwareRenderBackend, RenderSystem and CameraSystem.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <memory>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/systems/render_system.h"
+#include "korin/systems/camera_system.h"
+#include "korin/render/software_render_backend.h"
+#include "korin/components/sprite_component.h"
+#include "korin/components/camera_component.h"
+#include "korin/components/transform_component.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+constexpr std::uint32_t RED = korin::rgba(255, 0, 0);
+constexpr std::uint32_t BLUE = korin::rgba(0, 0, 255);
+constexpr std::uint32_t BLACK = korin::rgba(0, 0, 0);
+
+std::shared_ptr<korin::SpriteComponent> addSprite(korin::EntityAdmin& world, float x, float y, float rotation,
+   korin::TextureID textureID, std::int16_t layer)
+{
+   auto entity = world.createEntity("sprite");
+   auto sprite = std::make_shared<korin::SpriteComponent>(textureID, 2.0f, 2.0f, layer);
+   world.addComponent(entity->entityID(), std::make_shared<korin::TransformComponent>(x, y, rotation));
+   world.addComponent(entity->entityID(), sprite);
+   return sprite;
+}
+
+// A world that draws into a 16 by 16 framebuffer at 4 pixels per unit
+korin::SoftwareRenderBackend* addRenderer(korin::EntityAdmin& world, std::shared_ptr<korin::RenderSystem>& renderSystem)
+{
+   renderSystem = std::make_shared<korin::RenderSystem>();
+   renderSystem->view = {0.0f, 0.0f, 4.0f};
+   auto backend = std::make_unique<korin::SoftwareRenderBackend>(16, 16);
+   korin::SoftwareRenderBackend* software = backend.get();
+   renderSystem->setBackend(std::move(backend));
+   world.addSystem(renderSystem, {"Render", korin::SystemPhase::Render});
+   return software;
+}
+} // namespace
+
+void test_sprites_are_batched() {
+   korin::EntityAdmin world;
+   std::shared_ptr<korin::RenderSystem> renderSystem;
+   korin::SoftwareRenderBackend* backend = addRenderer(world, renderSystem);
+
+   // Interleaved textures and layers collapse into one batch per layer and texture
+   for (int i = 0; i < 120; i++)
+   {
+      addSprite(world, 0.0f, 0.0f, 0.0f, static_cast<korin::TextureID>(i % 3), static_cast<std::int16_t>(i % 2 == 0 ? -1 : 4));
+   }
+   addSprite(world, 0.0f, 0.0f, 0.0f, 7, 0)->visible = false;
+
+   world.updateFrame(1.0f / 60.0f);
+   const korin::SpriteBatcher& batcher = renderSystem->batcher();
+   KORIN_ASSERT(batcher.instances().size() == 120);
+   KORIN_ASSERT(batcher.batches().size() == 6);
+   KORIN_ASSERT(backend->drawCalls() == 6 && backend->instancesDrawn() == 120);
+
+   std::int16_t previousLayer = INT16_MIN;
+   std::uint32_t nextInstance = 0;
+   for (const korin::DrawBatch& batch : batcher.batches())
+   {
+      KORIN_ASSERT(batch.layer >= previousLayer);
+      KORIN_ASSERT(batch.firstInstance == nextInstance && batch.instanceCount == 20);
+      previousLayer = batch.layer;
+      nextInstance += batch.instanceCount;
+   }
+   KORIN_ASSERT(batcher.batches().front().layer == -1 && batcher.batches().back().layer == 4);
+}
+
+void test_software_rasterizer() {
+   korin::EntityAdmin world;
+   std::shared_ptr<korin::RenderSystem> renderSystem;
+   korin::SoftwareRenderBackend* backend = addRenderer(world, renderSystem);
+
+   // A 2 by 2 unit sprite covers the middle 8 by 8 pixels
+   auto red = addSprite(world, 0.0f, 0.0f, 0.0f, 1, 0);
+   red->color = RED;
+   world.updateFrame(1.0f / 60.0f);
+   KORIN_ASSERT(backend->pixel(4, 4) == RED && backend->pixel(11, 11) == RED);
+   KORIN_ASSERT(backend->pixel(3, 4) == BLACK && backend->pixel(12, 11) == BLACK);
+
+   // Higher layers cover lower ones whatever order they were added in
+   auto blue = addSprite(world, 1.0f, 1.0f, 0.0f, 1, -1);
+   blue->color = BLUE;
+   world.updateFrame(1.0f / 60.0f);
+   KORIN_ASSERT(backend->pixel(10, 5) == RED);
+   KORIN_ASSERT(backend->pixel(13, 2) == BLUE);
+   blue->layer = 1;
+   world.updateFrame(1.0f / 60.0f);
+   KORIN_ASSERT(backend->pixel(10, 5) == BLUE);
+
+   // Translucent sprites blend over what's below
+   blue->color = korin::rgba(0, 0, 255, 128);
+   world.updateFrame(1.0f / 60.0f);
+   KORIN_ASSERT(backend->pixel(10, 5) == korin::rgba(127, 0, 128));
+   blue->visible = false;
+
+   // Textures are sampled from the top left, and rotate with the transform
+   const std::uint32_t texels[4] = {RED, BLUE, korin::rgba(0, 255, 0), korin::rgba(255, 255, 255)};
+   backend->setTexture(2, 2, 2, texels);
+   red->textureID = 2;
+   red->color = korin::WHITE;
+   world.updateFrame(1.0f / 60.0f);
+   KORIN_ASSERT(backend->pixel(5, 5) == RED && backend->pixel(10, 5) == BLUE);
+   KORIN_ASSERT(backend->pixel(5, 10) == korin::rgba(0, 255, 0));
+
+   // A quarter turn counterclockwise moves the top left corner to the bottom left
+   std::static_pointer_cast<korin::TransformComponent>(
+      world.findComponent(red->entityID(), korin::Component::typeID<korin::TransformComponent>()))->rotation = 90.0f;
+   world.updateFrame(1.0f / 60.0f);
+   KORIN_ASSERT(backend->pixel(5, 10) == RED && backend->pixel(5, 5) == BLUE);
+}
+
+void test_offscreen_sprites_are_culled() {
+   korin::EntityAdmin world;
+   std::shared_ptr<korin::RenderSystem> renderSystem;
+   korin::SoftwareRenderBackend* backend = addRenderer(world, renderSystem);
+   world.addSystem(std::make_shared<korin::CameraSystem>(renderSystem), {"Camera", korin::SystemPhase::LateUpdate});
+
+   // The view is 4 by 4 units. A row of sprites 4 units apart leaves only the middle one on screen.
+   for (int i = -5; i <= 5; i++)
+   {
+      addSprite(world, 4.0f * static_cast<float>(i), 0.0f, 0.0f, 1, 0)->color = RED;
+   }
+   world.updateFrame(1.0f / 60.0f);
+   KORIN_ASSERT(renderSystem->batcher().instances().size() == 1);
+   KORIN_ASSERT(renderSystem->batcher().culledCount() == 10);
+   KORIN_ASSERT(backend->instancesDrawn() == 1);
+
+   // Sprites that only reach into the view by rotating are kept
+   auto corner = addSprite(world, 3.2f, 3.2f, 0.0f, 1, 0);
+   world.updateFrame(1.0f / 60.0f);
+   KORIN_ASSERT(renderSystem->batcher().instances().size() == 1);
+   std::static_pointer_cast<korin::TransformComponent>(
+      world.findComponent(corner->entityID(), korin::Component::typeID<korin::TransformComponent>()))->rotation = 45.0f;
+   world.updateFrame(1.0f / 60.0f);
+   KORIN_ASSERT(renderSystem->batcher().instances().size() == 2);
+
+   // The view follows the camera with the highest priority
+   auto low = world.createEntity("camera");
+   world.addComponent(low->entityID(), std::make_shared<korin::TransformComponent>(-16.0f, 0.0f, 0.0f));
+   world.addComponent(low->entityID(), std::make_shared<korin::CameraComponent>(4.0f, 0));
+   auto high = world.createEntity("camera");
+   world.addComponent(high->entityID(), std::make_shared<korin::TransformComponent>(16.0f, 0.0f, 0.0f));
+   auto highCamera = std::make_shared<korin::CameraComponent>(4.0f, 1);
+   world.addComponent(high->entityID(), highCamera);
+   world.updateFrame(1.0f / 60.0f);
+   KORIN_ASSERT(renderSystem->view.centerX == 16.0f);
+   KORIN_ASSERT(renderSystem->batcher().instances().size() == 1 && backend->pixel(8, 8) == RED);
+
+   highCamera->active = false;
+   world.updateFrame(1.0f / 60.0f);
+   KORIN_ASSERT(renderSystem->view.centerX == -16.0f);
+   KORIN_ASSERT(renderSystem->batcher().instances().size() == 1 && backend->pixel(8, 8) == RED);
+}
+
+int main() {
+   korin::Log::init();
+   test_sprites_are_batched();
+   test_software_rasterizer();
+   test_offscreen_sprites_are_culled();
+   KORIN_INFO("Sprite batch tests passed!");
+   return 0;
+}
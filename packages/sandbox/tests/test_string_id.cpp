@@ -0,0 +1,69 @@
+// test_string_id.cpp
+//
+// This file contains unit tests for the StringID and StringTable.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <string>
+#include <unordered_map>
+
+#include "korin/entity_admin.h"
+#include "korin/util/string_id.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+// Hashed by the compiler
+constexpr korin::StringID CRATE = "crate";
+} // namespace
+
+void test_string_ids() {
+   KORIN_STATIC_ASSERT(CRATE.value() == 0x175E9A40u);
+   KORIN_STATIC_ASSERT(korin::StringID("crate") == CRATE);
+   KORIN_STATIC_ASSERT(korin::StringID() == korin::StringID(""));
+
+   // Hashing a runtime string gives the same ID as the literal
+   const std::string loaded = std::string("cr") + "ate";
+   KORIN_ASSERT(korin::StringID(loaded) == CRATE);
+
+   // A buffer bigger than its string hashes like the string
+   char buffer[32] = "crate";
+   KORIN_ASSERT(korin::StringID(buffer) == CRATE);
+   KORIN_ASSERT(korin::StringID::fromValue(CRATE.value()) == CRATE);
+   KORIN_ASSERT(CRATE != korin::StringID("barrel"));
+
+   // Only interned strings can be looked up
+   KORIN_ASSERT(korin::StringID("never interned").str().empty());
+   KORIN_ASSERT(korin::StringID::intern(loaded) == CRATE);
+   KORIN_ASSERT(CRATE.str() == "crate");
+   const std::size_t size = korin::StringTable::instance().size();
+   korin::StringID::intern("crate");
+   KORIN_ASSERT(korin::StringTable::instance().size() == size);
+
+   // A collision keeps the first string
+   const korin::StringID first = korin::StringID::intern("costarring");
+   KORIN_ASSERT(korin::StringID::intern("liquid") == first);
+   KORIN_ASSERT(korin::StringID("liquid").str() == "costarring");
+
+   std::unordered_map<korin::StringID, int> counts;
+   counts[CRATE]++;
+   counts["crate"]++;
+   KORIN_ASSERT(counts.size() == 1 && counts[CRATE] == 2);
+}
+
+void test_entities_keep_ids() {
+   korin::EntityAdmin world;
+   auto entity = world.createEntity("crate");
+   KORIN_ASSERT(entity->getResourceHandle() == CRATE);
+   KORIN_ASSERT(world.createEntity(korin::StringID::intern("spawner/" + std::to_string(3)))->getResourceHandle().str() == "spawner/3");
+}
+
+int main() {
+   korin::Log::init();
+   test_string_ids();
+   test_entities_keep_ids();
+   KORIN_INFO("StringID tests passed!");
+   return 0;
+}
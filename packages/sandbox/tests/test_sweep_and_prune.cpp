@@ -0,0 +1,172 @@
+// test_sweep_and_prune.cpp
+//
+// This file contains unit tests for the SweepAndPrune class.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <set>
+#include <vector>
+
+#include "korin/spatial/sweep_and_prune.h"
+#include "korin/math/aabb.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+std::size_t countEvents(const std::vector<korin::OverlapEvent>& events, korin::OverlapEventType type)
+{
+   return static_cast<std::size_t>(std::count_if(events.begin(), events.end(), 
+      [type](const korin::OverlapEvent& event) { return event.type == type; }));
+}
+} // namespace
+
+void test_sweep_and_prune() {
+   korin::SweepAndPrune broadPhase;
+   std::vector<korin::OverlapEvent> events;
+
+   // Test updatePairs() reports new overlaps as begun
+   broadPhase.insert(0, korin::AABB(0.0f, 0.0f, 1.0f, 1.0f));
+   broadPhase.insert(1, korin::AABB(0.5f, 0.5f, 1.5f, 1.5f));
+   broadPhase.insert(2, korin::AABB(0.5f, 5.0f, 1.5f, 6.0f));
+   broadPhase.updatePairs(events);
+   KORIN_ASSERT(events.size() == 1);
+   KORIN_ASSERT(events[0].a == 0 && events[0].b == 1);
+   KORIN_ASSERT(events[0].type == korin::OverlapEventType::Begin);
+
+   // Test updatePairs() only reports unchanged overlaps as persisting when asked to
+   events.clear();
+   broadPhase.updatePairs(events, true);
+   KORIN_ASSERT(events.size() == 1 && events[0].type == korin::OverlapEventType::Persist);
+
+   events.clear();
+   broadPhase.updatePairs(events);
+   KORIN_ASSERT(events.empty());
+
+   // Test update() moving apart on Y ends the overlap even though X still overlaps
+   broadPhase.update(1, korin::AABB(0.5f, 5.5f, 1.5f, 6.5f));
+   events.clear();
+   broadPhase.updatePairs(events);
+   KORIN_ASSERT(countEvents(events, korin::OverlapEventType::End) == 1);
+   KORIN_ASSERT(countEvents(events, korin::OverlapEventType::Begin) == 1);
+   KORIN_ASSERT(broadPhase.overlappingPairs().size() == 1);
+   KORIN_ASSERT(*broadPhase.overlappingPairs().begin() == korin::SweepAndPrune::pairKey(2, 1));
+
+   // Test remove() ends the entity's pairs
+   broadPhase.remove(2);
+   events.clear();
+   broadPhase.updatePairs(events);
+   KORIN_ASSERT(events.size() == 1 && events[0].type == korin::OverlapEventType::End);
+   KORIN_ASSERT(broadPhase.size() == 2);
+
+   // Test an entity removed and added back before the next update carries on its pairs
+   broadPhase.update(1, korin::AABB(0.5f, 0.5f, 1.5f, 1.5f));
+   events.clear();
+   broadPhase.updatePairs(events);
+   broadPhase.remove(1);
+   broadPhase.insert(1, korin::AABB(0.6f, 0.6f, 1.6f, 1.6f));
+   events.clear();
+   broadPhase.updatePairs(events, true);
+   KORIN_ASSERT(events.size() == 1 && events[0].type == korin::OverlapEventType::Persist);
+
+   // Test insert() and update() reject inverted and NaN bounds
+   broadPhase.insert(3, korin::AABB(2.0f, 0.0f, 1.0f, 1.0f));
+   broadPhase.insert(4, korin::AABB(0.0f, std::nanf(""), 1.0f, 1.0f));
+   KORIN_ASSERT(!broadPhase.contains(3) && !broadPhase.contains(4));
+   broadPhase.update(1, korin::AABB(1.5f, 1.5f, 0.5f, 0.5f));
+   broadPhase.update(1, korin::AABB(std::nanf(""), 0.5f, 1.5f, 1.5f));
+   events.clear();
+   broadPhase.updatePairs(events);
+   KORIN_ASSERT(events.empty());
+   KORIN_ASSERT(broadPhase.overlappingPairs().size() == 1);
+
+   // Test restorePairs() reports the restored pairs that no longer overlap as ended
+   broadPhase.restorePairs({korin::SweepAndPrune::pairKey(0, 1), korin::SweepAndPrune::pairKey(0, 7)});
+   events.clear();
+   broadPhase.updatePairs(events);
+   KORIN_ASSERT(events.size() == 1 && events[0].type == korin::OverlapEventType::End);
+   KORIN_ASSERT(events[0].a == 0 && events[0].b == 7);
+   KORIN_ASSERT(broadPhase.overlappingPairs().size() == 1);
+
+   // Test a new entity takes the slot of a removed one without inheriting its pairs
+   broadPhase.remove(1);
+   events.clear();
+   broadPhase.updatePairs(events);
+   KORIN_ASSERT(events.size() == 1 && events[0].type == korin::OverlapEventType::End);
+   broadPhase.insert(5000000, korin::AABB(5.0f, 5.0f, 6.0f, 6.0f));
+   events.clear();
+   broadPhase.updatePairs(events, true);
+   KORIN_ASSERT(events.empty());
+   broadPhase.update(5000000, korin::AABB(0.5f, 0.5f, 1.5f, 1.5f));
+   events.clear();
+   broadPhase.updatePairs(events);
+   KORIN_ASSERT(events.size() == 1 && events[0].type == korin::OverlapEventType::Begin);
+   KORIN_ASSERT(events[0].a == 0 && events[0].b == 5000000);
+   KORIN_ASSERT(!broadPhase.contains(1));
+
+   // Test moving boxes against brute force across many updates
+   korin::SweepAndPrune movingPhase;
+   std::vector<korin::AABB> boxes;
+   for (korin::EntityID id = 0; id < 300; id++)
+   {
+      const float x = static_cast<float>((id * 37) % 60);
+      const float y = static_cast<float>((id * 91) % 60);
+      boxes.emplace_back(x, y, x + 1.0f + static_cast<float>(id % 3), y + 1.0f);
+      movingPhase.insert(id, boxes.back());
+   }
+
+   std::vector<std::uint64_t> previous;
+   for (int tick = 0; tick < 10; tick++)
+   {
+      for (korin::EntityID id = 0; id < boxes.size(); id++)
+      {
+         const float stepX = (id % 2 == 0 ? 0.3f : -0.3f);
+         const float stepY = (id % 3 == 0 ? 0.2f : -0.1f);
+         boxes[id] = korin::AABB(boxes[id].minX + stepX, boxes[id].minY + stepY, 
+            boxes[id].maxX + stepX, boxes[id].maxY + stepY);
+         movingPhase.update(id, boxes[id]);
+      }
+
+      events.clear();
+      movingPhase.updatePairs(events);
+
+      std::vector<std::uint64_t> expected;
+      for (korin::EntityID a = 0; a < boxes.size(); a++)
+      {
+         for (korin::EntityID b = a + 1; b < boxes.size(); b++)
+         {
+            if (boxes[a].intersects(boxes[b]))
+            {
+               expected.push_back(korin::SweepAndPrune::pairKey(a, b));
+            }
+         }
+      }
+
+      const std::set<std::uint64_t>& pairs = movingPhase.overlappingPairs();
+      KORIN_ASSERT(std::vector<std::uint64_t>(pairs.begin(), pairs.end()) == expected);
+
+      // Only the pairs that changed are reported
+      std::vector<std::uint64_t> begun;
+      std::vector<std::uint64_t> ended;
+      std::set_difference(expected.begin(), expected.end(), previous.begin(), previous.end(), std::back_inserter(begun));
+      std::set_difference(previous.begin(), previous.end(), expected.begin(), expected.end(), std::back_inserter(ended));
+      KORIN_ASSERT(countEvents(events, korin::OverlapEventType::Begin) == begun.size());
+      KORIN_ASSERT(countEvents(events, korin::OverlapEventType::End) == ended.size());
+      KORIN_ASSERT(events.size() == begun.size() + ended.size());
+      previous = expected;
+   }
+}
+
+int main() {
+   korin::Log::init();
+
+   test_sweep_and_prune();
+
+   KORIN_INFO("SweepAndPrune tests passed!");
+
+   return 0;
+}
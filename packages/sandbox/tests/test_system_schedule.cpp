@@ -0,0 +1,129 @@
+// test_system_schedule.cpp
+//
+// This file contains unit tests for the SystemSchedule and the phased EntityAdmin updates.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/system_schedule.h"
+#include "korin/components/transform_component.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+// Writes its name to the log every time it updates
+class RecordingSystem : public korin::System
+{
+public:
+   RecordingSystem(std::string name, std::vector<std::string>& log)
+      : m_Name(std::move(name)), m_Log(log) {}
+
+   void update(float timeStep, const korin::ComponentPtr& component) override {}
+
+   void updateBatch(float timeStep, const std::vector<korin::ComponentPtr>& components) override
+   {
+      m_Log.push_back(m_Name);
+   }
+
+   void notify(const korin::ComponentPtr& component) override {}
+
+   korin::ComponentTypeID primaryComponentTypeID() const override
+   {
+      return korin::Component::typeID<korin::TransformComponent>();
+   }
+
+private:
+   std::string m_Name;
+   std::vector<std::string>& m_Log;
+};
+
+std::string order(const std::vector<korin::SystemPtr>& systems, const std::vector<korin::SystemPtr>& named, const std::string& names)
+{
+   std::string result;
+   for (const korin::SystemPtr& system : systems)
+   {
+      for (std::size_t i = 0; i < named.size(); i++)
+      {
+         if (named[i] == system)
+         {
+            result += names[i];
+         }
+      }
+   }
+   return result;
+}
+} // namespace
+
+void test_schedule_sorts_constraints() {
+   std::vector<std::string> log;
+   std::vector<korin::SystemPtr> systems;
+   for (const char* name : {"A", "B", "C", "D", "E"})
+   {
+      systems.push_back(std::make_shared<RecordingSystem>(name, log));
+   }
+
+   korin::SystemSchedule schedule;
+   KORIN_ASSERT(schedule.add(systems[2], {"C", korin::SystemPhase::Simulation, {"B"}}));
+   KORIN_ASSERT(schedule.add(systems[1], {"B", korin::SystemPhase::Simulation, {"A"}}));
+   KORIN_ASSERT(schedule.add(systems[3], {"D", korin::SystemPhase::Simulation, {"Missing"}}));
+   KORIN_ASSERT(schedule.add(systems[0], {"A", korin::SystemPhase::Simulation, {}, {"D"}}));
+   KORIN_ASSERT(schedule.add(systems[4], {"E", korin::SystemPhase::Render}));
+   KORIN_ASSERT(order(schedule.phase(korin::SystemPhase::Simulation), systems, "ABCDE") == "ABCD");
+   KORIN_ASSERT(order(schedule.phase(korin::SystemPhase::Render), systems, "ABCDE") == "E");
+   KORIN_ASSERT(schedule.phase(korin::SystemPhase::Input).empty());
+
+   // Names and systems can only be added once
+   KORIN_ASSERT(!schedule.add(systems[0], {"Other"}));
+   KORIN_ASSERT(!schedule.add(std::make_shared<RecordingSystem>("A", log), {"A"}));
+
+   // Removing a system sorts the rest again without it
+   KORIN_ASSERT(schedule.remove(systems[1]));
+   KORIN_ASSERT(!schedule.remove(systems[1]));
+   KORIN_ASSERT(order(schedule.phase(korin::SystemPhase::Simulation), systems, "ABCDE") == "CAD");
+
+   // A cycle falls back to the order the systems were added in
+   korin::SystemSchedule cyclic;
+   cyclic.add(systems[0], {"A", korin::SystemPhase::Simulation, {"B"}});
+   cyclic.add(systems[1], {"B", korin::SystemPhase::Simulation, {"A"}});
+   KORIN_ASSERT(order(cyclic.phase(korin::SystemPhase::Simulation), systems, "ABCDE") == "AB");
+}
+
+void test_phases_run_at_their_rate() {
+   std::vector<std::string> log;
+   korin::EntityAdmin world;
+   auto entity = world.createEntity("thing");
+   world.addComponent(entity->entityID(), std::make_shared<korin::TransformComponent>());
+
+   world.addSystem(std::make_shared<RecordingSystem>("render", log), {"Render", korin::SystemPhase::Render});
+   world.addSystem(std::make_shared<RecordingSystem>("late", log), {"Late", korin::SystemPhase::LateUpdate});
+   world.addSystem(std::make_shared<RecordingSystem>("sim", log));
+   world.addSystem(std::make_shared<RecordingSystem>("input", log), {"Input", korin::SystemPhase::Input});
+
+   // A frame that catches up three fixed ticks renders once
+   for (int tick = 0; tick < 3; tick++)
+   {
+      world.updateSystems(1.0f / 60.0f);
+   }
+   world.updateFrame(0.05f);
+   KORIN_ASSERT(log == std::vector<std::string>({"input", "sim", "input", "sim", "input", "sim", "late", "render"}));
+
+   // A server without a display skips rendering
+   log.clear();
+   world.schedule().setPhaseEnabled(korin::SystemPhase::Render, false);
+   world.updateFrame(0.05f);
+   KORIN_ASSERT(log == std::vector<std::string>({"late"}));
+}
+
+int main() {
+   korin::Log::init();
+   test_schedule_sorts_constraints();
+   test_phases_run_at_their_rate();
+   KORIN_INFO("SystemSchedule tests passed!");
+   return 0;
+}
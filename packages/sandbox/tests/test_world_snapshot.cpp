@@ -0,0 +1,152 @@
+// test_world_snapshot.cpp
+//
+// This file contains unit tests for the ComponentRegistry and WorldSnapshot.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <memory>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/serialization/component_registry.h"
+#include "korin/serialization/world_snapshot.h"
+#include "korin/components/transform_component.h"
+#include "korin/components/physics_component.h"
+#include "korin/components/bounds_component.h"
+#include "korin/components/collider_component.h"
+#include "korin/components/input_stream_component.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+std::shared_ptr<korin::TransformComponent> transformOf(korin::EntityAdmin& admin, korin::EntityID entityID)
+{
+   return std::static_pointer_cast<korin::TransformComponent>(
+      admin.findComponent(entityID, korin::Component::typeID<korin::TransformComponent>()));
+}
+} // namespace
+
+void test_component_registry() {
+   const korin::ComponentRegistry& registry = korin::ComponentRegistry::instance();
+   const korin::ComponentType* transform = registry.find(korin::Component::typeID<korin::TransformComponent>());
+   KORIN_ASSERT(transform);
+   KORIN_ASSERT(transform->rowSize == 5 * sizeof(float));
+   KORIN_ASSERT(registry.findStable(korin::ComponentRegistry::hashName("Transform")) == transform);
+
+   // Packing and unpacking only touches the registered fields
+   korin::TransformComponent source(1.0f, 2.0f, 90.0f);
+   source.scaleX = 3.0f;
+   korin::TransformComponent target;
+   std::vector<std::uint8_t> row(transform->rowSize);
+   korin::Component* sourcePtr = &source;
+   korin::Component* targetPtr = &target;
+   transform->pack(&sourcePtr, 1, row.data());
+   transform->unpack(&targetPtr, 1, row.data());
+   KORIN_ASSERT(target.x == 1.0f && target.y == 2.0f && target.rotation == 90.0f);
+   KORIN_ASSERT(target.scaleX == 3.0f && target.scaleY == 1.0f);
+}
+
+void test_world_snapshot() {
+   korin::EntityAdmin admin;
+
+   std::vector<korin::EntityID> entityIDs;
+   for (int i = 0; i < 20; i++)
+   {
+      auto entity = admin.createEntity("crate");
+      entityIDs.push_back(entity->entityID());
+      KORIN_ASSERT(admin.addComponent(entity->entityID(), std::make_shared<korin::TransformComponent>(static_cast<float>(i), 0.0f, 0.0f)));
+      if (i % 2 == 0)
+      {
+         auto physics = std::make_shared<korin::PhysicsComponent>(1.0f, static_cast<float>(i), 0.0f, -9.8f);
+         physics->sleeping = i % 4 == 0;
+         KORIN_ASSERT(admin.addComponent(entity->entityID(), physics));
+      }
+      if (i % 5 == 0)
+      {
+         KORIN_ASSERT(admin.addComponent(entity->entityID(), std::make_shared<korin::ColliderComponent>(0.25f)));
+      }
+   }
+   auto stream = std::make_shared<korin::InputStreamComponent>();
+   stream->currentActionStates = 1ULL << 40;
+   stream->holdCounter[3] = 0xF0;
+   KORIN_ASSERT(admin.addComponent(entityIDs[3], stream));
+
+   korin::WorldSnapshot snapshot;
+   snapshot.capture(admin);
+   KORIN_ASSERT(snapshot.entityCount() == 20);
+   const korin::EntityID nextEntityID = admin.nextEntityID();
+
+   // The same world captures to the same bytes
+   korin::WorldSnapshot again;
+   again.capture(admin);
+   KORIN_ASSERT(again.data() == snapshot.data());
+
+   // Changing only values is undone in place
+   transformOf(admin, entityIDs[7])->x = 100.0f;
+   stream->currentActionStates = 0;
+   stream->holdCounter[3] = 0;
+   KORIN_ASSERT(snapshot.restore(admin));
+   KORIN_ASSERT(snapshot.lastRestoreWasInPlace());
+   KORIN_ASSERT(transformOf(admin, entityIDs[7])->x == 7.0f);
+   KORIN_ASSERT(stream->currentActionStates == 1ULL << 40);
+   KORIN_ASSERT(stream->holdCounter[3] == 0xF0);
+
+   // Adding and removing entities rebuilds the world with the original IDs
+   admin.removeEntity(admin.entities().at(entityIDs[4]));
+   auto extra = admin.createEntity("extra");
+   KORIN_ASSERT(admin.addComponent(extra->entityID(), std::make_shared<korin::BoundsComponent>()));
+   KORIN_ASSERT(snapshot.restore(admin));
+   KORIN_ASSERT(!snapshot.lastRestoreWasInPlace());
+   KORIN_ASSERT(admin.entityCount() == 20);
+   KORIN_ASSERT(admin.entities().find(extra->entityID()) == admin.entities().end());
+   KORIN_ASSERT(admin.entities().at(entityIDs[4])->getResourceHandle() == "crate");
+   KORIN_ASSERT(admin.nextEntityID() == nextEntityID);
+
+   // Rebuilt components are wired up as siblings again
+   auto transform = transformOf(admin, entityIDs[4]);
+   auto physics = transform->sibling<korin::PhysicsComponent>().lock();
+   KORIN_ASSERT(physics && physics->dy == 4.0f && physics->sleeping);
+   KORIN_ASSERT(physics->entityID() == entityIDs[4]);
+
+   korin::WorldSnapshot rebuilt;
+   rebuilt.capture(admin);
+   KORIN_ASSERT(rebuilt.data() == snapshot.data());
+
+   // A fresh world restored from the snapshot is the same world
+   korin::EntityAdmin copy;
+   KORIN_ASSERT(snapshot.restore(copy));
+   KORIN_ASSERT(copy.entityCount() == 20 && copy.nextEntityID() == nextEntityID);
+   korin::WorldSnapshot copied;
+   copied.capture(copy);
+   KORIN_ASSERT(copied.data() == snapshot.data());
+
+   // Snapshots survive being copied out and loaded back
+   korin::WorldSnapshot loaded;
+   KORIN_ASSERT(loaded.load(snapshot.data()));
+   KORIN_ASSERT(loaded.entityCount() == 20);
+   KORIN_ASSERT(!loaded.load({1, 2, 3}));
+   KORIN_ASSERT(loaded.entityCount() == 20);
+
+   // A schema change makes old snapshots unreadable instead of misread
+   korin::ComponentRegistry& registry = korin::ComponentRegistry::instance();
+   registry.registerType<korin::TransformComponent>("Transform", 2,
+      &korin::TransformComponent::x, &korin::TransformComponent::y, &korin::TransformComponent::rotation);
+   KORIN_ASSERT(!loaded.load(snapshot.data()));
+   registry.registerType<korin::TransformComponent>("Transform", 1,
+      &korin::TransformComponent::x, &korin::TransformComponent::y, &korin::TransformComponent::rotation,
+      &korin::TransformComponent::scaleX, &korin::TransformComponent::scaleY);
+   KORIN_ASSERT(loaded.load(snapshot.data()));
+
+   admin.clear();
+   KORIN_ASSERT(admin.entityCount() == 0);
+}
+
+int main() {
+   korin::Log::init();
+   test_component_registry();
+   test_world_snapshot();
+   KORIN_INFO("WorldSnapshot tests passed!");
+   return 0;
+}
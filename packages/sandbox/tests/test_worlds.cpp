@@ -0,0 +1,173 @@
+// test_worlds.cpp
+//
+// This file contains unit tests for running several EntityAdmin worlds side by side.
+//
+// Zachary Duncan - Duncandoit
+// 10/19/2026
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "korin/entity_admin.h"
+#include "korin/assets/asset_registry.h"
+#include "korin/korin_loop.h"
+#include "korin/serialization/world_snapshot.h"
+#include "korin/systems/physics_system.h"
+#include "korin/components/transform_component.h"
+#include "korin/components/physics_component.h"
+#include "korin/serialization/component_registry.h"
+#include "korin/util/game_action_util.h"
+#include "korin/util/assert.h"
+#include "korin/log.h"
+
+namespace
+{
+constexpr std::uint32_t WORLD_COUNT = 4;
+constexpr std::uint32_t TICK_COUNT = 120;
+
+// A match with some falling crates
+void populate(korin::EntityAdmin& world)
+{
+   world.addSystem(std::make_shared<korin::PhysicsSystem>());
+   for (int i = 0; i < 50; i++)
+   {
+      auto crate = world.createEntity("crate");
+      world.addComponent(crate->entityID(), std::make_shared<korin::TransformComponent>(static_cast<float>(i), 10.0f, 0.0f));
+      world.addComponent(crate->entityID(), std::make_shared<korin::PhysicsComponent>(1.0f, 0.0f, 0.0f, -9.8f));
+   }
+}
+} // namespace
+
+void test_worlds_are_independent() {
+   korin::EntityAdmin first;
+   korin::EntityAdmin second;
+
+   // Each world hands out its own IDs
+   auto a = first.createEntity("a");
+   auto b = second.createEntity("b");
+   KORIN_ASSERT(a->entityID() == 0 && b->entityID() == 0);
+   KORIN_ASSERT(first.nextEntityID() == 1 && second.nextEntityID() == 1);
+
+   for (korin::EntityAdmin* world : {&first, &second})
+   {
+      world->addComponent(0, std::make_shared<korin::TransformComponent>(0.0f, 0.0f, 0.0f));
+      world->addComponent(0, std::make_shared<korin::PhysicsComponent>(1.0f, 0.0f, 0.0f, 0.0f));
+   }
+
+   // Only the world with a physics system moves
+   first.addSystem(std::make_shared<korin::PhysicsSystem>());
+   first.updateSystems(1.0f);
+   second.updateSystems(1.0f);
+   auto firstTransform = std::static_pointer_cast<korin::TransformComponent>(
+      first.findComponent(0, korin::Component::typeID<korin::TransformComponent>()));
+   auto secondTransform = std::static_pointer_cast<korin::TransformComponent>(
+      second.findComponent(0, korin::Component::typeID<korin::TransformComponent>()));
+   KORIN_ASSERT(firstTransform->x == 1.0f && secondTransform->x == 0.0f);
+
+   second.clear();
+   KORIN_ASSERT(first.entityCount() == 1 && second.entityCount() == 0);
+}
+
+void test_worlds_on_threads() {
+   // The same match run on its own and on several threads at once ends the same
+   korin::EntityAdmin reference;
+   populate(reference);
+   korin::KorinLoop(reference).runFixedTicks(TICK_COUNT);
+   korin::WorldSnapshot expected;
+   expected.capture(reference);
+
+   std::vector<std::unique_ptr<korin::EntityAdmin>> worlds;
+   for (std::uint32_t i = 0; i < WORLD_COUNT; i++)
+   {
+      worlds.push_back(std::make_unique<korin::EntityAdmin>());
+      populate(*worlds.back());
+   }
+
+   std::vector<std::thread> threads;
+   for (auto& world : worlds)
+   {
+      korin::EntityAdmin* match = world.get();
+      threads.emplace_back([match]() { korin::KorinLoop(*match).runFixedTicks(TICK_COUNT); });
+   }
+   for (std::thread& thread : threads)
+   {
+      thread.join();
+   }
+
+   for (auto& world : worlds)
+   {
+      korin::WorldSnapshot snapshot;
+      snapshot.capture(*world);
+      KORIN_ASSERT(snapshot.data() == expected.data());
+   }
+}
+
+void test_shared_registries_on_threads() {
+   // The registries every world shares are filled before any world thread starts
+   korin::GameActionUtil::instance().mapInputToAction(57, korin::GameAction::Jump);
+   const std::uint32_t pixels[4] = {};
+   const korin::AssetID crateID = korin::AssetRegistry::instance().addImage("worlds/crate", 2, 2, pixels);
+   KORIN_ASSERT(korin::AssetRegistry::instance().buildAtlas(64, 1));
+   KORIN_ASSERT(korin::ComponentRegistry::instance().find(korin::Component::typeID<korin::TransformComponent>()));
+
+   korin::EntityAdmin reference;
+   populate(reference);
+   for (std::uint32_t tick = 0; tick < TICK_COUNT; tick++)
+   {
+      reference.updateSystems(1.0f / 60.0f);
+   }
+   korin::WorldSnapshot expected;
+   expected.capture(reference);
+
+   // Then only read from every thread at once while each steps and saves its own world
+   std::vector<std::unique_ptr<korin::EntityAdmin>> worlds;
+   std::vector<korin::WorldSnapshot> snapshots(WORLD_COUNT);
+   std::vector<int> lookupsMatched(WORLD_COUNT, 0);
+   for (std::uint32_t i = 0; i < WORLD_COUNT; i++)
+   {
+      worlds.push_back(std::make_unique<korin::EntityAdmin>());
+      populate(*worlds.back());
+   }
+
+   std::vector<std::thread> threads;
+   for (std::uint32_t i = 0; i < WORLD_COUNT; i++)
+   {
+      threads.emplace_back([&, i]()
+      {
+         korin::InputState jumping;
+         jumping.set(57);
+         for (std::uint32_t tick = 0; tick < TICK_COUNT; tick++)
+         {
+            worlds[i]->updateSystems(1.0f / 60.0f);
+            const bool jumped = korin::GameActionUtil::instance().getActionsForInput(jumping) == korin::toMask(korin::GameAction::Jump);
+            const bool found = korin::AssetRegistry::instance().find("worlds/crate") == crateID 
+               && korin::AssetRegistry::instance().sprite(crateID) != nullptr;
+            lookupsMatched[i] += jumped && found ? 1 : 0;
+         }
+         snapshots[i].capture(*worlds[i]);
+      });
+   }
+   for (std::thread& thread : threads)
+   {
+      thread.join();
+   }
+
+   for (std::uint32_t i = 0; i < WORLD_COUNT; i++)
+   {
+      KORIN_ASSERT(lookupsMatched[i] == static_cast<int>(TICK_COUNT));
+      KORIN_ASSERT(snapshots[i].data() == expected.data());
+   }
+
+   korin::GameActionUtil::instance().clearMappings();
+   korin::AssetRegistry::instance().clear();
+}
+
+int main() {
+   korin::Log::init();
+   test_worlds_are_independent();
+   test_worlds_on_threads();
+   test_shared_registries_on_threads();
+   KORIN_INFO("World tests passed!");
+   return 0;
+}